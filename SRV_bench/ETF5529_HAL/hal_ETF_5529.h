@@ -0,0 +1,28 @@
+/*******************************************************************************
+    Filename: hal_ETF5438A.h
+
+    Copyright 2010 Texas Instruments, Inc.
+
+This is the master header file and also the only necessary file to be included
+in order to use MSP-EXP430F5438 HAL.
+***************************************************************************/
+#ifndef HAL_ETF5438A_H
+#define HAL_ETF5438A_H
+
+#include "msp430.h"
+#include "hal_board.h"
+#include "hal_led.h"
+#include "hal_7seg.h"
+#include "hal_gpio.h"
+#include "hal_button.h"
+#include "hal_frame.h"
+#include "hal_clock.h"
+#include "hal_uart.h"
+#include "hal_hrtimer.h"
+#include "hal_cycles.h"
+#include "hal_latency.h"
+#include "../drivers/MSP430F5xx_6xx/pmm.h"
+#include "../drivers/MSP430F5xx_6xx/ucs.h"
+
+
+#endif /* HAL_ETF5438A_H */
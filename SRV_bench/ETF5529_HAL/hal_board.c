@@ -0,0 +1,84 @@
+/**
+ * @file  hal_board.c
+ *
+ * Copyright 2010 Texas Instruments, Inc.
+******************************************************************************/
+#include "hal_ETF_5529.h"
+#include "msp430.h"
+
+
+/**********************************************************************//**
+ * @brief  Initializes all GPIO configurations.
+ *
+ * @param  none
+ *
+ * @return none
+ *************************************************************************/
+void halBoardInit(void)
+{
+  //Tie unused ports
+  PAOUT  = 0;
+  PADIR  = 0xFFFF;
+  PASEL  = 0;
+  PBOUT  = 0;
+  PBDIR  = 0xFFFF;
+  PBSEL  = 0;
+  PCOUT  = 0;
+  PCDIR  = 0xFFFF;
+  PCSEL  = 0;
+  PDOUT  = 0;
+  PDDIR  = 0xFFFF;
+  PDSEL  = 0x0003;
+  PJOUT  = 0;
+  PJDIR  = 0xFF;
+}
+
+/**********************************************************************//**
+ * @brief  Get VCore level sufficient for MCLK frequency.
+ *
+ * @param  clock_rate_khz MCLK frequency in KHz
+ *
+ * @return PMMCOREV_x level to be passed to PMM_setVCore()
+ *************************************************************************/
+unsigned short hal430GetVCoreLevel(unsigned long clock_rate_khz)
+{
+  if(clock_rate_khz <= 8000L)
+  {
+      return PMMCOREV_0;
+  }
+  else if(clock_rate_khz <= 12000L)
+  {
+      return PMMCOREV_1;
+  }
+  else if(clock_rate_khz <= 20000L)
+  {
+      return PMMCOREV_2;
+  }
+  return PMMCOREV_3;
+}
+
+/**********************************************************************//**
+ * @brief  Set function for MCLK frequency.
+ *
+ * Used once at boot, hal_clock.c changes frequency at run time.
+ *
+ * @return none
+ *************************************************************************/
+void hal430SetSystemClock(unsigned long req_clock_rate, unsigned long ref_clock_rate)
+{
+  /* Convert a Hz value to a KHz value, as required
+   *  by the Init_FLL_Settle() function. */
+  unsigned long ulCPU_Clock_KHz = req_clock_rate / 1000UL;
+
+  //Make sure we aren't overclocking
+  if(ulCPU_Clock_KHz > 25000L)
+  {
+    ulCPU_Clock_KHz = 25000L;
+  }
+
+  //Set VCore to a level sufficient for the requested clock speed.
+  PMM_setVCore(hal430GetVCoreLevel(ulCPU_Clock_KHz));
+
+  //Set the DCO
+  UCS_initFLLSettle( ( unsigned short )ulCPU_Clock_KHz, req_clock_rate / ref_clock_rate );
+}
@@ -0,0 +1,85 @@
+/**
+ * @file    hal_clock.c
+ * @date    2021
+ * @brief   CLOCK MANAGER API
+ *
+ * VCore must support frequency before DCO is raised and can be lowered
+ * only after DCO is slowed down, so order of PMM and UCS calls depends
+ * on direction of change. Scheduler is suspended while clocks settle so
+ * no task runs with dividers computed for old frequency, interrupts stay
+ * enabled and tick (ACLK based) is not lost.
+ */
+
+#include "hal_clock.h"
+#include "hal_board.h"
+#include "msp430.h"
+#include "../drivers/MSP430F5xx_6xx/pmm.h"
+#include "../drivers/MSP430F5xx_6xx/ucs.h"
+
+typedef struct{
+    hal_clock_listener_t    pxListener;
+    void                   *pvParameter;
+}hal_clock_listener_entry_t;
+
+static hal_clock_listener_entry_t   pxListeners[ HAL_CLOCK_MAX_LISTENERS ];
+static UBaseType_t                  uxListenerCount = 0;
+/* hal430SetSystemClock() sets configCPU_CLOCK_HZ at boot */
+static uint32_t                     ulCurrentFrequencyHz = configCPU_CLOCK_HZ;
+
+BaseType_t xHALClockRegisterListener( hal_clock_listener_t pxListener, void *pvParameter ){
+    BaseType_t xReturn = pdFAIL;
+
+    taskENTER_CRITICAL();
+    {
+        if( uxListenerCount < HAL_CLOCK_MAX_LISTENERS ){
+            pxListeners[ uxListenerCount ].pxListener   = pxListener;
+            pxListeners[ uxListenerCount ].pvParameter  = pvParameter;
+            uxListenerCount++;
+            xReturn = pdPASS;
+        }
+    }
+    taskEXIT_CRITICAL();
+
+    return xReturn;
+}
+
+BaseType_t xHALClockSetFrequency( uint32_t ulFrequencyHz ){
+    uint16_t    usFrequencyKHz;
+    uint16_t    usRatio;
+    UBaseType_t x;
+
+    if( ulFrequencyHz > HAL_CLOCK_MAX_HZ ){
+        ulFrequencyHz = HAL_CLOCK_MAX_HZ;
+    }
+    if( ulFrequencyHz < configLFXT_CLOCK_HZ ){
+        return pdFAIL;
+    }
+    usFrequencyKHz  = ( uint16_t ) ( ulFrequencyHz / 1000UL );
+    usRatio         = ( uint16_t ) ( ulFrequencyHz / configLFXT_CLOCK_HZ );
+
+    vTaskSuspendAll();
+    {
+        if( ulFrequencyHz > ulCurrentFrequencyHz ){
+            /* Speed up: raise core voltage first */
+            PMM_setVCore( hal430GetVCoreLevel( usFrequencyKHz ) );
+            UCS_initFLLSettle( usFrequencyKHz, usRatio );
+        }
+        else if( ulFrequencyHz < ulCurrentFrequencyHz ){
+            /* Slow down: lower core voltage only when DCO is already slow */
+            UCS_initFLLSettle( usFrequencyKHz, usRatio );
+            PMM_setVCore( hal430GetVCoreLevel( usFrequencyKHz ) );
+        }
+        ulCurrentFrequencyHz = ulFrequencyHz;
+
+        for( x = 0; x < uxListenerCount; x++ ){
+            pxListeners[ x ].pxListener( ulFrequencyHz, pxListeners[ x ].pvParameter );
+        }
+    }
+    xTaskResumeAll();
+
+    return pdPASS;
+}
+
+uint32_t ulHALClockGetFrequency( void ){
+    return ulCurrentFrequencyHz;
+}
@@ -0,0 +1,143 @@
+/*
+ * FreeRTOS Kernel V10.2.0
+ * Copyright (C) 2019 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+#ifndef FREERTOS_CONFIG_H
+#define FREERTOS_CONFIG_H
+
+/*-----------------------------------------------------------
+ * Application specific definitions.
+ *
+ * These definitions should be adjusted for your particular hardware and
+ * application requirements.
+ *
+ * THESE PARAMETERS ARE DESCRIBED WITHIN THE 'CONFIGURATION' SECTION OF THE
+ * FreeRTOS API DOCUMENTATION AVAILABLE ON THE FreeRTOS.org WEB SITE.
+ *
+ * See http://www.freertos.org/a00110.html
+ *----------------------------------------------------------*/
+
+#define configUSE_PREEMPTION			1
+#define configUSE_IDLE_HOOK				1
+#define configUSE_TICK_HOOK				1
+#define configCPU_CLOCK_HZ				( 10000000UL )
+#define configLFXT_CLOCK_HZ       		( 32768L )
+#define configTICK_RATE_HZ				( ( TickType_t ) 1000 )
+#define configMAX_PRIORITIES			( 8 )
+#define configTOTAL_HEAP_SIZE			( ( size_t ) ( 6 * 1024 ) )
+#define configMAX_TASK_NAME_LEN			( 10 )
+#define configUSE_TRACE_FACILITY		0
+#define configUSE_16_BIT_TICKS			1
+/* Tick count wraps one second after start, so the tick_isr_wrap benchmark
+sees the delayed list switch with 16 and with 32 bit ticks. */
+#define configINITIAL_TICK_COUNT		( ( TickType_t ) -1000 )
+#define configIDLE_SHOULD_YIELD			1
+#define configUSE_MUTEXES				1
+#define configQUEUE_REGISTRY_SIZE		0
+#define configGENERATE_RUN_TIME_STATS	0
+#define configCHECK_FOR_STACK_OVERFLOW	2
+#define configUSE_RECURSIVE_MUTEXES		1
+#define configUSE_CEILING_MUTEXES		1
+#define configUSE_MALLOC_FAILED_HOOK	1
+#define configUSE_APPLICATION_TASK_TAG	0
+#define configUSE_COUNTING_SEMAPHORES	1
+#define configUSE_NOTIFY_SEMAPHORES		1
+#define configUSE_QUEUE_SETS			1
+#define configUSE_EVENT_GROUP_DIRECT_FROM_ISR	1
+#define configEVENT_GROUP_MAX_WAITERS	4
+#define configUSE_SELECTIVE_CRITICAL_SECTIONS	1
+#define configUSE_WORK_QUEUES			1
+#define configWORK_QUEUE_CLASSES		2
+#define configUSE_EDF_SCHEDULING		0
+#define configEDF_PRIORITY				( 2 )
+#define configUSE_ADMISSION_CONTROL		0
+#define configADMISSION_MAX_TASKS		8
+#define configUSE_CYCLIC_EXECUTIVE		1
+#define configUSE_RELEASE_MONITOR		1
+#define configRELEASE_JITTER_BINS		4
+#define configUSE_TICK_EPOCH			1
+#define configUSE_PREEMPTION_THRESHOLD	1
+#define configUSE_TASK_BUDGETS			1
+#define configUSE_LATENCY_PROBE			0
+
+#ifdef __LARGE_DATA_MODEL__
+	#define configMINIMAL_STACK_SIZE		( ( unsigned short ) 80 )
+#else
+	#define configMINIMAL_STACK_SIZE		( ( unsigned short ) 120 )
+#endif
+
+/* Co-routine definitions. */
+#define configUSE_CO_ROUTINES 		0
+#define configMAX_CO_ROUTINE_PRIORITIES ( 2 )
+
+/* Software timer definitions. */
+#define configUSE_TIMERS				1
+#define configTIMER_TASK_PRIORITY		( 7 )
+#define configTIMER_QUEUE_LENGTH		10
+#define configTIMER_TASK_STACK_DEPTH	( configMINIMAL_STACK_SIZE )
+
+/* Set the following definitions to 1 to include the API function, or zero
+to exclude the API function. */
+#define INCLUDE_vTaskPrioritySet		0
+#define INCLUDE_uxTaskPriorityGet		0
+#define INCLUDE_vTaskDelete				0
+#define INCLUDE_vTaskCleanUpResources	0
+#define INCLUDE_vTaskSuspend			1
+#define INCLUDE_vTaskDelayUntil			1
+#define INCLUDE_vTaskDelay				1
+#define INCLUDE_xTimerPendFunctionCall	1
+
+/* The MSP430X port uses a callback function to configure its tick interrupt.
+This allows the application to choose the tick interrupt source.
+configTICK_VECTOR must also be set in FreeRTOSConfig.h to the correct interrupt
+vector for the chosen tick interrupt source.  This implementation of
+vApplicationSetupTimerInterrupt() generates the tick from timer A0, so in this
+case configTICK_VECTOR is set to TIMER0_A0_VECTOR. */
+#define configTICK_VECTOR				TIMER0_A0_VECTOR
+
+/* The benchmark wakes tasks from the TB0 CCR1 interrupt, so only CCR1 of Timer
+B0 is masked by critical sections.  TB0 CCR0 is the interrupt that never calls
+the kernel, its latency shows what selective critical sections save. */
+#define configKERNEL_TB0CCIE_MASK		0x02
+
+/* The latency probe in hal_latency.h stamps entry of the tick interrupt, which
+wakes tasks from the tick hook.  The capture is a single xor on TB0CCTL6.  It
+runs after the compiler prologue of vTickISREntry has pushed r11 to r15, so
+tick samples are short by that fixed offset, see HAL_LATENCY_ISR_ENTRY(). */
+#if( configUSE_LATENCY_PROBE == 1 )
+	#define configTICK_ISR_ENTRY_HOOK()	( TB0CCTL6 ^= CCIS0 )
+#endif
+
+#define configASSERT( x ) if( ( x ) == 0 ) { taskDISABLE_INTERRUPTS(); for( ;; ); }
+
+/* enable use of UART */
+//#define configUSE_UART                  1
+
+/* Redefine pdMS_TO_TICKS so it doesn't overflow */
+#define pdMS_TO_TICKS( xTimeInMs ) ( ( TickType_t ) ( ( ( unsigned long ) ( xTimeInMs ) * configTICK_RATE_HZ ) / 1000 ) )
+
+#endif /* FREERTOS_CONFIG_H */
+
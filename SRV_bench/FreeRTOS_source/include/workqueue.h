@@ -0,0 +1,107 @@
+/*
+ * Deferred interrupt work queues for FreeRTOS.
+ *
+ * An interrupt that needs work done at task level submits a function pointer
+ * and two parameters to a work queue instead of giving a semaphore to a task
+ * of its own.  Work queues are numbered priority classes, each served by one
+ * worker task running at the priority given when the class was created.  Work
+ * submitted to a class is run by its worker in submission order, so any
+ * number of interrupt bottom halves of similar urgency share one task stack.
+ *
+ * Items are held in a ring buffer, see ringbuffer.h, and the worker blocks on
+ * its task notification, so submitting work touches no queue or event list.
+ *
+ * 1 tab == 4 spaces!
+ */
+
+#ifndef WORKQUEUE_H
+#define WORKQUEUE_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h" must appear in source files before "include workqueue.h"
+#endif
+
+#include "task.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * workqueue.h
+ *
+ * Prototype of a function run by a worker task.  pvParameter1 and ulParameter2
+ * are the values passed to xWorkQueueSubmit() or xWorkQueueSubmitFromISR().
+ *
+ * \defgroup WorkFunction_t WorkFunction_t
+ * \ingroup WorkQueue
+ */
+typedef void ( *WorkFunction_t )( void *pvParameter1, uint32_t ulParameter2 );
+
+/**
+ * workqueue.h
+ * <pre>BaseType_t xWorkQueueCreateClass( UBaseType_t uxClass, UBaseType_t uxPriority, UBaseType_t uxLength );</pre>
+ *
+ * Create the worker task for class uxClass, which must be less than
+ * configWORK_QUEUE_CLASSES, and a ring buffer for up to uxLength pending work
+ * items.  The worker runs at uxPriority with a stack of
+ * configWORK_QUEUE_STACK_DEPTH words.  Each class can only be created once.
+ *
+ * @return pdPASS if the class was created, pdFAIL if there was not enough heap.
+ *
+ * \defgroup xWorkQueueCreateClass xWorkQueueCreateClass
+ * \ingroup WorkQueue
+ */
+BaseType_t xWorkQueueCreateClass( UBaseType_t uxClass, UBaseType_t uxPriority, UBaseType_t uxLength ) PRIVILEGED_FUNCTION;
+
+/**
+ * workqueue.h
+ * <pre>BaseType_t xWorkQueueSubmit( UBaseType_t uxClass, WorkFunction_t pxFunction, void *pvParameter1, uint32_t ulParameter2 );</pre>
+ *
+ * Queue pxFunction( pvParameter1, ulParameter2 ) to be run by the worker task
+ * of class uxClass.  Never blocks.
+ *
+ * @return pdPASS if the work was queued, pdFAIL if the class queue was full.
+ *
+ * \defgroup xWorkQueueSubmit xWorkQueueSubmit
+ * \ingroup WorkQueue
+ */
+BaseType_t xWorkQueueSubmit( UBaseType_t uxClass, WorkFunction_t pxFunction, void *pvParameter1, uint32_t ulParameter2 ) PRIVILEGED_FUNCTION;
+
+/**
+ * workqueue.h
+ * <pre>BaseType_t xWorkQueueSubmitFromISR( UBaseType_t uxClass, WorkFunction_t pxFunction, void *pvParameter1, uint32_t ulParameter2, BaseType_t *pxHigherPriorityTaskWoken );</pre>
+ *
+ * A version of xWorkQueueSubmit() that can be called from an interrupt.
+ * *pxHigherPriorityTaskWoken is set to pdTRUE if the worker task was unblocked
+ * and has a higher priority than the interrupted task.
+ *
+ * @return pdPASS if the work was queued, pdFAIL if the class queue was full.
+ *
+ * \defgroup xWorkQueueSubmitFromISR xWorkQueueSubmitFromISR
+ * \ingroup WorkQueue
+ */
+BaseType_t xWorkQueueSubmitFromISR( UBaseType_t uxClass, WorkFunction_t pxFunction, void *pvParameter1, uint32_t ulParameter2, BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * workqueue.h
+ * <pre>UBaseType_t uxWorkQueueItemsWaiting( UBaseType_t uxClass );</pre>
+ *
+ * @return The number of work items of class uxClass not yet started.
+ */
+UBaseType_t uxWorkQueueItemsWaiting( UBaseType_t uxClass ) PRIVILEGED_FUNCTION;
+
+/**
+ * workqueue.h
+ * <pre>TaskHandle_t xWorkQueueGetWorkerHandle( UBaseType_t uxClass );</pre>
+ *
+ * @return The handle of the worker task of class uxClass, or NULL if the class
+ * has not been created.  Can be used to check the worker stack high water mark.
+ */
+TaskHandle_t xWorkQueueGetWorkerHandle( UBaseType_t uxClass ) PRIVILEGED_FUNCTION;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* WORKQUEUE_H */
@@ -0,0 +1,284 @@
+/*
+ * Single value mailbox for FreeRTOS, see mailbox.h.
+ *
+ * The value and its version are only changed inside critical sections, so
+ * writers can be interrupts and the list of waiting readers can be
+ * manipulated directly with the scheduler running.  A write wakes every
+ * waiting reader, as each of them wants the new value.
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/* Standard includes. */
+#include <stdlib.h>
+#include <string.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "mailbox.h"
+
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+typedef struct MailboxDefinition
+{
+	List_t xTasksWaitingForUpdate;	/*< Readers blocked in xMailboxWaitForUpdate().  Stored in priority order. */
+	volatile UBaseType_t uxVersion;	/*< Incremented by each write, 0 until the first write. */
+	UBaseType_t uxItemSize;
+	uint8_t *pucItem;				/*< Points just past this structure. */
+} Mailbox_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Copy in the new value, bump the version and unblock all waiting readers.
+ * Must be called from a critical section or with interrupts masked.  Returns
+ * pdTRUE if a task of higher priority than the calling task was unblocked.
+ */
+static BaseType_t prvWrite( Mailbox_t * const pxMailbox, const void * const pvItem ) PRIVILEGED_FUNCTION;
+
+/*
+ * Copy the value out if the mailbox has been written, and return its version.
+ * Must be called from a critical section or with interrupts masked, as the
+ * value is wider than one instruction can copy.
+ */
+static UBaseType_t prvPeek( const Mailbox_t * const pxMailbox, void * const pvItem ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+	MailboxHandle_t xMailboxCreate( UBaseType_t uxItemSize )
+	{
+	Mailbox_t *pxMailbox;
+
+		configASSERT( uxItemSize > ( UBaseType_t ) 0 );
+
+		/* The value is stored in the same allocation, after the structure. */
+		pxMailbox = ( Mailbox_t * ) pvPortMalloc( sizeof( Mailbox_t ) + ( size_t ) uxItemSize );
+
+		if( pxMailbox != NULL )
+		{
+			vListInitialise( &( pxMailbox->xTasksWaitingForUpdate ) );
+			pxMailbox->uxVersion = ( UBaseType_t ) 0;
+			pxMailbox->uxItemSize = uxItemSize;
+			pxMailbox->pucItem = ( ( uint8_t * ) pxMailbox ) + sizeof( Mailbox_t );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return pxMailbox;
+	}
+
+#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+void vMailboxOverwrite( MailboxHandle_t xMailbox, const void * const pvItem )
+{
+Mailbox_t * const pxMailbox = xMailbox;
+
+	configASSERT( pxMailbox );
+	configASSERT( pvItem );
+
+	taskENTER_CRITICAL();
+	{
+		if( prvWrite( pxMailbox, pvItem ) != pdFALSE )
+		{
+			portYIELD_WITHIN_API();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	taskEXIT_CRITICAL();
+}
+/*-----------------------------------------------------------*/
+
+void vMailboxOverwriteFromISR( MailboxHandle_t xMailbox, const void * const pvItem, BaseType_t * const pxHigherPriorityTaskWoken )
+{
+Mailbox_t * const pxMailbox = xMailbox;
+UBaseType_t uxSavedInterruptStatus;
+
+	configASSERT( pxMailbox );
+	configASSERT( pvItem );
+
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		if( prvWrite( pxMailbox, pvItem ) != pdFALSE )
+		{
+			if( pxHigherPriorityTaskWoken != NULL )
+			{
+				*pxHigherPriorityTaskWoken = pdTRUE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxMailboxPeek( MailboxHandle_t xMailbox, void * const pvItem )
+{
+Mailbox_t * const pxMailbox = xMailbox;
+UBaseType_t uxVersion;
+
+	configASSERT( pxMailbox );
+	configASSERT( pvItem );
+
+	/* The mask macros are no-ops on ports without interrupt nesting, so a
+	task needs a full critical section to keep out writers in interrupts and
+	in higher priority tasks. */
+	taskENTER_CRITICAL();
+	{
+		uxVersion = prvPeek( pxMailbox, pvItem );
+	}
+	taskEXIT_CRITICAL();
+
+	return uxVersion;
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxMailboxPeekFromISR( MailboxHandle_t xMailbox, void * const pvItem )
+{
+Mailbox_t * const pxMailbox = xMailbox;
+UBaseType_t uxVersion;
+UBaseType_t uxSavedInterruptStatus;
+
+	configASSERT( pxMailbox );
+	configASSERT( pvItem );
+
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		uxVersion = prvPeek( pxMailbox, pvItem );
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+	return uxVersion;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xMailboxWaitForUpdate( MailboxHandle_t xMailbox, void * const pvItem, UBaseType_t * const puxVersion, TickType_t xTicksToWait )
+{
+Mailbox_t * const pxMailbox = xMailbox;
+TimeOut_t xTimeOut;
+BaseType_t xEntryTimeSet = pdFALSE;
+
+	configASSERT( pxMailbox );
+	configASSERT( pvItem );
+	configASSERT( puxVersion );
+
+	for( ;; )
+	{
+		taskENTER_CRITICAL();
+		{
+			if( ( pxMailbox->uxVersion != *puxVersion ) && ( pxMailbox->uxVersion != ( UBaseType_t ) 0 ) )
+			{
+				( void ) memcpy( pvItem, ( void * ) pxMailbox->pucItem, ( size_t ) pxMailbox->uxItemSize );
+				*puxVersion = pxMailbox->uxVersion;
+				taskEXIT_CRITICAL();
+				return pdPASS;
+			}
+
+			if( xEntryTimeSet == pdFALSE )
+			{
+				vTaskInternalSetTimeOutState( &xTimeOut );
+				xEntryTimeSet = pdTRUE;
+			}
+			else
+			{
+				/* Unblocked by a write, or by the timeout.  Sets xTicksToWait
+				to 0 if the timeout expired. */
+				( void ) xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait );
+			}
+
+			if( xTicksToWait == ( TickType_t ) 0 )
+			{
+				taskEXIT_CRITICAL();
+				return pdFAIL;
+			}
+
+			/* All ports are written to allow a yield in a critical section, the
+			task runs again inside this critical section once unblocked. */
+			vTaskPlaceOnEventList( &( pxMailbox->xTasksWaitingForUpdate ), xTicksToWait );
+			portYIELD_WITHIN_API();
+		}
+		taskEXIT_CRITICAL();
+	}
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxMailboxGetVersion( MailboxHandle_t xMailbox )
+{
+Mailbox_t const * const pxMailbox = xMailbox;
+
+	configASSERT( pxMailbox );
+
+	/* UBaseType_t is read in one access. */
+	return pxMailbox->uxVersion;
+}
+/*-----------------------------------------------------------*/
+
+static UBaseType_t prvPeek( const Mailbox_t * const pxMailbox, void * const pvItem )
+{
+UBaseType_t uxVersion = pxMailbox->uxVersion;
+
+	if( uxVersion != ( UBaseType_t ) 0 )
+	{
+		( void ) memcpy( pvItem, ( void * ) pxMailbox->pucItem, ( size_t ) pxMailbox->uxItemSize );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return uxVersion;
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvWrite( Mailbox_t * const pxMailbox, const void * const pvItem )
+{
+BaseType_t xYieldRequired = pdFALSE;
+
+	( void ) memcpy( ( void * ) pxMailbox->pucItem, pvItem, ( size_t ) pxMailbox->uxItemSize );
+
+	( pxMailbox->uxVersion )++;
+
+	if( pxMailbox->uxVersion == ( UBaseType_t ) 0 )
+	{
+		/* 0 is reserved for a mailbox that was never written. */
+		pxMailbox->uxVersion = ( UBaseType_t ) 1;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	while( listLIST_IS_EMPTY( &( pxMailbox->xTasksWaitingForUpdate ) ) == pdFALSE )
+	{
+		if( xTaskRemoveFromEventList( &( pxMailbox->xTasksWaitingForUpdate ) ) != pdFALSE )
+		{
+			xYieldRequired = pdTRUE;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+
+	return xYieldRequired;
+}
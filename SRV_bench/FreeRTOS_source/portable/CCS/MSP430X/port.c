@@ -0,0 +1,510 @@
+/*
+ * FreeRTOS Kernel V10.2.0
+ * Copyright (C) 2019 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/* Scheduler includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+
+/*-----------------------------------------------------------
+ * Implementation of functions defined in portable.h for the MSP430X port.
+ *----------------------------------------------------------*/
+
+/* Constants required for hardware setup.  The tick ISR runs off the ACLK,
+not the MCLK. */
+#define portACLK_FREQUENCY_HZ			( ( TickType_t ) 32768 )
+#define portINITIAL_CRITICAL_NESTING	( ( uint16_t ) 10 )
+#define portFLAGS_INT_ENABLED			( ( StackType_t ) 0x08 )
+
+/* Set in the stacked critical nesting count of a context frame that holds
+r4 to r15.  Frames saved by vPortYield() only hold r4 to r10.  Must match
+portFULL_FRAME in portext.asm. */
+#define portFULL_CONTEXT_FRAME			( ( StackType_t ) 0x8000 )
+
+/* We require the address of the pxCurrentTCB variable, but don't want to know
+any details of its type. */
+typedef void TCB_t;
+extern volatile TCB_t * volatile pxCurrentTCB;
+
+/* Each task maintains a count of the critical section nesting depth.  Each
+time a critical section is entered the count is incremented.  Each time a
+critical section is exited the count is decremented - with interrupts only
+being re-enabled if the count is zero.
+
+usCriticalNesting will get set to zero when the scheduler starts, but must
+not be initialised to zero as this will cause problems during the startup
+sequence. */
+volatile uint16_t usCriticalNesting = portINITIAL_CRITICAL_NESTING;
+/*-----------------------------------------------------------*/
+
+#if( configUSE_SELECTIVE_CRITICAL_SECTIONS == 1 )
+
+	/* Enable bits cleared by the outermost critical section, restored when it
+	is left.  Only one set is needed - a task can only be switched out inside a
+	critical section by yielding, and vPortYieldFromTask() unmasks first. */
+	static uint16_t usSavedTickIE = 0;
+	static uint8_t ucSavedP1IE = 0;
+	static uint8_t ucSavedP2IE = 0;
+	static uint16_t usSavedADC12IE = 0;
+	static uint8_t ucSavedUCA1IE = 0;
+	static uint16_t usSavedTA1CCIE = 0;
+	static uint16_t usSavedTB0CCIE = 0;
+	static uint8_t ucKernelMasked = pdFALSE;
+
+	/*
+	 * Save and clear, or restore, the enable bits of the kernel aware
+	 * interrupts.  Called with interrupts disabled.
+	 */
+	static void prvMaskKernelInterrupts( void );
+	static void prvUnmaskKernelInterrupts( void );
+
+#endif /* configUSE_SELECTIVE_CRITICAL_SECTIONS */
+/*-----------------------------------------------------------*/
+
+/*
+ * The CCIE bits of a timer are spread over its capture/compare control
+ * registers, which follow each other from CCTL0 on.  These read and change
+ * them as a mask in which bit n stands for CCTLn.  Only the registers of bits
+ * set in usMask, or in usBitsToClear and usBitsToSet, are accessed.
+ */
+static uint16_t prvGetTimerCCIE( volatile uint16_t *pusCCTL, uint16_t usMask );
+static void prvModifyTimerCCIE( volatile uint16_t *pusCCTL, uint16_t usBitsToClear, uint16_t usBitsToSet );
+
+/* One bit for each capture/compare register of Timer A1 and Timer B0. */
+#define portTA1_CCIE_BITS	( ( uint16_t ) 0x07 )
+#define portTB0_CCIE_BITS	( ( uint16_t ) 0x7F )
+/*-----------------------------------------------------------*/
+
+
+/*
+ * Sets up the periodic ISR used for the RTOS tick.  This uses timer 0, but
+ * could have alternatively used the watchdog timer or timer 1.
+ */
+void vPortSetupTimerInterrupt( void );
+/*-----------------------------------------------------------*/
+
+/*
+ * Initialise the stack of a task to look exactly as if a call to
+ * portSAVE_CONTEXT had been called.
+ *
+ * See the header file portable.h.
+ */
+StackType_t *pxPortInitialiseStack( StackType_t *pxTopOfStack, TaskFunction_t pxCode, void *pvParameters )
+{
+uint16_t *pusTopOfStack;
+uint32_t *pulTopOfStack, ulTemp;
+
+	/*
+		Place a few bytes of known values on the bottom of the stack.
+		This is just useful for debugging and can be included if required.
+
+		*pxTopOfStack = ( StackType_t ) 0x1111;
+		pxTopOfStack--;
+		*pxTopOfStack = ( StackType_t ) 0x2222;
+		pxTopOfStack--;
+		*pxTopOfStack = ( StackType_t ) 0x3333;
+		pxTopOfStack--;
+	*/
+
+	/* Data types are need either 16 bits or 32 bits depending on the data 
+	and code model used. */
+	if( sizeof( pxCode ) == sizeof( uint16_t ) )
+	{
+		pusTopOfStack = ( uint16_t * ) pxTopOfStack;
+		ulTemp = ( uint32_t ) pxCode;
+		*pusTopOfStack = ( uint16_t ) ulTemp;
+	}
+	else
+	{
+		/* Make room for a 20 bit value stored as a 32 bit value. */
+		pusTopOfStack = ( uint16_t * ) pxTopOfStack;		
+		pusTopOfStack--;
+		pulTopOfStack = ( uint32_t * ) pusTopOfStack;
+		*pulTopOfStack = ( uint32_t ) pxCode;
+	}
+
+	pusTopOfStack--;
+	*pusTopOfStack = portFLAGS_INT_ENABLED;
+	pusTopOfStack -= ( sizeof( StackType_t ) / 2 );
+	
+	/* From here on the size of stacked items depends on the memory model. */
+	pxTopOfStack = ( StackType_t * ) pusTopOfStack;
+
+	/* Next the general purpose registers. */
+	#ifdef PRELOAD_REGISTER_VALUES
+		*pxTopOfStack = ( StackType_t ) 0xffff;
+		pxTopOfStack--;
+		*pxTopOfStack = ( StackType_t ) 0xeeee;
+		pxTopOfStack--;
+		*pxTopOfStack = ( StackType_t ) 0xdddd;
+		pxTopOfStack--;
+		*pxTopOfStack = ( StackType_t ) pvParameters;
+		pxTopOfStack--;
+		*pxTopOfStack = ( StackType_t ) 0xbbbb;
+		pxTopOfStack--;
+		*pxTopOfStack = ( StackType_t ) 0xaaaa;
+		pxTopOfStack--;
+		*pxTopOfStack = ( StackType_t ) 0x9999;
+		pxTopOfStack--;
+		*pxTopOfStack = ( StackType_t ) 0x8888;
+		pxTopOfStack--;	
+		*pxTopOfStack = ( StackType_t ) 0x5555;
+		pxTopOfStack--;
+		*pxTopOfStack = ( StackType_t ) 0x6666;
+		pxTopOfStack--;
+		*pxTopOfStack = ( StackType_t ) 0x5555;
+		pxTopOfStack--;
+		*pxTopOfStack = ( StackType_t ) 0x4444;
+		pxTopOfStack--;
+	#else
+		pxTopOfStack -= 3;
+		*pxTopOfStack = ( StackType_t ) pvParameters;
+		pxTopOfStack -= 9;
+	#endif
+
+	/* A variable is used to keep track of the critical section nesting.
+	This variable has to be stored as part of the task context and is
+	initially set to zero.  The initial frame is a full frame, as the task
+	function takes pvParameters in r12. */
+	*pxTopOfStack = ( StackType_t ) portNO_CRITICAL_SECTION_NESTING | portFULL_CONTEXT_FRAME;
+
+	/* Return a pointer to the top of the stack we have generated so this can
+	be stored in the task control block for the task. */
+	return pxTopOfStack;
+}
+/*-----------------------------------------------------------*/
+
+void vPortEndScheduler( void )
+{
+	/* It is unlikely that the MSP430 port will get stopped.  If required simply
+	disable the tick interrupt here. */
+}
+/*-----------------------------------------------------------*/
+
+/*
+ * Hardware initialisation to generate the RTOS tick.
+ */
+void vPortSetupTimerInterrupt( void )
+{
+	vApplicationSetupTimerInterrupt();
+}
+/*-----------------------------------------------------------*/
+
+void vPortModifyKernelIE( UBaseType_t uxSource, uint16_t usBitsToClear, uint16_t usBitsToSet )
+{
+uint16_t usStatus;
+uint16_t usMasked = 0;
+
+	usStatus = __get_SR_register();
+	portDISABLE_INTERRUPTS();
+	{
+		#if( configUSE_SELECTIVE_CRITICAL_SECTIONS == 1 )
+		{
+			/* While masked, kernel bits are changed in the saved copy so the
+			change takes effect when the critical section is left. */
+			if( ucKernelMasked != pdFALSE )
+			{
+				switch( uxSource )
+				{
+					case portKERNEL_IE_P1:
+						usMasked = configKERNEL_P1IE_MASK;
+						ucSavedP1IE = ( uint8_t ) ( ( ucSavedP1IE & ~usBitsToClear ) | ( usBitsToSet & usMasked ) );
+						break;
+					case portKERNEL_IE_P2:
+						usMasked = configKERNEL_P2IE_MASK;
+						ucSavedP2IE = ( uint8_t ) ( ( ucSavedP2IE & ~usBitsToClear ) | ( usBitsToSet & usMasked ) );
+						break;
+					case portKERNEL_IE_ADC12:
+						usMasked = configKERNEL_ADC12IE_MASK;
+						usSavedADC12IE = ( usSavedADC12IE & ~usBitsToClear ) | ( usBitsToSet & usMasked );
+						break;
+					case portKERNEL_IE_UCA1:
+						usMasked = configKERNEL_UCA1IE_MASK;
+						ucSavedUCA1IE = ( uint8_t ) ( ( ucSavedUCA1IE & ~usBitsToClear ) | ( usBitsToSet & usMasked ) );
+						break;
+					case portKERNEL_IE_TA1:
+						usMasked = configKERNEL_TA1CCIE_MASK;
+						usSavedTA1CCIE = ( usSavedTA1CCIE & ~usBitsToClear ) | ( usBitsToSet & usMasked );
+						break;
+					default:
+						usMasked = configKERNEL_TB0CCIE_MASK;
+						usSavedTB0CCIE = ( usSavedTB0CCIE & ~usBitsToClear ) | ( usBitsToSet & usMasked );
+						break;
+				}
+			}
+		}
+		#endif /* configUSE_SELECTIVE_CRITICAL_SECTIONS */
+
+		/* Bits that are not masked go straight to the register. */
+		usBitsToSet &= ~usMasked;
+
+		switch( uxSource )
+		{
+			case portKERNEL_IE_P1:
+				P1IE = ( uint8_t ) ( ( P1IE & ~usBitsToClear ) | usBitsToSet );
+				break;
+			case portKERNEL_IE_P2:
+				P2IE = ( uint8_t ) ( ( P2IE & ~usBitsToClear ) | usBitsToSet );
+				break;
+			case portKERNEL_IE_ADC12:
+				ADC12IE = ( ADC12IE & ~usBitsToClear ) | usBitsToSet;
+				break;
+			case portKERNEL_IE_UCA1:
+				UCA1IE = ( uint8_t ) ( ( UCA1IE & ~usBitsToClear ) | usBitsToSet );
+				break;
+			case portKERNEL_IE_TA1:
+				prvModifyTimerCCIE( &TA1CCTL0, usBitsToClear & portTA1_CCIE_BITS, usBitsToSet & portTA1_CCIE_BITS );
+				break;
+			default:
+				prvModifyTimerCCIE( &TB0CCTL0, usBitsToClear & portTB0_CCIE_BITS, usBitsToSet & portTB0_CCIE_BITS );
+				break;
+		}
+	}
+	if( ( usStatus & GIE ) != 0 )
+	{
+		portENABLE_INTERRUPTS();
+	}
+}
+/*-----------------------------------------------------------*/
+
+static uint16_t prvGetTimerCCIE( volatile uint16_t *pusCCTL, uint16_t usMask )
+{
+uint16_t usBits = 0;
+uint16_t usBit;
+
+	for( usBit = 1; usMask != 0; usBit <<= 1, pusCCTL++ )
+	{
+		if( ( usMask & usBit ) != 0 )
+		{
+			usMask &= ~usBit;
+
+			if( ( *pusCCTL & CCIE ) != 0 )
+			{
+				usBits |= usBit;
+			}
+		}
+	}
+
+	return usBits;
+}
+/*-----------------------------------------------------------*/
+
+static void prvModifyTimerCCIE( volatile uint16_t *pusCCTL, uint16_t usBitsToClear, uint16_t usBitsToSet )
+{
+uint16_t usMask = usBitsToClear | usBitsToSet;
+uint16_t usBit;
+
+	for( usBit = 1; usMask != 0; usBit <<= 1, pusCCTL++ )
+	{
+		if( ( usMask & usBit ) != 0 )
+		{
+			usMask &= ~usBit;
+
+			if( ( usBitsToClear & usBit ) != 0 )
+			{
+				*pusCCTL &= ~CCIE;
+			}
+			if( ( usBitsToSet & usBit ) != 0 )
+			{
+				*pusCCTL |= CCIE;
+			}
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+#if( configUSE_SELECTIVE_CRITICAL_SECTIONS == 1 )
+
+	void vPortEnterCritical( void )
+	{
+	uint16_t usStatus;
+
+		/* GIE is only cleared for the few instructions that update the
+		nesting count and the enable bits, and is left as it was found - clear
+		in interrupts and before the scheduler is started. */
+		usStatus = __get_SR_register();
+		portDISABLE_INTERRUPTS();
+
+		if( usCriticalNesting == portNO_CRITICAL_SECTION_NESTING )
+		{
+			prvMaskKernelInterrupts();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		usCriticalNesting++;
+
+		if( ( usStatus & GIE ) != 0 )
+		{
+			portENABLE_INTERRUPTS();
+		}
+	}
+	/*-----------------------------------------------------------*/
+
+	void vPortExitCritical( void )
+	{
+	uint16_t usStatus;
+
+		usStatus = __get_SR_register();
+		portDISABLE_INTERRUPTS();
+
+		if( usCriticalNesting > portNO_CRITICAL_SECTION_NESTING )
+		{
+			usCriticalNesting--;
+
+			if( usCriticalNesting == portNO_CRITICAL_SECTION_NESTING )
+			{
+				prvUnmaskKernelInterrupts();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		if( ( usStatus & GIE ) != 0 )
+		{
+			portENABLE_INTERRUPTS();
+		}
+	}
+	/*-----------------------------------------------------------*/
+
+	void vPortYieldFromTask( void )
+	{
+		if( usCriticalNesting == portNO_CRITICAL_SECTION_NESTING )
+		{
+			vPortYield();
+		}
+		else
+		{
+			/* The task switched in may not be in a critical section.  GIE is
+			cleared first, so the kernel aware interrupts cannot run between
+			unmasking and the switch, and vPortYield() saves it clear, so they
+			cannot run when this task resumes before they are masked again.
+			usCriticalNesting is this task's own count again by then. */
+			portDISABLE_INTERRUPTS();
+			prvUnmaskKernelInterrupts();
+			vPortYield();
+			prvMaskKernelInterrupts();
+			portENABLE_INTERRUPTS();
+		}
+	}
+	/*-----------------------------------------------------------*/
+
+	UBaseType_t uxPortSetAllInterruptMask( void )
+	{
+	uint16_t usStatus;
+
+		usStatus = __get_SR_register();
+		portDISABLE_INTERRUPTS();
+
+		return ( UBaseType_t ) ( usStatus & GIE );
+	}
+	/*-----------------------------------------------------------*/
+
+	void vPortClearAllInterruptMask( UBaseType_t uxSavedStatus )
+	{
+		if( uxSavedStatus != 0 )
+		{
+			portENABLE_INTERRUPTS();
+		}
+	}
+	/*-----------------------------------------------------------*/
+
+	static void prvMaskKernelInterrupts( void )
+	{
+		if( ucKernelMasked == pdFALSE )
+		{
+			usSavedTickIE = TA0CCTL0 & CCIE;
+			TA0CCTL0 &= ~CCIE;
+			ucSavedP1IE = P1IE & configKERNEL_P1IE_MASK;
+			P1IE &= ( uint8_t ) ~configKERNEL_P1IE_MASK;
+			ucSavedP2IE = P2IE & configKERNEL_P2IE_MASK;
+			P2IE &= ( uint8_t ) ~configKERNEL_P2IE_MASK;
+			usSavedADC12IE = ADC12IE & configKERNEL_ADC12IE_MASK;
+			ADC12IE &= ( uint16_t ) ~configKERNEL_ADC12IE_MASK;
+			ucSavedUCA1IE = UCA1IE & configKERNEL_UCA1IE_MASK;
+			UCA1IE &= ( uint8_t ) ~configKERNEL_UCA1IE_MASK;
+			usSavedTA1CCIE = prvGetTimerCCIE( &TA1CCTL0, configKERNEL_TA1CCIE_MASK );
+			prvModifyTimerCCIE( &TA1CCTL0, configKERNEL_TA1CCIE_MASK, 0 );
+			usSavedTB0CCIE = prvGetTimerCCIE( &TB0CCTL0, configKERNEL_TB0CCIE_MASK );
+			prvModifyTimerCCIE( &TB0CCTL0, configKERNEL_TB0CCIE_MASK, 0 );
+			ucKernelMasked = pdTRUE;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	/*-----------------------------------------------------------*/
+
+	static void prvUnmaskKernelInterrupts( void )
+	{
+		if( ucKernelMasked != pdFALSE )
+		{
+			/* Flags raised while masked are still pending, so the interrupts
+			run as soon as GIE is set again. */
+			TA0CCTL0 |= usSavedTickIE;
+			P1IE |= ucSavedP1IE;
+			P2IE |= ucSavedP2IE;
+			ADC12IE |= usSavedADC12IE;
+			UCA1IE |= ucSavedUCA1IE;
+			prvModifyTimerCCIE( &TA1CCTL0, 0, usSavedTA1CCIE );
+			prvModifyTimerCCIE( &TB0CCTL0, 0, usSavedTB0CCIE );
+			ucKernelMasked = pdFALSE;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	/*-----------------------------------------------------------*/
+
+#endif /* configUSE_SELECTIVE_CRITICAL_SECTIONS */
+
+#pragma vector=configTICK_VECTOR
+interrupt void vTickISREntry( void )
+{
+extern void vPortTickISR( void );
+
+	configTICK_ISR_ENTRY_HOOK();
+	__bic_SR_register_on_exit( SCG1 + SCG0 + OSCOFF + CPUOFF );
+	#if configUSE_PREEMPTION == 1
+		extern void vPortPreemptiveTickISR( void );
+		vPortPreemptiveTickISR();
+	#else
+		extern void vPortCooperativeTickISR( void );
+		vPortCooperativeTickISR();
+	#endif
+}
+
+	
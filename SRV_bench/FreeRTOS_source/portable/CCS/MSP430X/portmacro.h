@@ -0,0 +1,228 @@
+/*
+ * FreeRTOS Kernel V10.2.0
+ * Copyright (C) 2019 Amazon.com, Inc. or its affiliates.  All Rights Reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of
+ * this software and associated documentation files (the "Software"), to deal in
+ * the Software without restriction, including without limitation the rights to
+ * use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+ * the Software, and to permit persons to whom the Software is furnished to do so,
+ * subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+ * CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ * http://www.FreeRTOS.org
+ * http://aws.amazon.com/freertos
+ *
+ * 1 tab == 4 spaces!
+ */
+
+#ifndef PORTMACRO_H
+#define PORTMACRO_H
+
+/*-----------------------------------------------------------
+ * Port specific definitions.
+ *
+ * The settings in this file configure FreeRTOS correctly for the
+ * given hardware and compiler.
+ *
+ * These settings should not be altered.
+ *-----------------------------------------------------------
+ */
+
+/* Hardware includes. */
+#include "msp430.h"
+
+/* Type definitions. */
+#define portCHAR		char
+#define portFLOAT		float
+#define portDOUBLE		double
+#define portLONG		long
+#define portSHORT		int
+#define portBASE_TYPE	portSHORT
+
+/* The stack type changes depending on the data model. */
+#ifdef __LARGE_DATA_MODEL__
+	#define portSTACK_TYPE uint32_t
+#else
+	#define portSTACK_TYPE uint16_t
+	#define portPOINTER_SIZE_TYPE uint16_t
+#endif
+
+typedef portSTACK_TYPE StackType_t;
+typedef short BaseType_t;
+typedef unsigned short UBaseType_t;
+
+#if( configUSE_16_BIT_TICKS == 1 )
+	typedef uint16_t TickType_t;
+	#define portMAX_DELAY ( TickType_t ) 0xffff
+#else
+	typedef uint32_t TickType_t;
+	#define portMAX_DELAY ( TickType_t ) 0xffffffffUL
+#endif
+
+/*-----------------------------------------------------------*/
+
+/* Interrupt control macros. */
+#define portDISABLE_INTERRUPTS()	_disable_interrupt(); _nop()
+#define portENABLE_INTERRUPTS()		_enable_interrupt(); _nop()
+/*-----------------------------------------------------------*/
+
+/* Critical section control macros. */
+#define portNO_CRITICAL_SECTION_NESTING		( ( uint16_t ) 0 )
+
+#ifndef configUSE_SELECTIVE_CRITICAL_SECTIONS
+	#define configUSE_SELECTIVE_CRITICAL_SECTIONS	0
+#endif
+
+/* Interrupt sources passed to vPortModifyKernelIE(). */
+#define portKERNEL_IE_P1					( ( UBaseType_t ) 0 )
+#define portKERNEL_IE_P2					( ( UBaseType_t ) 1 )
+#define portKERNEL_IE_ADC12					( ( UBaseType_t ) 2 )
+#define portKERNEL_IE_UCA1					( ( UBaseType_t ) 3 )
+#define portKERNEL_IE_TA1					( ( UBaseType_t ) 4 )
+#define portKERNEL_IE_TB0					( ( UBaseType_t ) 5 )
+
+/* Set and clear interrupt enable bits of a kernel aware source.  Code that
+changes P1IE, P2IE, ADC12IE, UCA1IE or the CCIE bits of Timer A1 or Timer B0
+from inside a critical section must use this, as those registers are masked
+while selective critical sections are active.  For portKERNEL_IE_TA1 and
+portKERNEL_IE_TB0 bit n of the masks stands for CCIE of TA1CCTLn or TB0CCTLn. */
+void vPortModifyKernelIE( UBaseType_t uxSource, uint16_t usBitsToClear, uint16_t usBitsToSet );
+
+#if( configUSE_SELECTIVE_CRITICAL_SECTIONS == 1 )
+
+	/* Critical sections only clear the interrupt enable bits of the sources
+	that call the kernel - the tick (TA0 CCR0) and the bits selected by the
+	masks below - instead of clearing GIE, so other interrupts keep their
+	latency.  Interrupts left enabled must never call the FreeRTOS API, with
+	the one exception of xSeqLockRead(), as seqlock writers hold off all
+	interrupts with the mask below. */
+	#ifndef configKERNEL_P1IE_MASK
+		#define configKERNEL_P1IE_MASK		0xFF
+	#endif
+	#ifndef configKERNEL_P2IE_MASK
+		#define configKERNEL_P2IE_MASK		0xFF
+	#endif
+	#ifndef configKERNEL_ADC12IE_MASK
+		#define configKERNEL_ADC12IE_MASK	0xFFFF
+	#endif
+	#ifndef configKERNEL_UCA1IE_MASK
+		#define configKERNEL_UCA1IE_MASK	0xFF
+	#endif
+	#ifndef configKERNEL_TA1CCIE_MASK
+		#define configKERNEL_TA1CCIE_MASK	0x07
+	#endif
+	#ifndef configKERNEL_TB0CCIE_MASK
+		#define configKERNEL_TB0CCIE_MASK	0x7F
+	#endif
+	#if( ( ( configKERNEL_TA1CCIE_MASK ) & ~0x07 ) != 0 ) || ( ( ( configKERNEL_TB0CCIE_MASK ) & ~0x7F ) != 0 )
+		#error configKERNEL_TA1CCIE_MASK and configKERNEL_TB0CCIE_MASK can only select existing capture/compare registers
+	#endif
+
+	void vPortEnterCritical( void );
+	void vPortExitCritical( void );
+	#define portENTER_CRITICAL()	vPortEnterCritical()
+	#define portEXIT_CRITICAL()		vPortExitCritical()
+
+	/* Clear GIE and return whether it was set, so code that interrupts left
+	enabled above may run into can hold them off too. */
+	UBaseType_t uxPortSetAllInterruptMask( void );
+	void vPortClearAllInterruptMask( UBaseType_t uxSavedStatus );
+	#define portSET_ALL_INTERRUPT_MASK()		uxPortSetAllInterruptMask()
+	#define portCLEAR_ALL_INTERRUPT_MASK( x )	vPortClearAllInterruptMask( x )
+
+#else
+
+#define portENTER_CRITICAL()													\
+{																				\
+extern volatile uint16_t usCriticalNesting;										\
+																				\
+	portDISABLE_INTERRUPTS();													\
+																				\
+	/* Now interrupts are disabled usCriticalNesting can be accessed */			\
+	/* directly.  Increment ulCriticalNesting to keep a count of how many */	\
+	/* times portENTER_CRITICAL() has been called. */							\
+	usCriticalNesting++;														\
+}
+
+#define portEXIT_CRITICAL()														\
+{																				\
+extern volatile uint16_t usCriticalNesting;										\
+																				\
+	if( usCriticalNesting > portNO_CRITICAL_SECTION_NESTING )					\
+	{																			\
+		/* Decrement the nesting count as we are leaving a critical section. */	\
+		usCriticalNesting--;													\
+																				\
+		/* If the nesting level has reached zero then interrupts should be */	\
+		/* re-enabled. */														\
+		if( usCriticalNesting == portNO_CRITICAL_SECTION_NESTING )				\
+		{																		\
+			portENABLE_INTERRUPTS();											\
+		}																		\
+	}																			\
+}
+
+#endif /* configUSE_SELECTIVE_CRITICAL_SECTIONS */
+/*-----------------------------------------------------------*/
+
+/* Task utilities. */
+
+/*
+ * Manual context switch called by portYIELD or taskYIELD.
+ */
+extern void vPortYield( void );
+
+/*
+ * vPortYield() saving the full frame an interrupt saves, for benchmarks of the
+ * reduced frame only.
+ */
+extern void vPortYieldFullFrame( void );
+#if( configUSE_SELECTIVE_CRITICAL_SECTIONS == 1 )
+	/* A task can yield inside a critical section, the kernel aware interrupts
+	must be unmasked for the task switched in and masked again when the
+	yielding task resumes. */
+	extern void vPortYieldFromTask( void );
+	#define portYIELD() vPortYieldFromTask()
+#else
+	#define portYIELD() vPortYield()
+#endif
+/*-----------------------------------------------------------*/
+
+/* Hardware specifics. */
+#define portBYTE_ALIGNMENT			2
+#define portSTACK_GROWTH			( -1 )
+#define portTICK_PERIOD_MS			( ( TickType_t ) 1000 / configTICK_RATE_HZ )
+#define portNOP()					__no_operation()
+
+/* Runs first in the C body of the tick interrupt, after the compiler prologue
+has pushed the save on call registers and before the context is saved. */
+#ifndef configTICK_ISR_ENTRY_HOOK
+	#define configTICK_ISR_ENTRY_HOOK()
+#endif
+/*-----------------------------------------------------------*/
+
+/* Task function macros as described on the FreeRTOS.org WEB site. */
+#define portTASK_FUNCTION_PROTO( vFunction, pvParameters ) void vFunction( void *pvParameters )
+#define portTASK_FUNCTION( vFunction, pvParameters ) void vFunction( void *pvParameters )
+
+extern void vTaskSwitchContext( void );
+#define portYIELD_FROM_ISR( x ) if( x ) vPortYield()
+
+void vApplicationSetupTimerInterrupt( void );
+
+/* sizeof( int ) != sizeof( long ) so a full printf() library is required if
+run time stats information is to be displayed. */
+#define portLU_PRINTF_SPECIFIER_REQUIRED
+
+#endif /* PORTMACRO_H */
+
@@ -0,0 +1,235 @@
+/*
+ * Lock-free single producer, single consumer ring buffer for FreeRTOS, see
+ * ringbuffer.h.
+ *
+ * The item is copied before the index that publishes it is stored, and the
+ * index stores are volatile, so the compiler cannot reorder them.  The MSP430X
+ * does not reorder memory accesses, so no barrier instruction is needed.
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "ringbuffer.h"
+
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/*
+ * Store an item at the head.  Returns pdTRUE if the consumer task has to be
+ * notified, or pdFAIL (with the item dropped) if the buffer is full.
+ */
+static BaseType_t prvPush( RingBuffer_t * const pxRingBuffer, const void * const pvItem, BaseType_t * const pxNotify ) PRIVILEGED_FUNCTION;
+
+/*
+ * Byte copy, items are small and not necessarily aligned.
+ */
+static void prvCopy( uint8_t *pucDestination, const uint8_t *pucSource, UBaseType_t uxSize ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+void vRingBufferInit( RingBuffer_t * const pxRingBuffer, uint8_t * const pucStorage, UBaseType_t uxItems, UBaseType_t uxItemSize )
+{
+	configASSERT( pxRingBuffer );
+	configASSERT( pucStorage );
+	configASSERT( uxItems > ( UBaseType_t ) 0 );
+	configASSERT( uxItemSize > ( UBaseType_t ) 0 );
+
+	pxRingBuffer->uxHead = ( UBaseType_t ) 0;
+	pxRingBuffer->uxTail = ( UBaseType_t ) 0;
+	pxRingBuffer->uxSlots = uxItems + ( UBaseType_t ) 1;
+	pxRingBuffer->uxItemSize = uxItemSize;
+	pxRingBuffer->pucStorage = pucStorage;
+	pxRingBuffer->xConsumerTask = NULL;
+	pxRingBuffer->uxNotifyThreshold = ( UBaseType_t ) 1;
+}
+/*-----------------------------------------------------------*/
+
+void vRingBufferSetConsumerTask( RingBuffer_t * const pxRingBuffer, TaskHandle_t xTask, UBaseType_t uxThreshold )
+{
+	configASSERT( pxRingBuffer );
+	configASSERT( ( uxThreshold > ( UBaseType_t ) 0 ) && ( uxThreshold < pxRingBuffer->uxSlots ) );
+
+	pxRingBuffer->uxNotifyThreshold = uxThreshold;
+	pxRingBuffer->xConsumerTask = xTask;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xRingBufferPush( RingBuffer_t * const pxRingBuffer, const void * const pvItem )
+{
+BaseType_t xReturn, xNotify = pdFALSE;
+
+	configASSERT( pxRingBuffer );
+
+	xReturn = prvPush( pxRingBuffer, pvItem, &xNotify );
+
+	if( xNotify != pdFALSE )
+	{
+		( void ) xTaskNotifyGive( pxRingBuffer->xConsumerTask );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xRingBufferPushFromISR( RingBuffer_t * const pxRingBuffer, const void * const pvItem, BaseType_t * const pxHigherPriorityTaskWoken )
+{
+BaseType_t xReturn, xNotify = pdFALSE;
+
+	configASSERT( pxRingBuffer );
+
+	xReturn = prvPush( pxRingBuffer, pvItem, &xNotify );
+
+	if( xNotify != pdFALSE )
+	{
+		vTaskNotifyGiveFromISR( pxRingBuffer->xConsumerTask, pxHigherPriorityTaskWoken );
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xRingBufferPop( RingBuffer_t * const pxRingBuffer, void * const pvItem )
+{
+UBaseType_t uxTail;
+
+	configASSERT( pxRingBuffer );
+
+	uxTail = pxRingBuffer->uxTail;
+
+	if( uxTail == pxRingBuffer->uxHead )
+	{
+		return pdFAIL;
+	}
+
+	prvCopy( ( uint8_t * ) pvItem, &( pxRingBuffer->pucStorage[ uxTail * pxRingBuffer->uxItemSize ] ), pxRingBuffer->uxItemSize );
+
+	uxTail++;
+	if( uxTail == pxRingBuffer->uxSlots )
+	{
+		uxTail = ( UBaseType_t ) 0;
+	}
+
+	/* Single store frees the slot for the producer. */
+	pxRingBuffer->uxTail = uxTail;
+
+	return pdPASS;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xRingBufferReceive( RingBuffer_t * const pxRingBuffer, void * const pvItem, TickType_t xTicksToWait )
+{
+TimeOut_t xTimeOut;
+
+	configASSERT( pxRingBuffer );
+	#if( ( INCLUDE_xTaskGetCurrentTaskHandle == 1 ) || ( configUSE_MUTEXES == 1 ) )
+	{
+		configASSERT( pxRingBuffer->xConsumerTask == xTaskGetCurrentTaskHandle() );
+	}
+	#endif
+
+	vTaskSetTimeOutState( &xTimeOut );
+
+	for( ;; )
+	{
+		if( xRingBufferPop( pxRingBuffer, pvItem ) != pdFAIL )
+		{
+			return pdPASS;
+		}
+
+		/* A push between the pop above and this call leaves the notification
+		pending, so it is never missed.  A stale notification only costs one
+		more pass round the loop. */
+		if( ( xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait ) != pdFALSE ) ||
+			( ulTaskNotifyTake( pdTRUE, xTicksToWait ) == 0UL ) )
+		{
+			/* Last chance, an item may be below the threshold. */
+			return xRingBufferPop( pxRingBuffer, pvItem );
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxRingBufferItemsWaiting( const RingBuffer_t * const pxRingBuffer )
+{
+UBaseType_t uxHead, uxTail;
+
+	configASSERT( pxRingBuffer );
+
+	uxHead = pxRingBuffer->uxHead;
+	uxTail = pxRingBuffer->uxTail;
+
+	if( uxHead >= uxTail )
+	{
+		return uxHead - uxTail;
+	}
+	else
+	{
+		return ( pxRingBuffer->uxSlots - uxTail ) + uxHead;
+	}
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvPush( RingBuffer_t * const pxRingBuffer, const void * const pvItem, BaseType_t * const pxNotify )
+{
+UBaseType_t uxHead, uxNext;
+
+	uxHead = pxRingBuffer->uxHead;
+	uxNext = uxHead + ( UBaseType_t ) 1;
+
+	if( uxNext == pxRingBuffer->uxSlots )
+	{
+		uxNext = ( UBaseType_t ) 0;
+	}
+
+	if( uxNext == pxRingBuffer->uxTail )
+	{
+		/* Full. */
+		return pdFAIL;
+	}
+
+	prvCopy( &( pxRingBuffer->pucStorage[ uxHead * pxRingBuffer->uxItemSize ] ), ( const uint8_t * ) pvItem, pxRingBuffer->uxItemSize );
+
+	/* Single store publishes the item to the consumer. */
+	pxRingBuffer->uxHead = uxNext;
+
+	/* The count seen by the producer rises by at most one per push, so
+	comparing for equality catches every upward crossing of the threshold. */
+	if( ( pxRingBuffer->xConsumerTask != NULL ) &&
+		( uxRingBufferItemsWaiting( pxRingBuffer ) == pxRingBuffer->uxNotifyThreshold ) )
+	{
+		*pxNotify = pdTRUE;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return pdPASS;
+}
+/*-----------------------------------------------------------*/
+
+static void prvCopy( uint8_t *pucDestination, const uint8_t *pucSource, UBaseType_t uxSize )
+{
+	while( uxSize > ( UBaseType_t ) 0 )
+	{
+		*pucDestination = *pucSource;
+		pucDestination++;
+		pucSource++;
+		uxSize--;
+	}
+}
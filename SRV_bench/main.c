@@ -0,0 +1,1481 @@
+/**
+ * @file    main.c
+ * @date    2021
+ * @brief   Kernel benchmark
+ *
+ * Rhealstone style microbenchmarks of the kernel. Every benchmark takes
+ * mainSAMPLES samples and reports min, mean and max. Time is counted in
+ * SMCLK cycles by TB0. Results are printed once as CSV, over UART at 9600
+ * baud, so a run can be diffed against a baseline run:
+ *
+ *   # clock_hz 10000000
+ *   name,unit,samples,min,mean,max
+ *   task_switch,cycles,128,...
+ *
+ * Cost of reading the clock is measured first and subtracted from every
+ * time sample. Benchmarks which need a feature the kernel is built
+ * without are left out of the table. LED3 is lit when the run is done.
+ *
+ * Besides the classic ones (task switch, preemption, semaphore shuffle,
+ * message, interrupt latency, mutex break) every kernel extension is
+ * measured against what it replaces:
+ *
+ *   task_switch_full       full frame yield, against reduced frame
+ *   tick32_read            tick epoch, against 16 bit tick count
+ *   delay_long_wake        vTaskDelayLong(), against vTaskDelay() in
+ *                          delay_wake
+ *   tick_isr_wrap          tick that wraps the tick count and switches
+ *                          the delayed lists, against tick_isr
+ *   hrtimer_delay_late     time xHALHRTimerDelay() wakes after the
+ *                          requested mainHRTIMER_DELAY_US, shorter than
+ *                          a tick
+ *   queue_burst_threshold  preemption threshold, against queue_burst
+ *   tick_isr_budget        task budgets, against plain tick interrupt
+ *   critical_irq           selective critical sections, latency of a
+ *                          non-kernel interrupt, against gie_off_irq
+ *   notify_sem_*           notification semaphores, against queue ones
+ *   ceiling_*              priority ceiling, against inheritance mutex
+ *   rwlock_*               reader-writer lock, against mutex
+ *   ring_isr_*             ring buffer, against queue from interrupt
+ *   event_isr_direct       event bits set in interrupt, against timer task
+ *   mailbox_*              mailbox, against length one queue
+ *   work_*                 work queue, against bottom half task, also RAM
+ *   cyclic_jitter          cyclic executive, against vTaskDelay()
+ *
+ * EDF against rate monotonic schedulability and the admission test are
+ * offline analyses, see edf_rm_sweep and admission in host/.
+ *
+ * The project is built with selective critical sections. Building it
+ * with configUSE_SELECTIVE_CRITICAL_SECTIONS 0 gives the run to compare
+ * against, the mode is printed in the header.
+ *
+ * The project is also built with 16 bit ticks. Building it with
+ * configUSE_16_BIT_TICKS 0 gives the pure 32 bit tick run: tick_isr,
+ * tick_isr_wrap, tick_read, delay_wake and delay_long_wake of the two
+ * runs compare the tick widths, tick32_read and delay_long_wake of the 16
+ * bit run compare the tick epoch against pure 32 bit ticks. The tick
+ * width is printed in the header. Both builds start the tick count one
+ * second before it wraps, see configINITIAL_TICK_COUNT.
+ */
+
+/* Standard includes. */
+#include <stdio.h>
+#include <stdlib.h>
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+#include "queue.h"
+#include "rwlock.h"
+#include "mailbox.h"
+#include "ringbuffer.h"
+#include "event_groups.h"
+#include "timers.h"
+#include "workqueue.h"
+#include "cyclic.h"
+
+/* Hardware includes. */
+#include "msp430.h"
+
+/* User's includes */
+#include "../common/ETF5529_HAL/hal_ETF_5529.h"
+
+typedef uint16_t bench_time_t;
+#define mainNOW()                           HAL_CYCLES_NOW()
+#define mainTIME_UNIT                       "cycles"
+#define mainCLOCK_HZ                        ulHALClockGetFrequency()
+/** Shorter gaps in clock readings are loop jitter, not tick interrupt */
+#define mainGAP_MIN                         ( 100 )
+/** Cycles from arming TB0 CCR1 until it matches */
+#define mainIRQ_LEAD                        ( 200 )
+/** Cycles interrupts are held off while TB0 CCR0 matches */
+#define mainCRITICAL_HOLD                   ( 1000 )
+/** Work queue class serving TB0 CCR1 interrupt */
+#define mainWORK_CLASS                      ( 0 )
+
+/* Task priorities */
+/** "Runner" task runs benchmarks one after another */
+#define mainRUNNER_TASK_PRIO                ( 2 )
+/** Peers which switch with runner at its own priority */
+#define mainPEER_TASK_PRIO                  ( 2 )
+/** Peers which preempt runner */
+#define mainHIGH_TASK_PRIO                  ( 3 )
+
+/** Samples taken by every benchmark */
+#define mainSAMPLES                         ( 128 )
+/** Reads for every write in read-heavy lock mix */
+#define mainREADS_PER_WRITE                 ( 7 )
+/** Event group bit set from interrupt */
+#define mainEVENT_BIT                       ( 0x01 )
+/** Messages sent in one queue burst */
+#define mainBURST_LENGTH                    ( 8 )
+/** Minor frame of cyclic executive and period of delaying task, in ticks */
+#define mainJITTER_PERIOD                   ( 2 )
+/** Work done in a period goes from none to 1.5 ticks in this many steps */
+#define mainJITTER_STEPS                    ( 8 )
+/** Delay requested from high resolution timer, in microseconds */
+#define mainHRTIMER_DELAY_US                ( 250 )
+/** Runner budget for tick cost with budgets, never runs out during benchmark */
+#define mainRUNNER_BUDGET_TICKS             ( 30000 )
+
+typedef enum{
+    BENCH_TIMER_READ,
+    BENCH_TASK_SWITCH,
+    BENCH_TASK_SWITCH_FULL,
+    BENCH_TICK_PREEMPT,
+    BENCH_SEM_SHUFFLE,
+    BENCH_MESSAGE,
+    BENCH_IRQ_ENTRY,
+    BENCH_IRQ_TO_TASK,
+    BENCH_MUTEX_BREAK,
+    BENCH_TICK_READ,
+    BENCH_TICK32_READ,
+    BENCH_DELAY_WAKE,
+    BENCH_DELAY_LONG_WAKE,
+    BENCH_HRTIMER_DELAY_LATE,
+    BENCH_BURST,
+    BENCH_BURST_WAKES,
+    BENCH_BURST_THRESHOLD,
+    BENCH_BURST_THRESHOLD_WAKES,
+    BENCH_TICK_ISR,
+    BENCH_TICK_ISR_BUDGET,
+    BENCH_TICK_ISR_WRAP,
+    BENCH_CRITICAL,
+    BENCH_CRITICAL_IRQ,
+    BENCH_GIE_OFF_IRQ,
+    BENCH_SEM_GIVE_TAKE,
+    BENCH_NOTIFY_SEM_GIVE_TAKE,
+    BENCH_SEM_WAKE,
+    BENCH_NOTIFY_SEM_WAKE,
+    BENCH_MUTEX_LOCK,
+    BENCH_CEILING_LOCK,
+    BENCH_MUTEX_BLOCK,
+    BENCH_CEILING_BLOCK,
+    BENCH_RWLOCK_READ_BLOCK,
+    BENCH_RWLOCK_MIX,
+    BENCH_MUTEX_MIX,
+    BENCH_RING_ISR_BURST,
+    BENCH_QUEUE_ISR_BURST,
+    BENCH_RING_ISR_TO_TASK,
+    BENCH_QUEUE_ISR_TO_TASK,
+    BENCH_EVENT_DIRECT,
+    BENCH_EVENT_DEFERRED,
+    BENCH_MAILBOX_WRITE_READ,
+    BENCH_QUEUE_MAILBOX_WRITE_READ,
+    BENCH_MAILBOX_WAKE,
+    BENCH_QUEUE_MAILBOX_WAKE,
+    BENCH_WORK_IRQ_TO_FUNCTION,
+    BENCH_IRQ_TASK_RAM,
+    BENCH_WORK_CLASS_RAM,
+    BENCH_CYCLIC_JITTER,
+    BENCH_DELAY_JITTER,
+    BENCH_COUNT
+}bench_id_t;
+
+typedef struct{
+    const char         *pcName;
+    const char         *pcUnit;
+    volatile uint16_t   usSamples;
+    uint32_t            ulMin;
+    uint32_t            ulMax;
+    uint32_t            ulSum;
+}bench_result_t;
+
+#define mainRESULT( pcName, pcUnit )        { ( pcName ), ( pcUnit ), 0, 0, 0, 0 }
+
+static bench_result_t pxResults[ BENCH_COUNT ] = {
+    mainRESULT( "timer_read",                 mainTIME_UNIT ),
+    mainRESULT( "task_switch",                mainTIME_UNIT ),
+    mainRESULT( "task_switch_full",           mainTIME_UNIT ),
+    mainRESULT( "tick_preempt",               mainTIME_UNIT ),
+    mainRESULT( "sem_shuffle",                mainTIME_UNIT ),
+    mainRESULT( "message",                    mainTIME_UNIT ),
+    mainRESULT( "irq_entry",                  mainTIME_UNIT ),
+    mainRESULT( "irq_to_task",                mainTIME_UNIT ),
+    mainRESULT( "mutex_break",                mainTIME_UNIT ),
+    mainRESULT( "tick_read",                  mainTIME_UNIT ),
+    mainRESULT( "tick32_read",                mainTIME_UNIT ),
+    mainRESULT( "delay_wake",                 mainTIME_UNIT ),
+    mainRESULT( "delay_long_wake",            mainTIME_UNIT ),
+    mainRESULT( "hrtimer_delay_late",         mainTIME_UNIT ),
+    mainRESULT( "queue_burst",                mainTIME_UNIT ),
+    mainRESULT( "queue_burst_wakes",          "wakes" ),
+    mainRESULT( "queue_burst_threshold",      mainTIME_UNIT ),
+    mainRESULT( "queue_burst_threshold_wakes","wakes" ),
+    mainRESULT( "tick_isr",                   mainTIME_UNIT ),
+    mainRESULT( "tick_isr_budget",            mainTIME_UNIT ),
+    mainRESULT( "tick_isr_wrap",              mainTIME_UNIT ),
+    mainRESULT( "critical_enter_exit",        mainTIME_UNIT ),
+    mainRESULT( "critical_irq",               mainTIME_UNIT ),
+    mainRESULT( "gie_off_irq",                mainTIME_UNIT ),
+    mainRESULT( "sem_give_take",              mainTIME_UNIT ),
+    mainRESULT( "notify_sem_give_take",       mainTIME_UNIT ),
+    mainRESULT( "sem_wake",                   mainTIME_UNIT ),
+    mainRESULT( "notify_sem_wake",            mainTIME_UNIT ),
+    mainRESULT( "mutex_lock_unlock",          mainTIME_UNIT ),
+    mainRESULT( "ceiling_lock_unlock",        mainTIME_UNIT ),
+    mainRESULT( "mutex_block",                mainTIME_UNIT ),
+    mainRESULT( "ceiling_block",              mainTIME_UNIT ),
+    mainRESULT( "rwlock_read_block",          mainTIME_UNIT ),
+    mainRESULT( "rwlock_mix",                 mainTIME_UNIT ),
+    mainRESULT( "mutex_mix",                  mainTIME_UNIT ),
+    mainRESULT( "ring_isr_burst",             mainTIME_UNIT ),
+    mainRESULT( "queue_isr_burst",            mainTIME_UNIT ),
+    mainRESULT( "ring_isr_to_task",           mainTIME_UNIT ),
+    mainRESULT( "queue_isr_to_task",          mainTIME_UNIT ),
+    mainRESULT( "event_isr_direct",           mainTIME_UNIT ),
+    mainRESULT( "event_isr_deferred",         mainTIME_UNIT ),
+    mainRESULT( "mailbox_write_read",         mainTIME_UNIT ),
+    mainRESULT( "queue_mailbox_write_read",   mainTIME_UNIT ),
+    mainRESULT( "mailbox_wake",               mainTIME_UNIT ),
+    mainRESULT( "queue_mailbox_wake",         mainTIME_UNIT ),
+    mainRESULT( "work_irq_to_function",       mainTIME_UNIT ),
+    mainRESULT( "irq_task_ram",               "bytes" ),
+    mainRESULT( "work_class_ram",             "bytes" ),
+    mainRESULT( "cyclic_jitter",              mainTIME_UNIT ),
+    mainRESULT( "delay_jitter",               mainTIME_UNIT )
+};
+
+/** Peer side of a benchmark, run by "Job" task */
+typedef void ( *bench_job_t )( void );
+/** Yield used by both sides of task switch benchmark */
+typedef void ( *bench_yield_t )( void );
+
+/** Work done in TB0 CCR1 interrupt, returns pdTRUE if it woke a higher
+ *  priority task */
+typedef BaseType_t ( *bench_irq_t )( void );
+
+static void prvSetupHardware( void );
+
+/* Clock read cost, subtracted from every time sample */
+static bench_time_t             xTimerOverhead = 0;
+/* Time stamp handed from one task to another */
+static volatile bench_time_t    xStamp;
+/* Times "Burst" task was woken */
+static volatile uint16_t        usBurstWakes = 0;
+/* Result TB0 CCR0 interrupt adds its latency to */
+static volatile bench_id_t      eCriticalBench = BENCH_CRITICAL_IRQ;
+/* Clock counts in one tick */
+static bench_time_t             xTickTime;
+/* Start of last period in jitter benchmarks */
+static bench_time_t             xPeriodStart;
+static BaseType_t               xFirstPeriod;
+/* Task switch benchmark run and the yield it uses */
+static volatile bench_id_t      eSwitchBench;
+static volatile bench_yield_t   pxSwitchYield;
+/* Run by "Job" task when it is resumed */
+static volatile bench_job_t     pxJob;
+/* Run by TB0 CCR1 interrupt */
+static volatile bench_irq_t     pxIrqHandler;
+
+TaskHandle_t        xYieldPeerHandle;
+TaskHandle_t        xTickPeerHandle;
+TaskHandle_t        xShufflePeerHandle;
+TaskHandle_t        xMutexPeerHandle;
+TaskHandle_t        xJobHandle;
+/* Passed back and forth in semaphore shuffle */
+xSemaphoreHandle    xShuffleSemaphore;
+/* Given from TB0 CCR1 ISR */
+xSemaphoreHandle    xIrqSemaphore;
+/* Held by runner when mutex peer asks for it */
+xSemaphoreHandle    xMutex;
+#if( configUSE_CEILING_MUTEXES == 1 )
+/* Same with priority ceiling of "Job" task */
+xSemaphoreHandle    xCeilingMutex;
+#endif
+/* Carries send time stamp to "Message" task */
+xQueueHandle        xMessageQueue;
+/* Filled by runner in bursts, drained by "Burst" task */
+xQueueHandle        xBurstQueue;
+/* Carry time stamp from runner to "Job" task, latest value only */
+MailboxHandle_t     xMailbox;
+xQueueHandle        xMailboxQueue;
+/* Read by runner and "Job" task at the same time */
+RWLockHandle_t      xRWLock;
+/* Filled in bursts by TB0 CCR1 interrupt, drained by "Job" task */
+RingBuffer_t        xIrqRing;
+static uint8_t      pucIrqRingStorage[ ringbufferSTORAGE_SIZE( mainBURST_LENGTH, sizeof( uint8_t ) ) ];
+xQueueHandle        xIrqQueue;
+/* Bits set by TB0 CCR1 interrupt, waited for by "Job" task */
+EventGroupHandle_t  xIrqEventGroup;
+/* Given by runner, taken by "Job" task */
+xSemaphoreHandle    xWakeSemaphore;
+#if( configUSE_NOTIFY_SEMAPHORES == 1 )
+/* Same on task notification of "Job" task */
+NotifySemaphoreHandle_t xNotifySemaphore;
+#endif
+#if( configUSE_TASK_BUDGETS == 1 )
+/* Budget of runner for tick cost with budgets */
+TaskBudget_t        xRunnerBudget;
+#endif
+
+/**
+ * @brief Add sample to benchmark result
+ *
+ * Samples above mainSAMPLES are dropped, so every benchmark reports
+ * same number of samples
+ */
+static void prvBenchSample( bench_id_t eId, uint32_t ulValue )
+{
+    bench_result_t *pxResult = &pxResults[ eId ];
+
+    if( pxResult->usSamples >= mainSAMPLES ){
+        return;
+    }
+    if( ( pxResult->usSamples == 0 ) || ( ulValue < pxResult->ulMin ) ){
+        pxResult->ulMin = ulValue;
+    }
+    if( ulValue > pxResult->ulMax ){
+        pxResult->ulMax = ulValue;
+    }
+    pxResult->ulSum += ulValue;
+    pxResult->usSamples++;
+}
+
+static BaseType_t prvBenchDone( bench_id_t eId )
+{
+    return ( pxResults[ eId ].usSamples >= mainSAMPLES ) ? pdTRUE : pdFALSE;
+}
+
+/**
+ * @brief Time since xStart without cost of reading the clock
+ */
+static uint32_t prvBenchElapsed( bench_time_t xStart )
+{
+    bench_time_t xElapsed = ( bench_time_t ) ( mainNOW() - xStart );
+
+    if( xElapsed < xTimerOverhead ){
+        return 0;
+    }
+    return ( uint32_t ) ( bench_time_t ) ( xElapsed - xTimerOverhead );
+}
+
+/**
+ * @brief "Yield peer" task function
+ *
+ * Yields to runner, task switch is measured on both sides. Resumed once
+ * for every task switch benchmark, suspends itself when it is done
+ */
+static void prvYieldPeerTaskFunction( void *pvParameters )
+{
+    for ( ;; )
+    {
+        /* Switch to this task after resume isn't counted */
+        xStamp = mainNOW();
+        pxSwitchYield();
+        while( prvBenchDone( eSwitchBench ) == pdFALSE ){
+            prvBenchSample( eSwitchBench, prvBenchElapsed( xStamp ) );
+            xStamp = mainNOW();
+            pxSwitchYield();
+        }
+        vTaskSuspend( NULL );
+    }
+}
+
+/**
+ * @brief "Tick peer" task function
+ *
+ * Woken by tick while runner spins, measures tick ISR and preemption
+ */
+static void prvTickPeerTaskFunction( void *pvParameters )
+{
+    for ( ;; )
+    {
+        vTaskDelay( 1 );
+        prvBenchSample( BENCH_TICK_PREEMPT, prvBenchElapsed( xStamp ) );
+    }
+}
+
+/**
+ * @brief "Shuffle peer" task function
+ *
+ * Blocks on semaphore held by runner, measures time from give to take
+ */
+static void prvShufflePeerTaskFunction( void *pvParameters )
+{
+    for ( ;; )
+    {
+        xSemaphoreTake( xShuffleSemaphore, portMAX_DELAY );
+        prvBenchSample( BENCH_SEM_SHUFFLE, prvBenchElapsed( xStamp ) );
+        xSemaphoreGive( xShuffleSemaphore );
+        taskYIELD();
+    }
+}
+
+/**
+ * @brief "Message" task function
+ *
+ * Measures time from send to receive of message carrying send time
+ */
+static void prvMessageTaskFunction( void *pvParameters )
+{
+    bench_time_t xSent;
+
+    for ( ;; )
+    {
+        xQueueReceive( xMessageQueue, &xSent, portMAX_DELAY );
+        prvBenchSample( BENCH_MESSAGE, prvBenchElapsed( xSent ) );
+    }
+}
+
+/**
+ * @brief "Irq peer" task function
+ *
+ * Woken from TB0 CCR1 ISR, measures time from compare match to task
+ */
+static void prvIrqPeerTaskFunction( void *pvParameters )
+{
+    for ( ;; )
+    {
+        xSemaphoreTake( xIrqSemaphore, portMAX_DELAY );
+        prvBenchSample( BENCH_IRQ_TO_TASK, prvBenchElapsed( TB0CCR1 ) );
+    }
+}
+
+/**
+ * @brief "Mutex peer" task function
+ *
+ * Asks for mutex held by lower priority runner, measures time until
+ * runner inherits priority, releases mutex and this task gets it
+ */
+static void prvMutexPeerTaskFunction( void *pvParameters )
+{
+    bench_time_t xStart;
+
+    for ( ;; )
+    {
+        ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+        xStart = mainNOW();
+        xSemaphoreTake( xMutex, portMAX_DELAY );
+        prvBenchSample( BENCH_MUTEX_BREAK, prvBenchElapsed( xStart ) );
+        xSemaphoreGive( xMutex );
+    }
+}
+
+/**
+ * @brief "Burst" task function
+ *
+ * Drains burst queue, counts how many times it was woken
+ */
+static void prvBurstTaskFunction( void *pvParameters )
+{
+    uint8_t ucItem;
+
+    for ( ;; )
+    {
+        xQueueReceive( xBurstQueue, &ucItem, portMAX_DELAY );
+        usBurstWakes++;
+        while( xQueueReceive( xBurstQueue, &ucItem, 0 ) == pdPASS );
+    }
+}
+
+/**
+ * @brief "Job" task function
+ *
+ * Higher priority peer shared by benchmarks which need one only for a
+ * while. Every time it is resumed it runs peer side of one benchmark
+ * until that has all its samples. Benchmarks use its notification value
+ * one after another, each leaves it at zero
+ */
+static void prvJobTaskFunction( void *pvParameters )
+{
+    for ( ;; )
+    {
+        pxJob();
+        vTaskSuspend( NULL );
+    }
+}
+
+/* Run pxFunction in "Job" task, it preempts runner right away */
+static void prvBenchStartJob( bench_job_t pxFunction )
+{
+    pxJob = pxFunction;
+    vTaskResume( xJobHandle );
+}
+
+/* Uncontended give and take, then take woken by give from runner */
+static void prvJobSemaphore( void )
+{
+    bench_time_t xStart;
+
+    while( prvBenchDone( BENCH_SEM_GIVE_TAKE ) == pdFALSE ){
+        xStart = mainNOW();
+        xSemaphoreGive( xWakeSemaphore );
+        xSemaphoreTake( xWakeSemaphore, 0 );
+        prvBenchSample( BENCH_SEM_GIVE_TAKE, prvBenchElapsed( xStart ) );
+    }
+    while( prvBenchDone( BENCH_SEM_WAKE ) == pdFALSE ){
+        xSemaphoreTake( xWakeSemaphore, portMAX_DELAY );
+        prvBenchSample( BENCH_SEM_WAKE, prvBenchElapsed( xStamp ) );
+    }
+}
+
+#if( configUSE_NOTIFY_SEMAPHORES == 1 )
+/* Same as prvJobSemaphore, "Job" task owns the semaphore */
+static void prvJobNotifySemaphore( void )
+{
+    bench_time_t xStart;
+
+    while( prvBenchDone( BENCH_NOTIFY_SEM_GIVE_TAKE ) == pdFALSE ){
+        xStart = mainNOW();
+        xSemaphoreNotifyGive( xNotifySemaphore );
+        xSemaphoreNotifyTake( xNotifySemaphore, 0 );
+        prvBenchSample( BENCH_NOTIFY_SEM_GIVE_TAKE, prvBenchElapsed( xStart ) );
+    }
+    while( prvBenchDone( BENCH_NOTIFY_SEM_WAKE ) == pdFALSE ){
+        xSemaphoreNotifyTake( xNotifySemaphore, portMAX_DELAY );
+        prvBenchSample( BENCH_NOTIFY_SEM_WAKE, prvBenchElapsed( xStamp ) );
+    }
+}
+#endif
+
+/* Woken by runner holding xLock, samples when it gets xLock */
+static void prvJobLock( bench_id_t eId, xSemaphoreHandle xLock )
+{
+    while( prvBenchDone( eId ) == pdFALSE ){
+        ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+        xSemaphoreTake( xLock, portMAX_DELAY );
+        prvBenchSample( eId, prvBenchElapsed( xStamp ) );
+        xSemaphoreGive( xLock );
+    }
+}
+
+static void prvJobMutexBlock( void )
+{
+    prvJobLock( BENCH_MUTEX_BLOCK, xMutex );
+}
+
+#if( configUSE_CEILING_MUTEXES == 1 )
+static void prvJobCeilingBlock( void )
+{
+    prvJobLock( BENCH_CEILING_BLOCK, xCeilingMutex );
+}
+#endif
+
+/* Woken by runner holding read lock, samples when it gets read lock too */
+static void prvJobReadLock( void )
+{
+    while( prvBenchDone( BENCH_RWLOCK_READ_BLOCK ) == pdFALSE ){
+        ulTaskNotifyTake( pdTRUE, portMAX_DELAY );
+        xRWLockTakeRead( xRWLock, portMAX_DELAY );
+        prvBenchSample( BENCH_RWLOCK_READ_BLOCK, prvBenchElapsed( xStamp ) );
+        vRWLockGiveRead( xRWLock );
+    }
+}
+
+/* Time from write of a new value until it is read */
+static void prvJobMailbox( void )
+{
+    bench_time_t    xSent;
+    UBaseType_t     uxVersion = uxMailboxGetVersion( xMailbox );
+
+    while( prvBenchDone( BENCH_MAILBOX_WAKE ) == pdFALSE ){
+        xMailboxWaitForUpdate( xMailbox, &xSent, &uxVersion, portMAX_DELAY );
+        prvBenchSample( BENCH_MAILBOX_WAKE, prvBenchElapsed( xSent ) );
+    }
+}
+
+/* Same on a queue of length one */
+static void prvJobQueueMailbox( void )
+{
+    bench_time_t xSent;
+
+    while( prvBenchDone( BENCH_QUEUE_MAILBOX_WAKE ) == pdFALSE ){
+        xQueueReceive( xMailboxQueue, &xSent, portMAX_DELAY );
+        prvBenchSample( BENCH_QUEUE_MAILBOX_WAKE, prvBenchElapsed( xSent ) );
+    }
+}
+
+static void prvBenchTimerRead( void )
+{
+    bench_time_t xStart;
+
+    while( prvBenchDone( BENCH_TIMER_READ ) == pdFALSE ){
+        xStart = mainNOW();
+        prvBenchSample( BENCH_TIMER_READ, prvBenchElapsed( xStart ) );
+    }
+    xTimerOverhead = ( bench_time_t ) pxResults[ BENCH_TIMER_READ ].ulMin;
+}
+
+static void prvYield( void )
+{
+    taskYIELD();
+}
+
+/* Switches between runner and "Yield peer" with pxYield */
+static void prvBenchSwitch( bench_id_t eId, bench_yield_t pxYield )
+{
+    eSwitchBench = eId;
+    pxSwitchYield = pxYield;
+    vTaskResume( xYieldPeerHandle );
+    pxYield();
+    while( prvBenchDone( eId ) == pdFALSE ){
+        prvBenchSample( eId, prvBenchElapsed( xStamp ) );
+        xStamp = mainNOW();
+        pxYield();
+    }
+    /* Let peer see it is done and suspend itself */
+    pxYield();
+}
+
+/* Voluntary switch, saves reduced frame, and same with the full frame
+ * an interrupt saves */
+static void prvBenchTaskSwitch( void )
+{
+    prvBenchSwitch( BENCH_TASK_SWITCH, prvYield );
+    prvBenchSwitch( BENCH_TASK_SWITCH_FULL, vPortYieldFullFrame );
+}
+
+/* Switch from tick, saves full frame */
+static void prvBenchTickPreempt( void )
+{
+    vTaskResume( xTickPeerHandle );
+    while( prvBenchDone( BENCH_TICK_PREEMPT ) == pdFALSE ){
+        xStamp = mainNOW();
+    }
+    vTaskSuspend( xTickPeerHandle );
+}
+
+static void prvBenchSemaphoreShuffle( void )
+{
+    vTaskResume( xShufflePeerHandle );
+    while( prvBenchDone( BENCH_SEM_SHUFFLE ) == pdFALSE ){
+        xSemaphoreTake( xShuffleSemaphore, portMAX_DELAY );
+        /* Let peer block on semaphore */
+        taskYIELD();
+        xStamp = mainNOW();
+        xSemaphoreGive( xShuffleSemaphore );
+        taskYIELD();
+    }
+    vTaskSuspend( xShufflePeerHandle );
+}
+
+static void prvBenchMessage( void )
+{
+    bench_time_t xSent;
+
+    while( prvBenchDone( BENCH_MESSAGE ) == pdFALSE ){
+        xSent = mainNOW();
+        xQueueSendToBack( xMessageQueue, &xSent, portMAX_DELAY );
+    }
+}
+
+static BaseType_t prvIrqGiveSemaphore( void )
+{
+    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+    xSemaphoreGiveFromISR( xIrqSemaphore, &xHigherPriorityTaskWoken );
+    return xHigherPriorityTaskWoken;
+}
+
+#if( configUSE_WORK_QUEUES == 1 )
+/* Time from compare match until worker runs the function */
+static void prvWorkSample( void *pvParameter1, uint32_t ulParameter2 )
+{
+    prvBenchSample( BENCH_WORK_IRQ_TO_FUNCTION, prvBenchElapsed( TB0CCR1 ) );
+}
+
+static BaseType_t prvIrqSubmitWork( void )
+{
+    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+    xWorkQueueSubmitFromISR( mainWORK_CLASS, prvWorkSample, NULL, 0, &xHigherPriorityTaskWoken );
+    return xHigherPriorityTaskWoken;
+}
+#endif
+
+static BaseType_t prvIrqRingBurst( void )
+{
+    BaseType_t      xHigherPriorityTaskWoken = pdFALSE;
+    bench_time_t    xStart = mainNOW();
+    uint8_t         ucItem;
+
+    for( ucItem = 0; ucItem < mainBURST_LENGTH; ucItem++ ){
+        xRingBufferPushFromISR( &xIrqRing, &ucItem, &xHigherPriorityTaskWoken );
+    }
+    prvBenchSample( BENCH_RING_ISR_BURST, prvBenchElapsed( xStart ) );
+    return xHigherPriorityTaskWoken;
+}
+
+static BaseType_t prvIrqQueueBurst( void )
+{
+    BaseType_t      xHigherPriorityTaskWoken = pdFALSE;
+    bench_time_t    xStart = mainNOW();
+    uint8_t         ucItem;
+
+    for( ucItem = 0; ucItem < mainBURST_LENGTH; ucItem++ ){
+        xQueueSendToBackFromISR( xIrqQueue, &ucItem, &xHigherPriorityTaskWoken );
+    }
+    prvBenchSample( BENCH_QUEUE_ISR_BURST, prvBenchElapsed( xStart ) );
+    return xHigherPriorityTaskWoken;
+}
+
+#if( configUSE_EVENT_GROUP_DIRECT_FROM_ISR == 1 )
+/* Set bits and wake waiting task in interrupt */
+static BaseType_t prvIrqEventDirect( void )
+{
+    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+    xEventGroupSetBitsFromISR( xIrqEventGroup, mainEVENT_BIT, &xHigherPriorityTaskWoken );
+    return xHigherPriorityTaskWoken;
+}
+#endif
+
+/* Leave setting bits to timer task, as without direct setting from ISR */
+static BaseType_t prvIrqEventDeferred( void )
+{
+    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+    xTimerPendFunctionCallFromISR( vEventGroupSetBitsCallback, ( void * ) xIrqEventGroup, mainEVENT_BIT, &xHigherPriorityTaskWoken );
+    return xHigherPriorityTaskWoken;
+}
+
+/* Time from compare match until wait for event bit returns */
+static void prvJobEventWait( bench_id_t eId )
+{
+    while( prvBenchDone( eId ) == pdFALSE ){
+        xEventGroupWaitBits( xIrqEventGroup, mainEVENT_BIT, pdTRUE, pdFALSE, portMAX_DELAY );
+        prvBenchSample( eId, prvBenchElapsed( TB0CCR1 ) );
+    }
+}
+
+#if( configUSE_EVENT_GROUP_DIRECT_FROM_ISR == 1 )
+static void prvJobEventDirect( void )
+{
+    prvJobEventWait( BENCH_EVENT_DIRECT );
+}
+#endif
+
+static void prvJobEventDeferred( void )
+{
+    prvJobEventWait( BENCH_EVENT_DEFERRED );
+}
+
+/* Woken once burst is in ring, time from compare match until all of
+ * burst is taken out */
+static void prvJobRingConsumer( void )
+{
+    uint8_t ucItem;
+    uint8_t x;
+
+    while( prvBenchDone( BENCH_RING_ISR_TO_TASK ) == pdFALSE ){
+        xRingBufferReceive( &xIrqRing, &ucItem, portMAX_DELAY );
+        for( x = 1; x < mainBURST_LENGTH; x++ ){
+            xRingBufferPop( &xIrqRing, &ucItem );
+        }
+        prvBenchSample( BENCH_RING_ISR_TO_TASK, prvBenchElapsed( TB0CCR1 ) );
+    }
+}
+
+/* Same from queue, woken by first item */
+static void prvJobQueueConsumer( void )
+{
+    uint8_t ucItem;
+    uint8_t x;
+
+    while( prvBenchDone( BENCH_QUEUE_ISR_TO_TASK ) == pdFALSE ){
+        xQueueReceive( xIrqQueue, &ucItem, portMAX_DELAY );
+        for( x = 1; x < mainBURST_LENGTH; x++ ){
+            xQueueReceive( xIrqQueue, &ucItem, 0 );
+        }
+        prvBenchSample( BENCH_QUEUE_ISR_TO_TASK, prvBenchElapsed( TB0CCR1 ) );
+    }
+}
+
+/* Run pxHandler from TB0 CCR1 interrupt, spin until eId gets a sample */
+static void prvBenchIrq( bench_irq_t pxHandler, bench_id_t eId )
+{
+    uint16_t usSamples = pxResults[ eId ].usSamples;
+
+    pxIrqHandler = pxHandler;
+    TB0CCR1  = mainNOW() + mainIRQ_LEAD;
+    TB0CCTL1 = CCIE;
+    /* Spin, interrupt has to preempt running task */
+    while( pxResults[ eId ].usSamples == usSamples );
+}
+
+static void prvBenchInterrupt( void )
+{
+    while( prvBenchDone( BENCH_IRQ_TO_TASK ) == pdFALSE ){
+        prvBenchIrq( prvIrqGiveSemaphore, BENCH_IRQ_TO_TASK );
+    }
+#if( configUSE_WORK_QUEUES == 1 )
+    /* Same bottom half on shared worker instead of a task of its own */
+    while( prvBenchDone( BENCH_WORK_IRQ_TO_FUNCTION ) == pdFALSE ){
+        prvBenchIrq( prvIrqSubmitWork, BENCH_WORK_IRQ_TO_FUNCTION );
+    }
+#endif
+}
+
+/* Task woken through event group from interrupt, directly and through
+ * timer task */
+static void prvBenchIrqEvent( void )
+{
+#if( configUSE_EVENT_GROUP_DIRECT_FROM_ISR == 1 )
+    prvBenchStartJob( prvJobEventDirect );
+    while( prvBenchDone( BENCH_EVENT_DIRECT ) == pdFALSE ){
+        prvBenchIrq( prvIrqEventDirect, BENCH_EVENT_DIRECT );
+    }
+#endif
+    prvBenchStartJob( prvJobEventDeferred );
+    while( prvBenchDone( BENCH_EVENT_DEFERRED ) == pdFALSE ){
+        prvBenchIrq( prvIrqEventDeferred, BENCH_EVENT_DEFERRED );
+    }
+}
+
+/* Burst from interrupt into ring buffer and into queue */
+static void prvBenchIrqBurst( void )
+{
+    prvBenchStartJob( prvJobRingConsumer );
+    while( prvBenchDone( BENCH_RING_ISR_TO_TASK ) == pdFALSE ){
+        prvBenchIrq( prvIrqRingBurst, BENCH_RING_ISR_TO_TASK );
+    }
+    prvBenchStartJob( prvJobQueueConsumer );
+    while( prvBenchDone( BENCH_QUEUE_ISR_TO_TASK ) == pdFALSE ){
+        prvBenchIrq( prvIrqQueueBurst, BENCH_QUEUE_ISR_TO_TASK );
+    }
+}
+
+/* Semaphore on a queue against one on task notification */
+static void prvBenchNotifySemaphore( void )
+{
+    prvBenchStartJob( prvJobSemaphore );
+    while( prvBenchDone( BENCH_SEM_WAKE ) == pdFALSE ){
+        xStamp = mainNOW();
+        xSemaphoreGive( xWakeSemaphore );
+    }
+#if( configUSE_NOTIFY_SEMAPHORES == 1 )
+    prvBenchStartJob( prvJobNotifySemaphore );
+    while( prvBenchDone( BENCH_NOTIFY_SEM_WAKE ) == pdFALSE ){
+        xStamp = mainNOW();
+        xSemaphoreNotifyGive( xNotifySemaphore );
+    }
+#endif
+}
+
+static void prvBenchMutexBreak( void )
+{
+    while( prvBenchDone( BENCH_MUTEX_BREAK ) == pdFALSE ){
+        xSemaphoreTake( xMutex, portMAX_DELAY );
+        xTaskNotifyGive( xMutexPeerHandle );
+        xSemaphoreGive( xMutex );
+    }
+}
+
+static void prvBenchLock( bench_id_t eId, xSemaphoreHandle xLock )
+{
+    bench_time_t xStart;
+
+    while( prvBenchDone( eId ) == pdFALSE ){
+        xStart = mainNOW();
+        xSemaphoreTake( xLock, portMAX_DELAY );
+        xSemaphoreGive( xLock );
+        prvBenchSample( eId, prvBenchElapsed( xStart ) );
+    }
+}
+
+/* Higher priority task is woken while runner holds xLock. With priority
+ * inheritance it preempts, blocks on the lock and runner inherits its
+ * priority. With priority ceiling runner already runs at the ceiling, so
+ * the task only runs when the lock is given back */
+static void prvBenchLockBlock( bench_id_t eId, xSemaphoreHandle xLock, bench_job_t pxJobFunction )
+{
+    prvBenchStartJob( pxJobFunction );
+    while( prvBenchDone( eId ) == pdFALSE ){
+        xSemaphoreTake( xLock, portMAX_DELAY );
+        xStamp = mainNOW();
+        xTaskNotifyGive( xJobHandle );
+        xSemaphoreGive( xLock );
+    }
+}
+
+/* Reader of higher priority arrives while runner reads. Unlike with
+ * mutex_block it does not have to wait for runner */
+static void prvBenchReadBlock( void )
+{
+    prvBenchStartJob( prvJobReadLock );
+    while( prvBenchDone( BENCH_RWLOCK_READ_BLOCK ) == pdFALSE ){
+        xRWLockTakeRead( xRWLock, portMAX_DELAY );
+        xStamp = mainNOW();
+        xTaskNotifyGive( xJobHandle );
+        vRWLockGiveRead( xRWLock );
+    }
+}
+
+/* Read-heavy use of a lock, mainREADS_PER_WRITE reads and one write per
+ * sample, by reader-writer lock and by mutex */
+static void prvBenchLockMix( void )
+{
+    bench_time_t    xStart;
+    uint8_t         ucRead;
+
+    while( prvBenchDone( BENCH_RWLOCK_MIX ) == pdFALSE ){
+        xStart = mainNOW();
+        for( ucRead = 0; ucRead < mainREADS_PER_WRITE; ucRead++ ){
+            xRWLockTakeRead( xRWLock, portMAX_DELAY );
+            vRWLockGiveRead( xRWLock );
+        }
+        xRWLockTakeWrite( xRWLock, portMAX_DELAY );
+        vRWLockGiveWrite( xRWLock );
+        prvBenchSample( BENCH_RWLOCK_MIX, prvBenchElapsed( xStart ) );
+    }
+    while( prvBenchDone( BENCH_MUTEX_MIX ) == pdFALSE ){
+        xStart = mainNOW();
+        for( ucRead = 0; ucRead < mainREADS_PER_WRITE + 1; ucRead++ ){
+            xSemaphoreTake( xMutex, portMAX_DELAY );
+            xSemaphoreGive( xMutex );
+        }
+        prvBenchSample( BENCH_MUTEX_MIX, prvBenchElapsed( xStart ) );
+    }
+}
+
+/* Mailbox against length one queue used with overwrite, first write
+ * and read back, then write read by a waiting task */
+static void prvBenchMailbox( void )
+{
+    bench_time_t xStart;
+    bench_time_t xValue;
+
+    while( prvBenchDone( BENCH_MAILBOX_WRITE_READ ) == pdFALSE ){
+        xStart = mainNOW();
+        vMailboxOverwrite( xMailbox, &xStart );
+        uxMailboxPeek( xMailbox, &xValue );
+        prvBenchSample( BENCH_MAILBOX_WRITE_READ, prvBenchElapsed( xStart ) );
+    }
+    while( prvBenchDone( BENCH_QUEUE_MAILBOX_WRITE_READ ) == pdFALSE ){
+        xStart = mainNOW();
+        xQueueOverwrite( xMailboxQueue, &xStart );
+        xQueuePeek( xMailboxQueue, &xValue, 0 );
+        prvBenchSample( BENCH_QUEUE_MAILBOX_WRITE_READ, prvBenchElapsed( xStart ) );
+    }
+    /* Value left from above must not wake the task */
+    xQueueReset( xMailboxQueue );
+
+    prvBenchStartJob( prvJobMailbox );
+    while( prvBenchDone( BENCH_MAILBOX_WAKE ) == pdFALSE ){
+        xValue = mainNOW();
+        vMailboxOverwrite( xMailbox, &xValue );
+    }
+    prvBenchStartJob( prvJobQueueMailbox );
+    while( prvBenchDone( BENCH_QUEUE_MAILBOX_WAKE ) == pdFALSE ){
+        xValue = mainNOW();
+        xQueueOverwrite( xMailboxQueue, &xValue );
+    }
+}
+
+static void prvBenchTickRead( void )
+{
+    bench_time_t xStart;
+
+    while( prvBenchDone( BENCH_TICK_READ ) == pdFALSE ){
+        xStart = mainNOW();
+        ( void ) xTaskGetTickCount();
+        prvBenchSample( BENCH_TICK_READ, prvBenchElapsed( xStart ) );
+    }
+#if( configUSE_TICK_EPOCH == 1 )
+    while( prvBenchDone( BENCH_TICK32_READ ) == pdFALSE ){
+        xStart = mainNOW();
+        ( void ) ulTaskGetTickCount32();
+        prvBenchSample( BENCH_TICK32_READ, prvBenchElapsed( xStart ) );
+    }
+#endif
+}
+
+/* One tick delay from just after a tick, the time past one tick period is
+ * the cost of the delay call and of the wake up */
+static void prvBenchDelayWake( void )
+{
+    bench_time_t xStart;
+
+    while( prvBenchDone( BENCH_DELAY_WAKE ) == pdFALSE ){
+        vTaskDelay( 1 );
+        xStart = mainNOW();
+        vTaskDelay( 1 );
+        prvBenchSample( BENCH_DELAY_WAKE, prvBenchElapsed( xStart ) );
+    }
+#if( configUSE_TICK_EPOCH == 1 )
+    while( prvBenchDone( BENCH_DELAY_LONG_WAKE ) == pdFALSE ){
+        vTaskDelay( 1 );
+        xStart = mainNOW();
+        vTaskDelayLong( 1 );
+        prvBenchSample( BENCH_DELAY_LONG_WAKE, prvBenchElapsed( xStart ) );
+    }
+#endif
+}
+
+/* Sub-tick delay on TA1, sample is how much later than requested the
+ * task runs again */
+static void prvBenchHRTimerDelay( void )
+{
+    const uint32_t  ulRequested = mainHRTIMER_DELAY_US * ( mainCLOCK_HZ / 1000000UL );
+    bench_time_t    xStart;
+    uint32_t        ulElapsed;
+
+    while( prvBenchDone( BENCH_HRTIMER_DELAY_LATE ) == pdFALSE ){
+        xStart = mainNOW();
+        if( xHALHRTimerDelay( mainHRTIMER_DELAY_US ) == pdFAIL ){
+            break;
+        }
+        ulElapsed = prvBenchElapsed( xStart );
+        prvBenchSample( BENCH_HRTIMER_DELAY_LATE, ( ulElapsed > ulRequested ) ? ulElapsed - ulRequested : 0 );
+    }
+}
+
+/* Sample how far this period started from last start plus the period,
+ * then do a different amount of work than last time */
+static void prvJitterPeriod( bench_id_t eId )
+{
+    bench_time_t    xNow = mainNOW();
+    bench_time_t    xWork;
+    uint32_t        ulInterval = ( bench_time_t ) ( xNow - xPeriodStart );
+    uint32_t        ulPeriod = ( uint32_t ) xTickTime * mainJITTER_PERIOD;
+
+    if( xFirstPeriod == pdFALSE ){
+        prvBenchSample( eId, ( ulInterval > ulPeriod ) ? ulInterval - ulPeriod : ulPeriod - ulInterval );
+    }
+    xFirstPeriod = pdFALSE;
+    xPeriodStart = xNow;
+
+    xWork = ( bench_time_t ) ( ( ( uint32_t ) xTickTime * 3 / 2 ) * ( pxResults[ eId ].usSamples % mainJITTER_STEPS ) / ( mainJITTER_STEPS - 1 ) );
+    while( ( bench_time_t ) ( mainNOW() - xNow ) < xWork );
+}
+
+#if( configUSE_CYCLIC_EXECUTIVE == 1 )
+/* Only job of the executive, run at start of every minor frame */
+static void prvCyclicJob( void *pvParameter )
+{
+    prvJitterPeriod( BENCH_CYCLIC_JITTER );
+    if( prvBenchDone( BENCH_CYCLIC_JITTER ) != pdFALSE ){
+        /* Executive can't be stopped, suspend dispatcher for good */
+        vTaskSuspend( NULL );
+    }
+}
+
+static const CyclicJob_t pxCyclicJobs[] = {
+    cyclicJOB( prvCyclicJob, NULL, 1, 0 )
+};
+#endif
+
+/* Same period kept with relative delay, work done shifts next start */
+static void prvJobDelay( void )
+{
+    xFirstPeriod = pdTRUE;
+    while( prvBenchDone( BENCH_DELAY_JITTER ) == pdFALSE ){
+        prvJitterPeriod( BENCH_DELAY_JITTER );
+        vTaskDelay( mainJITTER_PERIOD );
+    }
+}
+
+/* Release jitter of periodic work, time-triggered against vTaskDelay() */
+static void prvBenchJitter( void )
+{
+    xTickTime = ( bench_time_t ) ( mainCLOCK_HZ / configTICK_RATE_HZ );
+#if( configUSE_CYCLIC_EXECUTIVE == 1 )
+    xFirstPeriod = pdTRUE;
+    if( xCyclicExecutiveStart( pxCyclicJobs, 1, mainJITTER_PERIOD, mainHIGH_TASK_PRIO ) == pdPASS ){
+        while( prvBenchDone( BENCH_CYCLIC_JITTER ) == pdFALSE );
+    }
+#endif
+    prvBenchStartJob( prvJobDelay );
+    while( prvBenchDone( BENCH_DELAY_JITTER ) == pdFALSE );
+}
+
+static void prvBenchCritical( void )
+{
+    bench_time_t xStart;
+
+    while( prvBenchDone( BENCH_CRITICAL ) == pdFALSE ){
+        xStart = mainNOW();
+        taskENTER_CRITICAL();
+        taskEXIT_CRITICAL();
+        prvBenchSample( BENCH_CRITICAL, prvBenchElapsed( xStart ) );
+    }
+}
+
+/* TB0 CCR0 matches while interrupts are held off for mainCRITICAL_HOLD
+ * cycles by a critical section, or with GIE cleared for reference. Its
+ * interrupt never calls the kernel, so with selective critical sections
+ * it is taken right away, otherwise when the critical section ends */
+static void prvBenchCriticalIrq( bench_id_t eId, BaseType_t xDisableAll )
+{
+    bench_time_t    xStart;
+    uint16_t        usSamples;
+
+    eCriticalBench = eId;
+    while( prvBenchDone( eId ) == pdFALSE ){
+        usSamples = pxResults[ eId ].usSamples;
+        if( xDisableAll != pdFALSE ){
+            portDISABLE_INTERRUPTS();
+        }
+        else{
+            taskENTER_CRITICAL();
+        }
+        xStart   = mainNOW();
+        TB0CCR0  = xStart + mainIRQ_LEAD;
+        TB0CCTL0 = CCIE;
+        while( ( bench_time_t ) ( mainNOW() - xStart ) < mainCRITICAL_HOLD );
+        if( xDisableAll != pdFALSE ){
+            portENABLE_INTERRUPTS();
+        }
+        else{
+            taskEXIT_CRITICAL();
+        }
+        while( pxResults[ eId ].usSamples == usSamples );
+    }
+}
+
+/* Burst of sends to higher priority task, with threshold raised to
+ * uxThreshold while it is sent */
+static void prvBenchBurst( bench_id_t eTime, bench_id_t eWakes, UBaseType_t uxThreshold )
+{
+    bench_time_t    xStart;
+    uint16_t        usWakes;
+    uint8_t         ucItem;
+
+    while( prvBenchDone( eTime ) == pdFALSE ){
+        usWakes = usBurstWakes;
+        xStart  = mainNOW();
+#if( configUSE_PREEMPTION_THRESHOLD == 1 )
+        if( uxThreshold != tskIDLE_PRIORITY ){
+            vTaskSetPreemptionThreshold( NULL, uxThreshold );
+        }
+#endif
+        for( ucItem = 0; ucItem < mainBURST_LENGTH; ucItem++ ){
+            xQueueSendToBack( xBurstQueue, &ucItem, portMAX_DELAY );
+        }
+#if( configUSE_PREEMPTION_THRESHOLD == 1 )
+        if( uxThreshold != tskIDLE_PRIORITY ){
+            vTaskSetPreemptionThreshold( NULL, tskIDLE_PRIORITY );
+        }
+#endif
+        prvBenchSample( eTime, prvBenchElapsed( xStart ) );
+        prvBenchSample( eWakes, ( uint16_t ) ( usBurstWakes - usWakes ) );
+    }
+}
+
+/* Spin and record gaps in clock readings, each gap is one tick interrupt */
+static void prvBenchTickISR( bench_id_t eId )
+{
+    bench_time_t xPrevious;
+    bench_time_t xNow;
+
+    xPrevious = mainNOW();
+    while( prvBenchDone( eId ) == pdFALSE ){
+        xNow = mainNOW();
+        if( ( bench_time_t ) ( xNow - xPrevious ) > mainGAP_MIN ){
+            prvBenchSample( eId, ( bench_time_t ) ( xNow - xPrevious ) );
+            /* Don't count time spent in prvBenchSample */
+            xNow = mainNOW();
+        }
+        xPrevious = xNow;
+    }
+}
+
+/* Gap in clock readings at the tick that wraps the tick count, so the
+ * kernel switches its delayed lists. Happens once, one sample is taken */
+static void prvBenchTickWrap( void )
+{
+    bench_time_t    xPrevious;
+    bench_time_t    xNow;
+    TickType_t      xTick = xTaskGetTickCount();
+
+    /* Too late, with 32 bit ticks the next wrap is weeks away */
+    if( xTick < ( TickType_t ) configINITIAL_TICK_COUNT ){
+        return;
+    }
+    xPrevious = mainNOW();
+    for( ;; ){
+        xNow = mainNOW();
+        if( ( bench_time_t ) ( xNow - xPrevious ) > mainGAP_MIN ){
+            if( xTaskGetTickCount() < xTick ){
+                prvBenchSample( BENCH_TICK_ISR_WRAP, ( bench_time_t ) ( xNow - xPrevious ) );
+                break;
+            }
+            xTick = xTaskGetTickCount();
+            /* Don't count time spent reading the tick count */
+            xNow = mainNOW();
+        }
+        xPrevious = xNow;
+    }
+}
+
+static void prvBenchPutString( const char *pcString )
+{
+    while( *pcString != '\0' ){
+        while( !( UCA1IFG & UCTXIFG ) );
+        UCA1TXBUF = *pcString++;
+    }
+}
+
+static void prvBenchPutNumber( uint32_t ulValue )
+{
+    char    pcDigits[ 11 ];
+    uint8_t ucIndex = sizeof( pcDigits ) - 1;
+
+    pcDigits[ ucIndex ] = '\0';
+    do{
+        pcDigits[ --ucIndex ] = ( char ) ( '0' + ( char ) ( ulValue % 10 ) );
+        ulValue /= 10;
+    }while( ulValue != 0 );
+    prvBenchPutString( &pcDigits[ ucIndex ] );
+}
+
+/* Print measured benchmarks as CSV */
+static void prvBenchReport( void )
+{
+    bench_result_t *pxResult;
+    uint8_t         i;
+
+    prvBenchPutString( "# clock_hz " );
+    prvBenchPutNumber( mainCLOCK_HZ );
+    prvBenchPutString( "\r\n# selective_critical_sections " );
+    prvBenchPutNumber( configUSE_SELECTIVE_CRITICAL_SECTIONS );
+    prvBenchPutString( "\r\n# tick_bits " );
+    prvBenchPutNumber( sizeof( TickType_t ) * 8 );
+    prvBenchPutString( "\r\nname,unit,samples,min,mean,max\r\n" );
+    for( i = 0; i < BENCH_COUNT; i++ ){
+        pxResult = &pxResults[ i ];
+        if( pxResult->usSamples == 0 ){
+            continue;
+        }
+        prvBenchPutString( pxResult->pcName );
+        prvBenchPutString( "," );
+        prvBenchPutString( pxResult->pcUnit );
+        prvBenchPutString( "," );
+        prvBenchPutNumber( pxResult->usSamples );
+        prvBenchPutString( "," );
+        prvBenchPutNumber( pxResult->ulMin );
+        prvBenchPutString( "," );
+        prvBenchPutNumber( pxResult->ulSum / pxResult->usSamples );
+        prvBenchPutString( "," );
+        prvBenchPutNumber( pxResult->ulMax );
+        prvBenchPutString( "\r\n" );
+    }
+}
+
+/**
+ * @brief "Runner" task function
+ *
+ * Runs all benchmarks once and prints results
+ */
+static void prvRunnerTaskFunction( void *pvParameters )
+{
+    prvBenchTimerRead();
+    /* Runs first, before the tick count wraps */
+    prvBenchTickWrap();
+    prvBenchTaskSwitch();
+    prvBenchTickPreempt();
+    prvBenchSemaphoreShuffle();
+    prvBenchMessage();
+    prvBenchInterrupt();
+    prvBenchMutexBreak();
+    prvBenchNotifySemaphore();
+    prvBenchLock( BENCH_MUTEX_LOCK, xMutex );
+    prvBenchLockBlock( BENCH_MUTEX_BLOCK, xMutex, prvJobMutexBlock );
+#if( configUSE_CEILING_MUTEXES == 1 )
+    prvBenchLock( BENCH_CEILING_LOCK, xCeilingMutex );
+    prvBenchLockBlock( BENCH_CEILING_BLOCK, xCeilingMutex, prvJobCeilingBlock );
+#endif
+    prvBenchReadBlock();
+    prvBenchLockMix();
+    prvBenchMailbox();
+    prvBenchIrqBurst();
+    prvBenchIrqEvent();
+    prvBenchTickRead();
+    prvBenchDelayWake();
+    prvBenchHRTimerDelay();
+    prvBenchJitter();
+    prvBenchBurst( BENCH_BURST, BENCH_BURST_WAKES, tskIDLE_PRIORITY );
+#if( configUSE_PREEMPTION_THRESHOLD == 1 )
+    prvBenchBurst( BENCH_BURST_THRESHOLD, BENCH_BURST_THRESHOLD_WAKES, mainHIGH_TASK_PRIO );
+#endif
+    prvBenchCritical();
+    prvBenchCriticalIrq( BENCH_CRITICAL_IRQ, pdFALSE );
+    prvBenchCriticalIrq( BENCH_GIE_OFF_IRQ, pdTRUE );
+    prvBenchTickISR( BENCH_TICK_ISR );
+#if( configUSE_TASK_BUDGETS == 1 )
+    /* Budget can't be removed, so this runs last */
+    vTaskSetBudget( NULL, &xRunnerBudget, mainRUNNER_BUDGET_TICKS, mainRUNNER_BUDGET_TICKS );
+    prvBenchTickISR( BENCH_TICK_ISR_BUDGET );
+#endif
+
+    prvBenchReport();
+    halSET_LED( LED3 );
+    vTaskSuspend( NULL );
+}
+
+/**
+ * @brief main function
+ */
+void main( void )
+{
+    size_t xFreeHeap;
+
+    /* Configure peripherals */
+    prvSetupHardware();
+
+    /* Create FreeRTOS objects  */
+    xShuffleSemaphore   =   xSemaphoreCreateBinary();
+    xSemaphoreGive( xShuffleSemaphore );
+    xMutex              =   xSemaphoreCreateMutex();
+#if( configUSE_CEILING_MUTEXES == 1 )
+    xCeilingMutex       =   xSemaphoreCreateMutexCeiling( mainHIGH_TASK_PRIO );
+#endif
+    xMessageQueue       =   xQueueCreate( 1, sizeof( bench_time_t ) );
+    xBurstQueue         =   xQueueCreate( mainBURST_LENGTH, sizeof( uint8_t ) );
+    xWakeSemaphore      =   xSemaphoreCreateBinary();
+    xRWLock             =   xRWLockCreate();
+    xMailbox            =   xMailboxCreate( sizeof( bench_time_t ) );
+    xMailboxQueue       =   xQueueCreate( 1, sizeof( bench_time_t ) );
+    xIrqQueue           =   xQueueCreate( mainBURST_LENGTH, sizeof( uint8_t ) );
+    vRingBufferInit( &xIrqRing, pucIrqRingStorage, mainBURST_LENGTH, sizeof( uint8_t ) );
+    xIrqEventGroup      =   xEventGroupCreate();
+    /* Starts TA1 for hrtimer_delay_late */
+    xHALHRTimerInit();
+#if( configUSE_NOTIFY_SEMAPHORES == 1 )
+    xNotifySemaphore    =   xSemaphoreCreateBinaryNotify();
+#endif
+
+    /* Create tasks */
+    xTaskCreate( prvRunnerTaskFunction,
+                 "Runner",
+                 2 * configMINIMAL_STACK_SIZE,
+                 NULL,
+                 mainRUNNER_TASK_PRIO,
+                 NULL
+               );
+    /* Peers which switch with runner wait suspended for their benchmark */
+    xTaskCreate( prvYieldPeerTaskFunction,
+                 "Yield",
+                 configMINIMAL_STACK_SIZE,
+                 NULL,
+                 mainPEER_TASK_PRIO,
+                 &xYieldPeerHandle
+               );
+    vTaskSuspend( xYieldPeerHandle );
+    xTaskCreate( prvShufflePeerTaskFunction,
+                 "Shuffle",
+                 configMINIMAL_STACK_SIZE,
+                 NULL,
+                 mainPEER_TASK_PRIO,
+                 &xShufflePeerHandle
+               );
+    vTaskSuspend( xShufflePeerHandle );
+    xTaskCreate( prvTickPeerTaskFunction,
+                 "Tick",
+                 configMINIMAL_STACK_SIZE,
+                 NULL,
+                 mainHIGH_TASK_PRIO,
+                 &xTickPeerHandle
+               );
+    vTaskSuspend( xTickPeerHandle );
+    xTaskCreate( prvJobTaskFunction,
+                 "Job",
+                 configMINIMAL_STACK_SIZE,
+                 NULL,
+                 mainHIGH_TASK_PRIO,
+                 &xJobHandle
+               );
+    vTaskSuspend( xJobHandle );
+    /* Whole burst wakes "Job" task once */
+    vRingBufferSetConsumerTask( &xIrqRing, xJobHandle, mainBURST_LENGTH );
+    /* Higher priority peers block on their objects before runner starts */
+    xTaskCreate( prvMessageTaskFunction,
+                 "Message",
+                 configMINIMAL_STACK_SIZE,
+                 NULL,
+                 mainHIGH_TASK_PRIO,
+                 NULL
+               );
+    /* Heap taken by an interrupt bottom half as a task of its own and as
+     * a work queue class, shared by any number of bottom halves */
+    xFreeHeap = xPortGetFreeHeapSize();
+    xIrqSemaphore       =   xSemaphoreCreateBinary();
+    xTaskCreate( prvIrqPeerTaskFunction,
+                 "Irq",
+                 configMINIMAL_STACK_SIZE,
+                 NULL,
+                 mainHIGH_TASK_PRIO,
+                 NULL
+               );
+    prvBenchSample( BENCH_IRQ_TASK_RAM, xFreeHeap - xPortGetFreeHeapSize() );
+#if( configUSE_WORK_QUEUES == 1 )
+    xFreeHeap = xPortGetFreeHeapSize();
+    xWorkQueueCreateClass( mainWORK_CLASS, mainHIGH_TASK_PRIO, 1 );
+    prvBenchSample( BENCH_WORK_CLASS_RAM, xFreeHeap - xPortGetFreeHeapSize() );
+#endif
+    xTaskCreate( prvMutexPeerTaskFunction,
+                 "Mutex",
+                 configMINIMAL_STACK_SIZE,
+                 NULL,
+                 mainHIGH_TASK_PRIO,
+                 &xMutexPeerHandle
+               );
+    xTaskCreate( prvBurstTaskFunction,
+                 "Burst",
+                 configMINIMAL_STACK_SIZE,
+                 NULL,
+                 mainHIGH_TASK_PRIO,
+                 NULL
+               );
+
+    /* Start the scheduler. */
+    vTaskStartScheduler();
+
+    /* If all is well then this line will never be reached.  If it is reached
+    then it is likely that there was insufficient (FreeRTOS) heap memory space
+    to create the idle task.  This may have been trapped by the malloc() failed
+    hook function, if one is configured. */
+    for( ;; );
+}
+
+/**
+ * @brief Configure hardware upon boot
+ */
+static void prvSetupHardware( void )
+{
+    taskDISABLE_INTERRUPTS();
+
+    /* Disable the watchdog. */
+    WDTCTL = WDTPW + WDTHOLD;
+
+    hal430SetSystemClock( configCPU_CLOCK_HZ, configLFXT_CLOCK_HZ );
+
+    /* Start cycle counter */
+    vHALCyclesInit();
+
+    /* Initialize UART, results are only sent so RX interrupt is not used */
+    vHALUARTInit( 9600 );
+    UCA1IE &= ~UCRXIE;
+
+    /* initialize LEDs */
+    vHALInitLED();
+
+    /*enable global interrupts*/
+    taskENABLE_INTERRUPTS();
+}
+
+// Run interrupt side of a benchmark on TB0 CCR1 compare
+void __attribute__ ( ( interrupt( TIMER0_B1_VECTOR ) ) ) vBenchTimerISR( void )
+{
+    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+    /* TB0IV is 2 for CCR1, reading it clears the flag */
+    if( TB0IV == 2 ){
+        /* Only first mainSAMPLES count, they are taken by irq_to_task */
+        prvBenchSample( BENCH_IRQ_ENTRY, prvBenchElapsed( TB0CCR1 ) );
+        TB0CCTL1 = 0;
+        xHigherPriorityTaskWoken = pxIrqHandler();
+    }
+    /* trigger scheduler if higher priority task is woken */
+    portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
+}
+
+// Record how late TB0 CCR0 interrupt ran, must not call the kernel
+void __attribute__ ( ( interrupt( TIMER0_B0_VECTOR ) ) ) vBenchCriticalISR( void )
+{
+    /* CCR0 has its own vector, flag is cleared on entry */
+    prvBenchSample( eCriticalBench, prvBenchElapsed( TB0CCR0 ) );
+    TB0CCTL0 = 0;
+}
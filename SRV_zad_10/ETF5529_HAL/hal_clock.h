@@ -0,0 +1,34 @@
+/**
+ * @file    hal_clock.h
+ * @date    2021
+ * @brief   CLOCK MANAGER API
+ *
+ * Run-time MCLK/SMCLK scaling. VCore and DCO are changed in safe order
+ * and registered drivers are told the new frequency so they can
+ * recompute their dividers. SMCLK always runs at MCLK frequency.
+ */
+
+#include <stdint.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#ifndef HAL_CLOCK_H_
+#define HAL_CLOCK_H_
+
+/*Maximal number of drivers which can be notified about frequency change*/
+#ifndef HAL_CLOCK_MAX_LISTENERS
+#define HAL_CLOCK_MAX_LISTENERS         4
+#endif
+/*Highest MCLK frequency supported by MSP430F5529*/
+#define HAL_CLOCK_MAX_HZ                25000000UL
+
+/*Called with scheduler suspended after frequency is changed, must not block*/
+typedef void ( *hal_clock_listener_t )( uint32_t ulSMCLKHz, void *pvParameter );
+
+/*Register driver which depends on SMCLK frequency*/
+BaseType_t  xHALClockRegisterListener( hal_clock_listener_t pxListener, void *pvParameter );
+/*Change MCLK and SMCLK frequency, must be called from task*/
+BaseType_t  xHALClockSetFrequency( uint32_t ulFrequencyHz );
+/*Get current MCLK and SMCLK frequency*/
+uint32_t    ulHALClockGetFrequency( void );
+
+#endif /* HAL_CLOCK_H_ */
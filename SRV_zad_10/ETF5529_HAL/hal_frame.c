@@ -0,0 +1,220 @@
+/**
+ * @file    hal_frame.c
+ * @date    2021
+ * @brief   UART FRAME PROTOCOL API
+ *
+ * RX ISR only stores encoded bytes into free buffer and, on delimiter,
+ * pushes buffer index to frame task. Frame task decodes COBS, checks
+ * CRC, calls handler and returns buffer to the ISR. Buffer indices are
+ * passed through two lock-free rings, so neither side disables
+ * interrupts and the ISR never walks a kernel event list.
+ *
+ * With byte timeout set, first byte of a frame starts a hal_hrtimer
+ * timeout. Each expiry checks whether bytes arrived since it was armed,
+ * and either arms again or drops the partial frame, so a frame cut off
+ * by sender reset doesn't swallow the next one. Both ISRs run with GIE
+ * cleared, so they share the receive state without locking.
+ */
+
+#include <string.h>
+#include "hal_frame.h"
+#include "hal_hrtimer.h"
+#include "ringbuffer.h"
+
+#define halFRAME_NO_BUFFER          0xFF
+
+static uint8_t                      pucRxBuffers[ HAL_FRAME_RX_BUFFERS ][ HAL_FRAME_MAX_ENCODED ];
+static uint8_t                      pucRxLength[ HAL_FRAME_RX_BUFFERS ];
+/* Indices of buffers ISR can fill, and of filled buffers waiting for task */
+static uint8_t                      pucFreeStorage[ ringbufferSTORAGE_SIZE( HAL_FRAME_RX_BUFFERS, 1 ) ];
+static uint8_t                      pucReadyStorage[ ringbufferSTORAGE_SIZE( HAL_FRAME_RX_BUFFERS, 1 ) ];
+static RingBuffer_t                 xFreeRing;
+static RingBuffer_t                 xReadyRing;
+/* Buffer ISR is currently filling */
+static uint8_t                      ucRxBuffer = halFRAME_NO_BUFFER;
+static uint8_t                      ucRxCount = 0;
+static uint8_t                      ucRxDropping = 0;
+static hal_frame_handler_t          pxHandlers[ HAL_FRAME_MAX_TYPES ];
+static hal_frame_stats_t            xStats;
+static TaskHandle_t                 xFrameTask = NULL;
+/* Byte timeout, 0 while disabled */
+static volatile uint32_t            ulByteTimeoutUs = 0;
+static uint8_t                      ucRxTimerArmed = 0;
+static uint8_t                      ucRxActivity = 0;
+
+/* Take free buffer, called from RX ISR */
+static uint8_t prvFrameTakeBuffer( void )
+{
+    uint8_t ucBuffer;
+
+    if( xRingBufferPop( &xFreeRing, &ucBuffer ) == pdFAIL ){
+        return halFRAME_NO_BUFFER;
+    }
+    return ucBuffer;
+}
+
+static void prvFrameByteTimeout( void *pvParameter, BaseType_t *pxHigherPriorityTaskWoken );
+
+/* Arm byte timeout, called from RX ISR or timeout callback. Frame goes
+ * without timeout if all channels are busy */
+static void prvFrameArmTimeout( void )
+{
+    ucRxActivity = 0;
+    if( xHALHRTimerStartFromISR( ulByteTimeoutUs, prvFrameByteTimeout, NULL ) != HAL_HRTIMER_NO_CHANNEL ){
+        ucRxTimerArmed = 1;
+    }
+}
+
+/* Called from TA1 ISR */
+static void prvFrameByteTimeout( void *pvParameter, BaseType_t *pxHigherPriorityTaskWoken )
+{
+    ( void ) pvParameter;
+    ( void ) pxHigherPriorityTaskWoken;
+
+    ucRxTimerArmed = 0;
+    if( ucRxActivity != 0 ){
+        prvFrameArmTimeout();
+        return;
+    }
+    if( ( ucRxCount != 0 ) && ( ucRxDropping == 0 ) ){
+        xStats.ulTimeouts++;
+    }
+    /* Line is quiet, next byte starts a new frame in the same buffer */
+    ucRxCount       = 0;
+    ucRxDropping    = 0;
+}
+
+static void prvFrameDispatch( uint8_t *pucFrame, uint8_t ucEncodedLength )
+{
+    uint16_t    usLength;
+    uint16_t    usCRC;
+
+    /* Decoding is done in place, decoded frame is never longer than encoded */
+    usLength = usHALCOBSDecode( pucFrame, ucEncodedLength, pucFrame );
+    if( usLength < 3 ){
+        xStats.ulCRCErrors++;
+        return;
+    }
+    usCRC = ( ( uint16_t ) pucFrame[ usLength - 2 ] << 8 ) | pucFrame[ usLength - 1 ];
+    if( usHALCRC16( pucFrame, usLength - 2 ) != usCRC ){
+        xStats.ulCRCErrors++;
+        return;
+    }
+    if( ( pucFrame[ 0 ] >= HAL_FRAME_MAX_TYPES ) || ( pxHandlers[ pucFrame[ 0 ] ] == NULL ) ){
+        xStats.ulUnknownType++;
+        return;
+    }
+    xStats.ulFrames++;
+    pxHandlers[ pucFrame[ 0 ] ]( &pucFrame[ 1 ], ( uint8_t ) ( usLength - 3 ) );
+}
+
+static void prvFrameTaskFunction( void *pvParameters )
+{
+    uint8_t ucBuffer;
+
+    /* Wake on every frame, frames pushed before this call wait in the ring */
+    vRingBufferSetConsumerTask( &xReadyRing, xTaskGetCurrentTaskHandle(), 1 );
+
+    for( ;; ){
+        xRingBufferReceive( &xReadyRing, &ucBuffer, portMAX_DELAY );
+        prvFrameDispatch( pucRxBuffers[ ucBuffer ], pucRxLength[ ucBuffer ] );
+
+        /* Give buffer back to ISR, there is always room for it */
+        xRingBufferPush( &xFreeRing, &ucBuffer );
+    }
+}
+
+BaseType_t xHALFrameInit( UBaseType_t uxPriority ){
+    uint8_t i;
+
+    vRingBufferInit( &xFreeRing, pucFreeStorage, HAL_FRAME_RX_BUFFERS, 1 );
+    vRingBufferInit( &xReadyRing, pucReadyStorage, HAL_FRAME_RX_BUFFERS, 1 );
+    for( i = 0; i < HAL_FRAME_RX_BUFFERS; i++ ){
+        xRingBufferPush( &xFreeRing, &i );
+    }
+    return xTaskCreate( prvFrameTaskFunction,
+                        "Frame Task",
+                        configMINIMAL_STACK_SIZE,
+                        NULL,
+                        uxPriority,
+                        &xFrameTask );
+}
+
+TaskHandle_t xHALFrameGetTaskHandle( void ){
+    return xFrameTask;
+}
+
+void vHALFrameSetByteTimeout( uint32_t ulMicroseconds ){
+    ulByteTimeoutUs = ulMicroseconds;
+}
+
+BaseType_t xHALFrameRegisterHandler( uint8_t ucType, hal_frame_handler_t pxHandler ){
+    if( ucType >= HAL_FRAME_MAX_TYPES ){
+        return pdFAIL;
+    }
+    pxHandlers[ ucType ] = pxHandler;
+    return pdPASS;
+}
+
+void vHALFrameReceiveFromISR( uint8_t ucByte, BaseType_t *pxHigherPriorityTaskWoken ){
+    if( ucByte == HAL_FRAME_DELIMITER ){
+        if( ( ucRxBuffer != halFRAME_NO_BUFFER ) && ( ucRxDropping == 0 ) && ( ucRxCount > 0 ) ){
+            /* Whole frame received, hand it over to frame task */
+            pucRxLength[ ucRxBuffer ] = ucRxCount;
+            xRingBufferPushFromISR( &xReadyRing, &ucRxBuffer, pxHigherPriorityTaskWoken );
+            ucRxBuffer = halFRAME_NO_BUFFER;
+        }
+        ucRxCount       = 0;
+        ucRxDropping    = 0;
+        return;
+    }
+
+    if( ulByteTimeoutUs != 0 ){
+        if( ucRxTimerArmed == 0 ){
+            prvFrameArmTimeout();
+        }
+        else{
+            ucRxActivity = 1;
+        }
+    }
+    if( ucRxDropping != 0 ){
+        return;
+    }
+    if( ucRxBuffer == halFRAME_NO_BUFFER ){
+        /* First byte of new frame */
+        ucRxBuffer = prvFrameTakeBuffer();
+    }
+    if( ( ucRxBuffer == halFRAME_NO_BUFFER ) || ( ucRxCount >= HAL_FRAME_MAX_ENCODED - 1 ) ){
+        /* Frame can't be stored, skip everything up to next delimiter */
+        xStats.ulOverruns++;
+        ucRxDropping = 1;
+        return;
+    }
+    pucRxBuffers[ ucRxBuffer ][ ucRxCount++ ] = ucByte;
+}
+
+uint16_t usHALFrameEncode( uint8_t ucType, const uint8_t *pucPayload, uint8_t ucLength, uint8_t *pucOut ){
+    uint8_t     pucFrame[ HAL_FRAME_MAX_DECODED ];
+    uint16_t    usCRC;
+    uint16_t    usLength;
+
+    if( ucLength > HAL_FRAME_MAX_PAYLOAD ){
+        return 0;
+    }
+    pucFrame[ 0 ] = ucType;
+    memcpy( &pucFrame[ 1 ], pucPayload, ucLength );
+    usCRC = usHALCRC16( pucFrame, ucLength + 1 );
+    pucFrame[ ucLength + 1 ] = ( uint8_t ) ( usCRC >> 8 );
+    pucFrame[ ucLength + 2 ] = ( uint8_t ) usCRC;
+
+    usLength = usHALCOBSEncode( pucFrame, ucLength + 3, pucOut );
+    pucOut[ usLength++ ] = HAL_FRAME_DELIMITER;
+
+    return usLength;
+}
+
+void vHALFrameGetStats( hal_frame_stats_t *pxStats ){
+    taskENTER_CRITICAL();
+    *pxStats = xStats;
+    taskEXIT_CRITICAL();
+}
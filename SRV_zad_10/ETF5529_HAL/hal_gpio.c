@@ -0,0 +1,131 @@
+/**
+ * @file    hal_gpio.c
+ * @date    2021
+ * @brief   GPIO INTERRUPT API
+ *
+ * Reading PxIV returns the highest priority pending pin and clears only
+ * its PxIFG bit. ISRs keep reading it until it returns 0, so every pin
+ * pending on entry, or set while handlers run, is serviced in one pass.
+ * PxIE is changed through the port because critical sections may mask
+ * it while they run.
+ */
+
+#include "hal_gpio.h"
+#include "hal_latency.h"
+#include "semphr.h"
+#include "msp430.h"
+
+typedef struct{
+    hal_gpio_handler_t  pxHandler;
+    void               *pvParameter;
+}hal_gpio_entry_t;
+
+static hal_gpio_entry_t pxPort1Handlers[ HAL_GPIO_PINS_PER_PORT ];
+static hal_gpio_entry_t pxPort2Handlers[ HAL_GPIO_PINS_PER_PORT ];
+
+BaseType_t xHALGPIORegisterHandler( hal_gpio_port_t ePort, uint8_t ucPin, hal_gpio_edge_t eEdge,
+                                    hal_gpio_handler_t pxHandler, void *pvParameter ){
+    const uint8_t ucMask = ( uint8_t ) ( 1 << ucPin );
+
+    if( ( ucPin >= HAL_GPIO_PINS_PER_PORT ) || ( pxHandler == NULL ) ){
+        return pdFAIL;
+    }
+
+    taskENTER_CRITICAL();
+    {
+        if( ePort == HAL_GPIO_PORT_1 ){
+            vPortModifyKernelIE( portKERNEL_IE_P1, ucMask, 0 );
+            pxPort1Handlers[ ucPin ].pxHandler   = pxHandler;
+            pxPort1Handlers[ ucPin ].pvParameter = pvParameter;
+            if( eEdge == HAL_GPIO_EDGE_FALLING ){
+                P1IES |= ucMask;
+            }
+            else{
+                P1IES &= ~ucMask;
+            }
+            /*Changing PxIES can set PxIFG, clear it before enabling*/
+            P1IFG &= ~ucMask;
+            vPortModifyKernelIE( portKERNEL_IE_P1, 0, ucMask );
+        }
+        else{
+            vPortModifyKernelIE( portKERNEL_IE_P2, ucMask, 0 );
+            pxPort2Handlers[ ucPin ].pxHandler   = pxHandler;
+            pxPort2Handlers[ ucPin ].pvParameter = pvParameter;
+            if( eEdge == HAL_GPIO_EDGE_FALLING ){
+                P2IES |= ucMask;
+            }
+            else{
+                P2IES &= ~ucMask;
+            }
+            P2IFG &= ~ucMask;
+            vPortModifyKernelIE( portKERNEL_IE_P2, 0, ucMask );
+        }
+    }
+    taskEXIT_CRITICAL();
+
+    return pdPASS;
+}
+
+void vHALGPIOUnregisterHandler( hal_gpio_port_t ePort, uint8_t ucPin ){
+    const uint8_t ucMask = ( uint8_t ) ( 1 << ucPin );
+
+    if( ucPin >= HAL_GPIO_PINS_PER_PORT ){
+        return;
+    }
+
+    taskENTER_CRITICAL();
+    {
+        if( ePort == HAL_GPIO_PORT_1 ){
+            vPortModifyKernelIE( portKERNEL_IE_P1, ucMask, 0 );
+            pxPort1Handlers[ ucPin ].pxHandler = NULL;
+        }
+        else{
+            vPortModifyKernelIE( portKERNEL_IE_P2, ucMask, 0 );
+            pxPort2Handlers[ ucPin ].pxHandler = NULL;
+        }
+    }
+    taskEXIT_CRITICAL();
+}
+
+void vHALGPIONotifyGiveHandler( void *pvParameter, BaseType_t *pxHigherPriorityTaskWoken ){
+    vTaskNotifyGiveFromISR( ( TaskHandle_t ) pvParameter, pxHigherPriorityTaskWoken );
+}
+
+void vHALGPIOSemaphoreGiveHandler( void *pvParameter, BaseType_t *pxHigherPriorityTaskWoken ){
+    xSemaphoreGiveFromISR( ( SemaphoreHandle_t ) pvParameter, pxHigherPriorityTaskWoken );
+}
+
+void __attribute__ ( ( interrupt( PORT1_VECTOR  ) ) ) vPORT1ISR( void )
+{
+    BaseType_t          xHigherPriorityTaskWoken = pdFALSE;
+    hal_gpio_entry_t   *pxEntry;
+    uint16_t            usVector;
+
+    HAL_LATENCY_ISR_ENTRY();
+    /*P1IV is 2 for P1.0 up to 16 for P1.7, reading it clears that flag only*/
+    while( ( usVector = P1IV ) != 0 ){
+        pxEntry = &pxPort1Handlers[ ( usVector >> 1 ) - 1 ];
+        if( pxEntry->pxHandler != NULL ){
+            pxEntry->pxHandler( pxEntry->pvParameter, &xHigherPriorityTaskWoken );
+        }
+    }
+    /* trigger scheduler if higher priority task is woken */
+    portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
+}
+
+void __attribute__ ( ( interrupt( PORT2_VECTOR  ) ) ) vPORT2ISR( void )
+{
+    BaseType_t          xHigherPriorityTaskWoken = pdFALSE;
+    hal_gpio_entry_t   *pxEntry;
+    uint16_t            usVector;
+
+    HAL_LATENCY_ISR_ENTRY();
+    while( ( usVector = P2IV ) != 0 ){
+        pxEntry = &pxPort2Handlers[ ( usVector >> 1 ) - 1 ];
+        if( pxEntry->pxHandler != NULL ){
+            pxEntry->pxHandler( pxEntry->pvParameter, &xHigherPriorityTaskWoken );
+        }
+    }
+    /* trigger scheduler if higher priority task is woken */
+    portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
+}
@@ -0,0 +1,120 @@
+/**
+ * @file    hal_latency.c
+ * @date    2021
+ * @brief   INTERRUPT TO TASK LATENCY PROBE
+ *
+ * MSP430 ISRs do not nest, so TB0CCR6 holds entry stamp of the running
+ * ISR until next one is entered. A mark copies it to the pair, the task
+ * side takes it out and adds the difference to statistics. Event which
+ * arrives while its task is busy is counted when the task gets to the
+ * take, so tail of histogram also shows task falling behind. Latencies
+ * longer than 65535 cycles wrap, same as all HAL_CYCLES differences.
+ * The stamp is taken after the compiler prologue of the ISR, which is
+ * not counted, see HAL_LATENCY_ISR_ENTRY.
+ */
+
+#include "hal_latency.h"
+#include "msp430.h"
+
+#if( configUSE_LATENCY_PROBE == 1 )
+
+typedef struct{
+    volatile uint8_t    ucPending;
+    volatile uint16_t   usStamp;
+    hal_latency_stats_t xStats;
+}hal_latency_pair_t;
+
+static hal_latency_pair_t   pxPairs[ HAL_LATENCY_MAX_PAIRS ];
+
+static void prvResetStats( hal_latency_stats_t *pxStats )
+{
+    uint8_t x;
+
+    pxStats->usCount = 0;
+    pxStats->usMin = 0xFFFF;
+    pxStats->usMean = 0;
+    pxStats->usMax = 0;
+    pxStats->ulSum = 0;
+    for( x = 0; x < HAL_LATENCY_BINS; x++ ){
+        pxStats->pusHistogram[ x ] = 0;
+    }
+}
+
+void vHALLatencyInit( void ){
+    uint8_t x;
+
+    for( x = 0; x < HAL_LATENCY_MAX_PAIRS; x++ ){
+        pxPairs[ x ].ucPending = 0;
+        prvResetStats( &pxPairs[ x ].xStats );
+    }
+    vHALCyclesInit();
+    /*Capture on both edges of software driven input, synchronized to TB0 clock*/
+    TB0CCTL6 = CM_3 + CCIS_2 + SCS + CAP;
+}
+
+void vHALLatencyISRMark( uint8_t ucPair ){
+    configASSERT( ucPair < HAL_LATENCY_MAX_PAIRS );
+
+    if( pxPairs[ ucPair ].ucPending == 0 ){
+        pxPairs[ ucPair ].usStamp = TB0CCR6;
+        pxPairs[ ucPair ].ucPending = 1;
+    }
+}
+
+void vHALLatencyTaskResumed( uint8_t ucPair, uint16_t usNow ){
+    hal_latency_stats_t *pxStats;
+    uint16_t            usLatency;
+    uint16_t            usBin;
+
+    configASSERT( ucPair < HAL_LATENCY_MAX_PAIRS );
+    pxStats = &pxPairs[ ucPair ].xStats;
+
+    taskENTER_CRITICAL();
+    if( pxPairs[ ucPair ].ucPending != 0 ){
+        usLatency = ( uint16_t ) ( usNow - pxPairs[ ucPair ].usStamp );
+        pxPairs[ ucPair ].ucPending = 0;
+
+        /*Sum of 65535 samples of at most 65535 cycles still fits 32 bits*/
+        if( pxStats->usCount != 0xFFFF ){
+            pxStats->usCount++;
+            pxStats->ulSum += usLatency;
+            if( usLatency < pxStats->usMin ){
+                pxStats->usMin = usLatency;
+            }
+            if( usLatency > pxStats->usMax ){
+                pxStats->usMax = usLatency;
+            }
+            usBin = usLatency >> HAL_LATENCY_BIN_SHIFT;
+            if( usBin >= HAL_LATENCY_BINS ){
+                usBin = HAL_LATENCY_BINS - 1;
+            }
+            pxStats->pusHistogram[ usBin ]++;
+        }
+    }
+    taskEXIT_CRITICAL();
+}
+
+void vHALLatencyGetStats( uint8_t ucPair, hal_latency_stats_t *pxStats ){
+    configASSERT( ucPair < HAL_LATENCY_MAX_PAIRS );
+
+    taskENTER_CRITICAL();
+    *pxStats = pxPairs[ ucPair ].xStats;
+    taskEXIT_CRITICAL();
+
+    if( pxStats->usCount != 0 ){
+        pxStats->usMean = ( uint16_t ) ( pxStats->ulSum / pxStats->usCount );
+    }
+    else{
+        pxStats->usMin = 0;
+    }
+}
+
+void vHALLatencyReset( uint8_t ucPair ){
+    configASSERT( ucPair < HAL_LATENCY_MAX_PAIRS );
+
+    taskENTER_CRITICAL();
+    prvResetStats( &pxPairs[ ucPair ].xStats );
+    taskEXIT_CRITICAL();
+}
+
+#endif /* configUSE_LATENCY_PROBE */
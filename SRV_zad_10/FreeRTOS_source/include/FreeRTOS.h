@@ -206,6 +206,10 @@ extern "C" {
 	#define configUSE_MUTEXES 0
 #endif
 
+#ifndef configUSE_CEILING_MUTEXES
+	#define configUSE_CEILING_MUTEXES 0
+#endif
+
 #ifndef configUSE_TIMERS
 	#define configUSE_TIMERS 0
 #endif
@@ -814,6 +818,114 @@ extern "C" {
 	#define configUSE_TASK_NOTIFICATIONS 1
 #endif
 
+#ifndef configUSE_NOTIFY_SEMAPHORES
+	#define configUSE_NOTIFY_SEMAPHORES 0
+#endif
+
+#if( ( configUSE_NOTIFY_SEMAPHORES == 1 ) && ( configUSE_TASK_NOTIFICATIONS != 1 ) )
+	#error configUSE_NOTIFY_SEMAPHORES keeps the semaphore count in the task notification value, so configUSE_TASK_NOTIFICATIONS must be set to 1.
+#endif
+
+#ifndef configUSE_EVENT_GROUP_DIRECT_FROM_ISR
+	#define configUSE_EVENT_GROUP_DIRECT_FROM_ISR 0
+#endif
+
+#ifndef configEVENT_GROUP_MAX_WAITERS
+	/* Only enforced when configUSE_EVENT_GROUP_DIRECT_FROM_ISR is 1, as it
+	bounds the time an interrupt spends walking the waiting tasks. */
+	#define configEVENT_GROUP_MAX_WAITERS 4
+#endif
+
+#ifndef configUSE_WORK_QUEUES
+	#define configUSE_WORK_QUEUES 0
+#endif
+
+#ifndef configWORK_QUEUE_CLASSES
+	#define configWORK_QUEUE_CLASSES 2
+#endif
+
+#ifndef configWORK_QUEUE_STACK_DEPTH
+	#define configWORK_QUEUE_STACK_DEPTH configMINIMAL_STACK_SIZE
+#endif
+
+#ifndef configUSE_EDF_SCHEDULING
+	#define configUSE_EDF_SCHEDULING 0
+#endif
+
+#if( configUSE_EDF_SCHEDULING == 1 )
+	#ifndef configEDF_PRIORITY
+		#error configEDF_PRIORITY must be set to the priority at which tasks are scheduled by earliest deadline.
+	#endif
+	#if( ( configEDF_PRIORITY == 0 ) || ( configEDF_PRIORITY >= configMAX_PRIORITIES ) )
+		#error configEDF_PRIORITY must be above the idle priority and below configMAX_PRIORITIES.
+	#endif
+#endif
+
+#ifndef configUSE_ADMISSION_CONTROL
+	#define configUSE_ADMISSION_CONTROL 0
+#endif
+
+#ifndef configADMISSION_MAX_TASKS
+	#define configADMISSION_MAX_TASKS 8
+#endif
+
+#ifndef configADMISSION_REJECT_UNSCHEDULABLE
+	/* Set to 0 to create tasks that make the task set unschedulable anyway,
+	and only flag the overload. */
+	#define configADMISSION_REJECT_UNSCHEDULABLE 1
+#endif
+
+#ifndef configUSE_RELEASE_MONITOR
+	#define configUSE_RELEASE_MONITOR 0
+#endif
+
+#ifndef configRELEASE_JITTER_BINS
+	#define configRELEASE_JITTER_BINS 4
+#endif
+
+#ifndef configUSE_DEADLINE_MISS_HOOK
+	#define configUSE_DEADLINE_MISS_HOOK 0
+#endif
+
+#if( ( configUSE_RELEASE_MONITOR == 1 ) && ( INCLUDE_vTaskDelayUntil != 1 ) )
+	#error Releases are recorded by vTaskDelayUntil(), so INCLUDE_vTaskDelayUntil must be set to 1 to use the release monitor.
+#endif
+
+#ifndef configUSE_TICK_EPOCH
+	#define configUSE_TICK_EPOCH 0
+#endif
+
+#ifndef configUSE_PREEMPTION_THRESHOLD
+	#define configUSE_PREEMPTION_THRESHOLD 0
+#endif
+
+#ifndef configUSE_TASK_BUDGETS
+	#define configUSE_TASK_BUDGETS 0
+#endif
+
+#ifndef configBUDGET_BACKGROUND_PRIORITY
+	/* Priority of a task that has used up its budget. */
+	#define configBUDGET_BACKGROUND_PRIORITY 0
+#endif
+
+#ifndef configUSE_CYCLIC_EXECUTIVE
+	#define configUSE_CYCLIC_EXECUTIVE 0
+#endif
+
+#ifndef configCYCLIC_MAX_FRAMES
+	/* Longest major frame, in minor frames.  The schedule table takes one
+	UBaseType_t per minor frame. */
+	#define configCYCLIC_MAX_FRAMES 64
+#endif
+
+#ifndef configCYCLIC_STACK_DEPTH
+	#define configCYCLIC_STACK_DEPTH configMINIMAL_STACK_SIZE
+#endif
+
+#if( ( configUSE_WORK_QUEUES == 1 ) && ( configUSE_TASK_NOTIFICATIONS != 1 ) )
+	#error Work queue workers block on their task notification, so configUSE_TASK_NOTIFICATIONS must be set to 1.
+#endif
+
 #ifndef configUSE_POSIX_ERRNO
 	#define configUSE_POSIX_ERRNO 0
 #endif
@@ -860,6 +972,10 @@ extern "C" {
 	#error configUSE_MUTEXES must be set to 1 to use recursive mutexes
 #endif
 
+#if( ( configUSE_CEILING_MUTEXES == 1 ) && ( configUSE_MUTEXES != 1 ) )
+	#error configUSE_MUTEXES must be set to 1 to use priority ceiling mutexes
+#endif
+
 #ifndef configINITIAL_TICK_COUNT
 	#define configINITIAL_TICK_COUNT 0
 #endif
@@ -1110,6 +1226,18 @@ typedef struct xSTATIC_TCB
 	#if ( configUSE_MUTEXES == 1 )
 		UBaseType_t		uxDummy12[ 2 ];
 	#endif
+	#if ( configUSE_EDF_SCHEDULING == 1 )
+		TickType_t		xDummy12b[ 2 ];
+	#endif
+	#if ( configUSE_PREEMPTION_THRESHOLD == 1 )
+		UBaseType_t		uxDummy12d;
+	#endif
+	#if ( configUSE_RELEASE_MONITOR == 1 )
+		void			*pvDummy12c;
+	#endif
+	#if ( configUSE_TASK_BUDGETS == 1 )
+		void			*pvDummy12e;
+	#endif
 	#if ( configUSE_APPLICATION_TASK_TAG == 1 )
 		void			*pxDummy14;
 	#endif
@@ -1162,6 +1290,10 @@ typedef struct xSTATIC_QUEUE
 		UBaseType_t uxDummy2;
 	} u;
 
+	#if( configUSE_CEILING_MUTEXES == 1 )
+		UBaseType_t uxDummy2b[ 2 ];
+	#endif
+
 	StaticList_t xDummy3[ 2 ];
 	UBaseType_t uxDummy4[ 3 ];
 	uint8_t ucDummy5[ 2 ];
@@ -0,0 +1,141 @@
+/*
+ * Time-triggered cyclic executive for FreeRTOS.
+ *
+ * Purely periodic jobs are listed in a constant job table, each with a period
+ * and an offset counted in minor frames.  When the executive is started the
+ * job table is expanded into a schedule table with one entry per minor frame
+ * of the major frame, the least common multiple of the job periods.  A single
+ * dispatcher task then wakes at the start of each minor frame and runs the
+ * jobs scheduled in it, in job table order, to completion.
+ *
+ * xCyclicExecutiveStart() builds the schedule table at run time, which costs
+ * one pass over the major frame at start and one UBaseType_t of heap per minor
+ * frame.  Alternatively the table is generated at build time by the host tool
+ * host/cyclic_table from a job list, and handed to
+ * xCyclicExecutiveStartFromTable() as a constant array, so it takes no heap
+ * and has no length limit.
+ *
+ * The dispatcher is an ordinary task, so normal tasks for sporadic work run
+ * whenever it is idle between frames, and interrupts still preempt it.  Jobs
+ * must not block, as that would delay every job after them.
+ *
+ * 1 tab == 4 spaces!
+ */
+
+#ifndef CYCLIC_H
+#define CYCLIC_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h" must appear in source files before "include cyclic.h"
+#endif
+
+#include "task.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Maximum number of jobs in a job table, one per bit of a schedule table
+ * entry.
+ */
+#define cyclicMAX_JOBS		( sizeof( UBaseType_t ) * 8U )
+
+/*
+ * Prototype of a job function.  pvParameter is the value given in the job
+ * table.
+ */
+typedef void ( *CyclicJobFunction_t )( void *pvParameter );
+
+/*
+ * One entry of a job table.  The job runs in every minor frame f for which
+ * f % uxPeriod == uxOffset.  Use cyclicJOB() to fill entries in.
+ */
+typedef struct xCYCLIC_JOB
+{
+	CyclicJobFunction_t pxFunction;
+	void *pvParameter;
+	UBaseType_t uxPeriod;		/*< Period in minor frames, at least 1. */
+	UBaseType_t uxOffset;		/*< Minor frame of the first release, less than uxPeriod. */
+} CyclicJob_t;
+
+#define cyclicJOB( pxFunction, pvParameter, uxPeriod, uxOffset ) { ( pxFunction ), ( pvParameter ), ( uxPeriod ), ( uxOffset ) }
+
+/**
+ * cyclic.h
+ * <pre>BaseType_t xCyclicExecutiveStart( const CyclicJob_t *pxJobs, UBaseType_t uxJobCount, TickType_t xMinorFrameTicks, UBaseType_t uxPriority );</pre>
+ *
+ * Build the schedule table for the uxJobCount jobs in pxJobs and create the
+ * dispatcher task at uxPriority, with a stack of configCYCLIC_STACK_DEPTH
+ * words.  The dispatcher should have the highest priority of all application
+ * tasks so frames start on time.  The first minor frame starts when the
+ * dispatcher first runs.  Can only be called once.
+ *
+ * @param pxJobs Job table, must remain valid while the executive runs.
+ *
+ * @param xMinorFrameTicks Length of a minor frame in ticks.
+ *
+ * @return pdPASS if the executive was started, pdFAIL if the major frame would
+ * be longer than configCYCLIC_MAX_FRAMES minor frames or there was not enough
+ * heap.
+ *
+ * \defgroup xCyclicExecutiveStart xCyclicExecutiveStart
+ * \ingroup CyclicExecutive
+ */
+BaseType_t xCyclicExecutiveStart( const CyclicJob_t * const pxJobs, UBaseType_t uxJobCount, TickType_t xMinorFrameTicks, UBaseType_t uxPriority ) PRIVILEGED_FUNCTION;
+
+/**
+ * cyclic.h
+ * <pre>BaseType_t xCyclicExecutiveStartFromTable( const CyclicJob_t *pxJobs, UBaseType_t uxJobCount, const UBaseType_t *puxTable, UBaseType_t uxMajorFrames, TickType_t xMinorFrameTicks, UBaseType_t uxPriority );</pre>
+ *
+ * Same as xCyclicExecutiveStart(), but with a schedule table generated at build
+ * time by host/cyclic_table instead of one built from pxJobs.  Entry f of
+ * puxTable has bit n set if job n runs in minor frame f.  pxJobs must list the
+ * jobs in the order of the job list the table was generated from.
+ *
+ * @param puxTable Schedule table, must remain valid while the executive runs.
+ *
+ * @param uxMajorFrames Number of entries in puxTable.
+ *
+ * @return pdPASS if the executive was started, pdFAIL if there was not enough
+ * heap for the dispatcher task.
+ *
+ * \defgroup xCyclicExecutiveStartFromTable xCyclicExecutiveStartFromTable
+ * \ingroup CyclicExecutive
+ */
+BaseType_t xCyclicExecutiveStartFromTable( const CyclicJob_t * const pxJobs, UBaseType_t uxJobCount, const UBaseType_t * const puxTable, UBaseType_t uxMajorFrames, TickType_t xMinorFrameTicks, UBaseType_t uxPriority ) PRIVILEGED_FUNCTION;
+
+/**
+ * cyclic.h
+ * <pre>UBaseType_t uxCyclicGetMajorFrameLength( void );</pre>
+ *
+ * @return The number of minor frames in the major frame, 0 if the executive has
+ * not been started.
+ */
+UBaseType_t uxCyclicGetMajorFrameLength( void ) PRIVILEGED_FUNCTION;
+
+/**
+ * cyclic.h
+ * <pre>UBaseType_t uxCyclicGetOverruns( void );</pre>
+ *
+ * @return The number of minor frames whose jobs were still running when the
+ * next frame should have started.  Saturates at its maximum value.
+ */
+UBaseType_t uxCyclicGetOverruns( void ) PRIVILEGED_FUNCTION;
+
+/**
+ * cyclic.h
+ * <pre>const TaskReleaseMonitor_t *pxCyclicGetReleaseMonitor( void );</pre>
+ *
+ * Only available if configUSE_RELEASE_MONITOR is 1.
+ *
+ * @return The release monitor of the dispatcher, in which each minor frame is
+ * one release, see vTaskSetReleaseMonitor().
+ */
+const TaskReleaseMonitor_t *pxCyclicGetReleaseMonitor( void ) PRIVILEGED_FUNCTION;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* CYCLIC_H */
@@ -0,0 +1,131 @@
+/*
+ * Lock-free single producer, single consumer ring buffer for FreeRTOS.
+ *
+ * Moves fixed size items (bytes, words or small structures) from one producer
+ * to one consumer, either of which can be a task or an interrupt.  The
+ * producer only ever writes the head index and the consumer only ever writes
+ * the tail index.  Both are UBaseType_t, which the MSP430X stores with a single
+ * instruction, so neither side disables interrupts or touches an event list.
+ *
+ * Optionally a consumer task is given a task notification when the number of
+ * items in the buffer rises to a threshold, so the task can block until a
+ * batch of items is ready rather than being woken for every item.
+ *
+ * 1 tab == 4 spaces!
+ */
+
+#ifndef RINGBUFFER_H
+#define RINGBUFFER_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h" must appear in source files before "include ringbuffer.h"
+#endif
+
+#include "task.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Storage needed for a buffer holding up to uxItems items of uxItemSize bytes.
+ * One slot is always left empty so a full buffer can be told from an empty
+ * one.
+ */
+#define ringbufferSTORAGE_SIZE( uxItems, uxItemSize ) ( ( ( uxItems ) + 1 ) * ( uxItemSize ) )
+
+/*
+ * The ring buffer is allocated by the application, normally as a global
+ * variable.  Members must only be accessed through the functions below.
+ */
+typedef struct xRING_BUFFER
+{
+	volatile UBaseType_t uxHead;	/*< Next slot to write, only written by the producer. */
+	volatile UBaseType_t uxTail;	/*< Next slot to read, only written by the consumer. */
+	UBaseType_t uxSlots;			/*< Number of slots in pucStorage, one more than the capacity. */
+	UBaseType_t uxItemSize;
+	uint8_t *pucStorage;
+	TaskHandle_t xConsumerTask;		/*< Task notified when the threshold is reached, or NULL. */
+	UBaseType_t uxNotifyThreshold;
+} RingBuffer_t;
+
+/**
+ * ringbuffer.h
+ * <pre>void vRingBufferInit( RingBuffer_t *pxRingBuffer, uint8_t *pucStorage, UBaseType_t uxItems, UBaseType_t uxItemSize );</pre>
+ *
+ * Prepare an empty ring buffer that can hold uxItems items of uxItemSize
+ * bytes.  pucStorage must be ringbufferSTORAGE_SIZE( uxItems, uxItemSize )
+ * bytes long.
+ */
+void vRingBufferInit( RingBuffer_t * const pxRingBuffer, uint8_t * const pucStorage, UBaseType_t uxItems, UBaseType_t uxItemSize ) PRIVILEGED_FUNCTION;
+
+/**
+ * ringbuffer.h
+ * <pre>void vRingBufferSetConsumerTask( RingBuffer_t *pxRingBuffer, TaskHandle_t xTask, UBaseType_t uxThreshold );</pre>
+ *
+ * Give xTask a notification (as xTaskNotifyGive()) each time a push brings the
+ * number of items in the buffer up to uxThreshold.  xTask must be the consumer,
+ * and must not use its notification value for anything else.  Must be called
+ * before the producer starts.  Pass NULL to stop notifications.
+ */
+void vRingBufferSetConsumerTask( RingBuffer_t * const pxRingBuffer, TaskHandle_t xTask, UBaseType_t uxThreshold ) PRIVILEGED_FUNCTION;
+
+/**
+ * ringbuffer.h
+ * <pre>BaseType_t xRingBufferPush( RingBuffer_t *pxRingBuffer, const void *pvItem );</pre>
+ *
+ * Copy an item into the buffer from a producer task.  Never blocks.
+ *
+ * @return pdPASS if the item was stored, pdFAIL if the buffer was full.
+ */
+BaseType_t xRingBufferPush( RingBuffer_t * const pxRingBuffer, const void * const pvItem ) PRIVILEGED_FUNCTION;
+
+/**
+ * ringbuffer.h
+ * <pre>BaseType_t xRingBufferPushFromISR( RingBuffer_t *pxRingBuffer, const void *pvItem, BaseType_t *pxHigherPriorityTaskWoken );</pre>
+ *
+ * Copy an item into the buffer from a producer interrupt.
+ * *pxHigherPriorityTaskWoken is set to pdTRUE if notifying the consumer task
+ * unblocked a task of higher priority than the interrupted task.
+ *
+ * @return pdPASS if the item was stored, pdFAIL if the buffer was full.
+ */
+BaseType_t xRingBufferPushFromISR( RingBuffer_t * const pxRingBuffer, const void * const pvItem, BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * ringbuffer.h
+ * <pre>BaseType_t xRingBufferPop( RingBuffer_t *pxRingBuffer, void *pvItem );</pre>
+ *
+ * Copy the oldest item out of the buffer.  Can be called by a consumer task or
+ * a consumer interrupt.  Never blocks.
+ *
+ * @return pdPASS if an item was copied, pdFAIL if the buffer was empty.
+ */
+BaseType_t xRingBufferPop( RingBuffer_t * const pxRingBuffer, void * const pvItem ) PRIVILEGED_FUNCTION;
+
+/**
+ * ringbuffer.h
+ * <pre>BaseType_t xRingBufferReceive( RingBuffer_t *pxRingBuffer, void *pvItem, TickType_t xTicksToWait );</pre>
+ *
+ * As xRingBufferPop(), but if the buffer is empty the calling task, which must
+ * be the consumer task set by vRingBufferSetConsumerTask(), blocks for up to
+ * xTicksToWait until the notification threshold is reached.
+ *
+ * @return pdPASS if an item was copied, pdFAIL on timeout.
+ */
+BaseType_t xRingBufferReceive( RingBuffer_t * const pxRingBuffer, void * const pvItem, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * ringbuffer.h
+ * <pre>UBaseType_t uxRingBufferItemsWaiting( const RingBuffer_t *pxRingBuffer );</pre>
+ *
+ * Returns the number of items in the buffer.  Exact when called by the
+ * producer or the consumer, a snapshot otherwise.
+ */
+UBaseType_t uxRingBufferItemsWaiting( const RingBuffer_t * const pxRingBuffer ) PRIVILEGED_FUNCTION;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RINGBUFFER_H */
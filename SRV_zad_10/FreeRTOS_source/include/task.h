@@ -69,6 +69,14 @@ extern "C" {
 struct tskTaskControlBlock; /* The old naming convention is used to prevent breaking kernel aware debuggers. */
 typedef struct tskTaskControlBlock* TaskHandle_t;
 
+/*
+ * Type by which notification semaphores are referenced.  The type is distinct
+ * from SemaphoreHandle_t so a notification semaphore can never be passed to the
+ * queue based API (or added to a queue set, or used as a mutex), which would
+ * allow more than one task to block on it.
+ */
+typedef struct tskNotifySemaphore* NotifySemaphoreHandle_t;
+
 /*
  * Defines the prototype to which the application task hook function must
  * conform.
@@ -105,6 +113,49 @@ typedef struct xTIME_OUT
 	TickType_t xTimeOnEntering;
 } TimeOut_t;
 
+/*
+ * Timeout of up to 0xffffffff ticks, see vTaskSetTimeOutStateLong().
+ */
+typedef struct xTIME_OUT_LONG
+{
+	uint32_t ulTimeOnEntering;
+	uint32_t ulTicksToWait;
+} TimeOutLong_t;
+
+/*
+ * Release timing of a periodic task, see vTaskSetReleaseMonitor().  Allocated
+ * by the application, only written by the kernel.
+ */
+typedef struct xTASK_RELEASE_MONITOR
+{
+	TaskHandle_t xTask;
+	TickType_t xPeriod;				/*< Expected time between releases. */
+	TickType_t xDeadline;			/*< Deadline relative to the release. */
+	TickType_t xMaxResponse;		/*< Longest time from release to the next vTaskDelayUntil() call. */
+	TickType_t xRelease;			/*< Release time of the job in progress, set by vTaskReleaseMonitorMark(). */
+	uint16_t usReleases;			/*< Releases seen, saturates at 0xffff. */
+	uint16_t usMisses;				/*< Releases that completed after their deadline, saturates. */
+	uint16_t usJitter[ configRELEASE_JITTER_BINS ];	/*< usJitter[ n ] counts releases started n ticks late, the last bin counts the rest. */
+} TaskReleaseMonitor_t;
+
+/*
+ * Execution budget of a task, see vTaskSetBudget().  Allocated by the
+ * application, only written by the kernel.
+ */
+typedef struct xTASK_BUDGET
+{
+	TaskHandle_t xTask;
+	TickType_t xBudget;				/*< Ticks the task can run at its own priority per period. */
+	TickType_t xPeriod;				/*< Replenishment period. */
+	TickType_t xRemaining;			/*< Ticks left, 0 while the task runs at background priority. */
+	TickType_t xReplenishTime;		/*< Tick count at which the budget is returned, valid while xRemaining is below xBudget. */
+	TickType_t xLastCharge;			/*< Tick count at which the task was last charged. */
+	UBaseType_t uxPriority;			/*< Priority of the task while it has budget left. */
+	UBaseType_t uxThreshold;		/*< Preemption threshold set aside while the budget is exhausted. */
+	uint16_t usExhausted;			/*< Times the budget ran out, saturates at 0xffff. */
+	struct xTASK_BUDGET *pxNext;	/*< Next budget charged by the tick. */
+} TaskBudget_t;
+
 /*
  * Defines the memory ranges allocated to the task when an MPU is used.
  */
@@ -145,6 +196,7 @@ typedef struct xTASK_STATUS
 	uint32_t ulRunTimeCounter;		/* The total run time allocated to the task so far, as defined by the run time stats clock.  See http://www.freertos.org/rtos-run-time-stats.html.  Only valid when configGENERATE_RUN_TIME_STATS is defined as 1 in FreeRTOSConfig.h. */
 	StackType_t *pxStackBase;		/* Points to the lowest address of the task's stack area. */
 	configSTACK_DEPTH_TYPE usStackHighWaterMark;	/* The minimum amount of stack space that has remained for the task since the task was created.  The closer this value is to zero the closer the task has come to overflowing its stack. */
+	const TaskBudget_t *pxBudget;	/* The execution budget of the task, NULL if it has none.  Always NULL unless configUSE_TASK_BUDGETS is defined as 1 in FreeRTOSConfig.h. */
 } TaskStatus_t;
 
 /* Possible return values for eTaskConfirmSleepModeStatus(). */
@@ -816,6 +868,234 @@ void vTaskDelay( const TickType_t xTicksToDelay ) PRIVILEGED_FUNCTION;
  */
 void vTaskDelayUntil( TickType_t * const pxPreviousWakeTime, const TickType_t xTimeIncrement ) PRIVILEGED_FUNCTION;
 
+/**
+ * task. h
+ * <pre>void vTaskSetDeadline( TaskHandle_t xTask, TickType_t xRelativeDeadline );</pre>
+ *
+ * configUSE_EDF_SCHEDULING must be defined as 1 for this function to be
+ * available.
+ *
+ * Give a task a deadline relative to the start of each of its releases.  Ready
+ * tasks at priority configEDF_PRIORITY run in order of their absolute
+ * deadlines instead of taking turns, and a task there preempts another one
+ * with a later deadline.  Tasks without a deadline at that priority run only
+ * when no task with a deadline is ready.  Tasks at all other priorities are
+ * not affected, so fixed priority tasks can run above and below the EDF
+ * tasks.
+ *
+ * The current release is taken to start when this function is called.  Each
+ * call to vTaskDelayUntil() starts the next release at its wake time, so a
+ * periodic EDF task should set its deadline once and then loop on
+ * vTaskDelayUntil().
+ *
+ * @param xTask Handle of the task.  Passing NULL sets the deadline of the
+ * calling task.
+ *
+ * @param xRelativeDeadline Deadline in ticks, normally the period of the task
+ * or less.  0 removes the deadline.
+ *
+ * \defgroup vTaskSetDeadline vTaskSetDeadline
+ * \ingroup TaskCtrl
+ */
+void vTaskSetDeadline( TaskHandle_t xTask, TickType_t xRelativeDeadline ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * <pre>TickType_t xTaskGetDeadline( TaskHandle_t xTask );</pre>
+ *
+ * configUSE_EDF_SCHEDULING must be defined as 1 for this function to be
+ * available.
+ *
+ * @return The tick count by which the current release of xTask should
+ * complete, or 0 if the task has no deadline.  Passing NULL queries the
+ * calling task.
+ *
+ * \defgroup xTaskGetDeadline xTaskGetDeadline
+ * \ingroup TaskCtrl
+ */
+TickType_t xTaskGetDeadline( TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * <pre>void vTaskSetPreemptionThreshold( TaskHandle_t xTask, UBaseType_t uxThreshold );</pre>
+ *
+ * configUSE_PREEMPTION_THRESHOLD must be defined as 1 for this function to be
+ * available.
+ *
+ * Set the preemption threshold of a task.  The task is selected to run by its
+ * priority as usual, but once it runs only tasks with a priority above the
+ * threshold can preempt it.  Tasks with a priority between the two wait until
+ * the task blocks, so short tasks that hand work to slightly higher priority
+ * tasks are not switched out on every hand over.  Tasks of equal priority do
+ * not get a time slice while the task runs either.
+ *
+ * @param xTask Handle of the task.  Passing NULL sets the threshold of the
+ * calling task.
+ *
+ * @param uxThreshold The threshold.  A threshold at or below the priority of
+ * the task has no effect, which is the default.
+ *
+ * \defgroup vTaskSetPreemptionThreshold vTaskSetPreemptionThreshold
+ * \ingroup TaskCtrl
+ */
+void vTaskSetPreemptionThreshold( TaskHandle_t xTask, UBaseType_t uxThreshold ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * <pre>UBaseType_t uxTaskGetPreemptionThreshold( TaskHandle_t xTask );</pre>
+ *
+ * configUSE_PREEMPTION_THRESHOLD must be defined as 1 for this function to be
+ * available.
+ *
+ * @return The priority a task must be above to preempt xTask while it runs,
+ * its priority if no higher threshold is set.  Passing NULL queries the
+ * calling task.
+ *
+ * \defgroup uxTaskGetPreemptionThreshold uxTaskGetPreemptionThreshold
+ * \ingroup TaskCtrl
+ */
+UBaseType_t uxTaskGetPreemptionThreshold( TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * <pre>void vTaskSetReleaseMonitor( TaskHandle_t xTask, TaskReleaseMonitor_t *pxMonitor, TickType_t xPeriod, TickType_t xDeadline );</pre>
+ *
+ * configUSE_RELEASE_MONITOR must be defined as 1 for this function to be
+ * available.
+ *
+ * Record the release timing of a periodic task that waits with
+ * vTaskDelayUntil().  Each call to vTaskDelayUntil() completes one release and
+ * starts the next:
+ *
+ * - The time from the release that just completed to the call is its response
+ *   time.  If it is longer than xDeadline the release is counted as a miss,
+ *   and vApplicationDeadlineMissHook() is called if
+ *   configUSE_DEADLINE_MISS_HOOK is 1.
+ *
+ * - The number of ticks between the wake time and the return from
+ *   vTaskDelayUntil() is the release jitter, which is counted in a histogram.
+ *
+ * A periodic task released by something else, such as a software timer,
+ * reports its jobs with vTaskReleaseMonitorMark() and
+ * vTaskReleaseMonitorComplete() instead.
+ *
+ * @param xTask Handle of the task.  Passing NULL monitors the calling task.
+ *
+ * @param pxMonitor Monitor to fill in, cleared by this call.  Must remain
+ * valid while it is in use.  NULL stops monitoring.
+ *
+ * @param xPeriod The period the task passes to vTaskDelayUntil().
+ *
+ * @param xDeadline Deadline relative to each release, 0 to use xPeriod.
+ *
+ * \defgroup vTaskSetReleaseMonitor vTaskSetReleaseMonitor
+ * \ingroup TaskCtrl
+ */
+void vTaskSetReleaseMonitor( TaskHandle_t xTask, TaskReleaseMonitor_t * const pxMonitor, TickType_t xPeriod, TickType_t xDeadline ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * <pre>void vTaskReleaseMonitorMark( TickType_t xReleaseTime );</pre>
+ *
+ * configUSE_RELEASE_MONITOR must be defined as 1 for this function to be
+ * available.
+ *
+ * Start a job of a monitored task that is not released by vTaskDelayUntil().
+ * Call when the job starts, after the task has woken up for it.  The ticks
+ * from xReleaseTime to the call are counted in the jitter histogram, as
+ * vTaskDelayUntil() counts them for the wake time.  Does nothing if the
+ * calling task is not monitored.
+ *
+ * @param xReleaseTime The tick count at which the job was due, for example
+ * the expiry time of the timer that released it.  Must not be in the future.
+ *
+ * \defgroup vTaskReleaseMonitorMark vTaskReleaseMonitorMark
+ * \ingroup TaskCtrl
+ */
+void vTaskReleaseMonitorMark( TickType_t xReleaseTime ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * <pre>void vTaskReleaseMonitorComplete( void );</pre>
+ *
+ * configUSE_RELEASE_MONITOR must be defined as 1 for this function to be
+ * available.
+ *
+ * Complete the job started by the last vTaskReleaseMonitorMark() call of the
+ * calling task.  The ticks from its release time to this call are the
+ * response time, checked against the deadline as on a vTaskDelayUntil()
+ * call.  Does nothing if the calling task is not monitored.
+ *
+ * \defgroup vTaskReleaseMonitorComplete vTaskReleaseMonitorComplete
+ * \ingroup TaskCtrl
+ */
+void vTaskReleaseMonitorComplete( void ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * <pre>size_t xTaskReleaseMonitorDump( const TaskReleaseMonitor_t *pxMonitor, char *pcBuffer, size_t xBufferLength );</pre>
+ *
+ * configUSE_RELEASE_MONITOR must be defined as 1 for this function to be
+ * available.
+ *
+ * Write one line describing pxMonitor, for sending to a host:
+ *
+ * <pre>name period deadline releases misses max_response jitter_0 ... jitter_n</pre>
+ *
+ * All numbers are decimal, separated by single spaces, and the line ends with
+ * a newline.  The values are a snapshot, the monitored task may update them
+ * while the line is written.
+ *
+ * @return The number of characters written, not counting the terminating
+ * null, or 0 if the line did not fit in xBufferLength characters.
+ *
+ * \defgroup xTaskReleaseMonitorDump xTaskReleaseMonitorDump
+ * \ingroup TaskCtrl
+ */
+size_t xTaskReleaseMonitorDump( const TaskReleaseMonitor_t * const pxMonitor, char * const pcBuffer, size_t xBufferLength ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * <pre>void vTaskSetBudget( TaskHandle_t xTask, TaskBudget_t *pxBudget, TickType_t xBudget, TickType_t xPeriod );</pre>
+ *
+ * configUSE_TASK_BUDGETS must be defined as 1 for this function to be
+ * available.
+ *
+ * Limit the processor time a task that handles aperiodic events can take at
+ * its own priority, as a sporadic server.  The tick charges each tick to the
+ * task that was running when it ended.  When the task has used xBudget ticks
+ * it drops to configBUDGET_BACKGROUND_PRIORITY, and returns to its priority
+ * when the budget is replenished, one period after the burst of execution that
+ * used it started.  A flood of events can then take no more than xBudget ticks
+ * out of any xPeriod ticks from the tasks below it.
+ *
+ * Tasks that run for less than a tick at a time may not be charged at all,
+ * the budget is only as fine as the tick.  vTaskPrioritySet() on a budgeted
+ * task changes the priority it runs at while it has budget left; a task that
+ * has used up its budget stays at background priority until replenishment.
+ * A task holding a mutex is not moved: it keeps its priority, or the mutex
+ * ceiling, and takes the priority due by then when it gives its last mutex
+ * back.  Deleting a budgeted task stops its budget being charged.
+ *
+ * The budget state is reported in the pxBudget member of TaskStatus_t by
+ * uxTaskGetSystemState() and vTaskGetInfo().
+ *
+ * @param xTask Handle of the task.  Passing NULL sets the budget of the
+ * calling task.  A task can only be given one budget, and not while it
+ * holds a ceiling mutex.
+ *
+ * @param pxBudget Budget state, filled in by this call.  Must remain valid until
+ * the task is deleted.
+ *
+ * @param xBudget Ticks the task can run per period, at most xPeriod.
+ *
+ * @param xPeriod Replenishment period in ticks.
+ *
+ * \defgroup vTaskSetBudget vTaskSetBudget
+ * \ingroup TaskCtrl
+ */
+void vTaskSetBudget( TaskHandle_t xTask, TaskBudget_t * const pxBudget, TickType_t xBudget, TickType_t xPeriod ) PRIVILEGED_FUNCTION;
+
 /**
  * task. h
  * <pre>BaseType_t xTaskAbortDelay( TaskHandle_t xTask );</pre>
@@ -1366,6 +1646,93 @@ TickType_t xTaskGetTickCount( void ) PRIVILEGED_FUNCTION;
  */
 TickType_t xTaskGetTickCountFromISR( void ) PRIVILEGED_FUNCTION;
 
+/**
+ * task. h
+ * <PRE>uint32_t ulTaskGetTickCount32( void );</PRE>
+ *
+ * Only available if configUSE_TICK_EPOCH is 1.
+ *
+ * With 16 bit ticks the tick count wraps every 65536 ticks.  The kernel
+ * already counts the wraps to switch its delayed lists, so the wrap count is
+ * the upper half of a 32 bit tick count that only costs the caller a critical
+ * section to read.  The tick interrupt does no 32 bit arithmetic.  With 32 bit
+ * ticks this is the same as xTaskGetTickCount().
+ *
+ * @return The count of ticks since vTaskStartScheduler was called, wrapping
+ * every 2^32 ticks.
+ *
+ * \defgroup ulTaskGetTickCount32 ulTaskGetTickCount32
+ * \ingroup TaskUtils
+ */
+uint32_t ulTaskGetTickCount32( void ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * <PRE>uint32_t ulTaskGetTickCount32FromISR( void );</PRE>
+ *
+ * A version of ulTaskGetTickCount32() that can be called from an ISR.
+ *
+ * \defgroup ulTaskGetTickCount32FromISR ulTaskGetTickCount32FromISR
+ * \ingroup TaskUtils
+ */
+uint32_t ulTaskGetTickCount32FromISR( void ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * <PRE>void vTaskDelayLong( uint32_t ulTicksToDelay );</PRE>
+ *
+ * Only available if configUSE_TICK_EPOCH and INCLUDE_vTaskDelay are 1.
+ *
+ * As vTaskDelay(), but the delay can be longer than portMAX_DELAY ticks.  The
+ * task blocks in steps shorter than portMAX_DELAY, and the remaining time is
+ * worked out from ulTaskGetTickCount32() after each step, so the list items
+ * still only hold 16 bit wake times.
+ *
+ * \defgroup vTaskDelayLong vTaskDelayLong
+ * \ingroup TaskCtrl
+ */
+void vTaskDelayLong( uint32_t ulTicksToDelay ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * <PRE>void vTaskSetTimeOutStateLong( TimeOutLong_t *pxTimeOut, uint32_t ulTicksToWait );</PRE>
+ *
+ * Only available if configUSE_TICK_EPOCH is 1.
+ *
+ * Start a timeout of ulTicksToWait ticks, which can be longer than
+ * portMAX_DELAY, for use with any blocking API function.  Pass the value
+ * returned by xTaskGetTimeOutLongBlockTime() as the block time, and call the
+ * function again as long as it times out and the block time was not 0:
+ * <pre>
+ TimeOutLong_t xTimeOut;
+ TickType_t xBlockTime;
+
+	vTaskSetTimeOutStateLong( &xTimeOut, 600000UL );
+	do
+	{
+		xBlockTime = xTaskGetTimeOutLongBlockTime( &xTimeOut );
+		xReceived = xQueueReceive( xQueue, &xItem, xBlockTime );
+	} while( ( xReceived == pdFALSE ) && ( xBlockTime != 0 ) );
+ </pre>
+ *
+ * \defgroup vTaskSetTimeOutStateLong vTaskSetTimeOutStateLong
+ * \ingroup TaskCtrl
+ */
+void vTaskSetTimeOutStateLong( TimeOutLong_t * const pxTimeOut, uint32_t ulTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * task. h
+ * <PRE>TickType_t xTaskGetTimeOutLongBlockTime( TimeOutLong_t *pxTimeOut );</PRE>
+ *
+ * @return The block time to use for the next step of a timeout started with
+ * vTaskSetTimeOutStateLong(), at most portMAX_DELAY - 1 ticks, or 0 once the
+ * timeout has expired.
+ *
+ * \defgroup xTaskGetTimeOutLongBlockTime xTaskGetTimeOutLongBlockTime
+ * \ingroup TaskCtrl
+ */
+TickType_t xTaskGetTimeOutLongBlockTime( TimeOutLong_t * const pxTimeOut ) PRIVILEGED_FUNCTION;
+
 /**
  * task. h
  * <PRE>uint16_t uxTaskGetNumberOfTasks( void );</PRE>
@@ -2201,6 +2568,23 @@ uint32_t ulTaskNotifyTake( BaseType_t xClearCountOnExit, TickType_t xTicksToWait
  */
 BaseType_t xTaskNotifyStateClear( TaskHandle_t xTask );
 
+/*
+ * THESE FUNCTIONS MUST NOT BE USED FROM APPLICATION CODE.  THEY ARE ONLY
+ * INTENDED FOR USE BY THE NOTIFICATION SEMAPHORE MACROS DEFINED IN semphr.h.
+ *
+ * A notification semaphore is a binary or counting semaphore that keeps its
+ * count in the notification value of the single task that takes it, so giving
+ * and taking it never touches a queue or an event list.  The first task to take
+ * the semaphore becomes its owner; any other task attempting to take it fails
+ * configASSERT().  Gives made before the first take are remembered.  The owner
+ * must not use its notification value for any other purpose.
+ */
+NotifySemaphoreHandle_t xTaskNotifySemaphoreCreate( UBaseType_t uxMaxCount, UBaseType_t uxInitialCount ) PRIVILEGED_FUNCTION;
+BaseType_t xTaskNotifySemaphoreTake( NotifySemaphoreHandle_t xSemaphore, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+BaseType_t xTaskNotifySemaphoreGive( NotifySemaphoreHandle_t xSemaphore ) PRIVILEGED_FUNCTION;
+BaseType_t xTaskNotifySemaphoreGiveFromISR( NotifySemaphoreHandle_t xSemaphore, BaseType_t *pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+UBaseType_t uxTaskNotifySemaphoreGetCount( NotifySemaphoreHandle_t xSemaphore ) PRIVILEGED_FUNCTION;
+
 /*-----------------------------------------------------------
  * SCHEDULER INTERNALS AVAILABLE FOR PORTING PURPOSES
  *----------------------------------------------------------*/
@@ -2296,6 +2680,21 @@ void vTaskPlaceOnEventListRestricted( List_t * const pxEventList, TickType_t xTi
 BaseType_t xTaskRemoveFromEventList( const List_t * const pxEventList ) PRIVILEGED_FUNCTION;
 void vTaskRemoveFromUnorderedEventList( ListItem_t * pxEventListItem, const TickType_t xItemValue ) PRIVILEGED_FUNCTION;
 
+/*
+ * THIS FUNCTION MUST NOT BE USED FROM APPLICATION CODE.  IT IS AN
+ * INTERFACE WHICH IS FOR THE EXCLUSIVE USE OF THE EVENT BITS MODULE.
+ *
+ * THIS FUNCTION MUST BE CALLED WITH INTERRUPTS DISABLED.
+ *
+ * As vTaskRemoveFromUnorderedEventList(), but can be called from an interrupt
+ * while the scheduler is running or suspended.  Only available when
+ * configUSE_EVENT_GROUP_DIRECT_FROM_ISR is 1.
+ *
+ * @return pdTRUE if the task being removed has a higher priority than the task
+ * that was interrupted, otherwise pdFALSE.
+ */
+BaseType_t xTaskRemoveFromUnorderedEventListFromISR( ListItem_t * pxEventListItem, const TickType_t xItemValue ) PRIVILEGED_FUNCTION;
+
 /*
  * THIS FUNCTION MUST NOT BE USED FROM APPLICATION CODE.  IT IS ONLY
  * INTENDED FOR USE WHEN IMPLEMENTING A PORT OF THE SCHEDULER AND IS
@@ -2352,6 +2751,20 @@ BaseType_t xTaskPriorityInherit( TaskHandle_t const pxMutexHolder ) PRIVILEGED_F
  */
 BaseType_t xTaskPriorityDisinherit( TaskHandle_t const pxMutexHolder ) PRIVILEGED_FUNCTION;
 
+/*
+ * Raise the calling task to the ceiling priority of a priority ceiling mutex it
+ * has just taken.  Returns the task's base priority from before the raise, to
+ * be passed to xTaskPriorityRestoreFromCeiling() when the mutex is given.
+ */
+UBaseType_t uxTaskPriorityRaiseToCeiling( UBaseType_t uxCeilingPriority ) PRIVILEGED_FUNCTION;
+
+/*
+ * Restore the priority the holder of a priority ceiling mutex had before it
+ * took the mutex.  Returns pdTRUE if the priority was lowered, in which case a
+ * context switch may be required.
+ */
+BaseType_t xTaskPriorityRestoreFromCeiling( TaskHandle_t const pxMutexHolder, UBaseType_t uxSavedPriority ) PRIVILEGED_FUNCTION;
+
 /*
  * If a higher priority task attempting to obtain a mutex caused a lower
  * priority task to inherit the higher priority task's priority - but the higher
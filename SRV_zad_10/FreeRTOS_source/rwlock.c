@@ -0,0 +1,339 @@
+/*
+ * Reader-writer lock for FreeRTOS, see rwlock.h.
+ *
+ * The lock state is only changed inside critical sections, so the lock can be
+ * given from interrupts and the waiting lists can be manipulated directly with
+ * the scheduler running.  Handing the lock to a waiting writer is done by the
+ * task or interrupt that frees it, so a reader arriving between the give and
+ * the writer running cannot take the lock first.
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/* Standard includes. */
+#include <stdlib.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "rwlock.h"
+
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+typedef struct RWLockDefinition
+{
+	List_t xTasksWaitingToRead;		/*< Readers blocked by a writer holding or waiting for the lock.  Stored in priority order. */
+	List_t xTasksWaitingToWrite;	/*< Writers waiting for the lock.  Stored in priority order. */
+	volatile UBaseType_t uxReaders;	/*< Number of readers holding the lock. */
+	TaskHandle_t volatile xWriter;	/*< Writer holding the lock, or NULL. */
+} RWLock_t;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Writer preference - a reader may only take the lock when no writer holds it
+ * and no writer is waiting for it.
+ */
+#define prvReadAllowed( pxRWLock ) ( ( ( pxRWLock )->xWriter == NULL ) && ( listLIST_IS_EMPTY( &( ( pxRWLock )->xTasksWaitingToWrite ) ) != pdFALSE ) )
+
+/*
+ * Called with the lock free of writers.  Hands the lock to the highest
+ * priority waiting writer if the lock is free of readers too, otherwise, when
+ * no writer is waiting, unblocks all waiting readers.  Must be called from a
+ * critical section or with interrupts masked.  Returns pdTRUE if a task of
+ * higher priority than the calling task was unblocked.
+ */
+static BaseType_t prvHandOver( RWLock_t * const pxRWLock ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+	RWLockHandle_t xRWLockCreate( void )
+	{
+	RWLock_t *pxRWLock;
+
+		pxRWLock = ( RWLock_t * ) pvPortMalloc( sizeof( RWLock_t ) );
+
+		if( pxRWLock != NULL )
+		{
+			vListInitialise( &( pxRWLock->xTasksWaitingToRead ) );
+			vListInitialise( &( pxRWLock->xTasksWaitingToWrite ) );
+			pxRWLock->uxReaders = ( UBaseType_t ) 0;
+			pxRWLock->xWriter = NULL;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return pxRWLock;
+	}
+
+#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+BaseType_t xRWLockTakeRead( RWLockHandle_t xRWLock, TickType_t xTicksToWait )
+{
+RWLock_t * const pxRWLock = xRWLock;
+TimeOut_t xTimeOut;
+BaseType_t xEntryTimeSet = pdFALSE;
+
+	configASSERT( pxRWLock );
+
+	for( ;; )
+	{
+		taskENTER_CRITICAL();
+		{
+			if( prvReadAllowed( pxRWLock ) )
+			{
+				( pxRWLock->uxReaders )++;
+				taskEXIT_CRITICAL();
+				return pdPASS;
+			}
+
+			if( xEntryTimeSet == pdFALSE )
+			{
+				vTaskInternalSetTimeOutState( &xTimeOut );
+				xEntryTimeSet = pdTRUE;
+			}
+			else
+			{
+				/* Unblocked by a writer giving the lock, or by the timeout.
+				Sets xTicksToWait to 0 if the timeout expired. */
+				( void ) xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait );
+			}
+
+			if( xTicksToWait == ( TickType_t ) 0 )
+			{
+				taskEXIT_CRITICAL();
+				return pdFAIL;
+			}
+
+			/* All ports are written to allow a yield in a critical section, the
+			task runs again inside this critical section once unblocked. */
+			vTaskPlaceOnEventList( &( pxRWLock->xTasksWaitingToRead ), xTicksToWait );
+			portYIELD_WITHIN_API();
+		}
+		taskEXIT_CRITICAL();
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vRWLockGiveRead( RWLockHandle_t xRWLock )
+{
+RWLock_t * const pxRWLock = xRWLock;
+
+	configASSERT( pxRWLock );
+
+	taskENTER_CRITICAL();
+	{
+		configASSERT( pxRWLock->uxReaders );
+		( pxRWLock->uxReaders )--;
+
+		if( pxRWLock->uxReaders == ( UBaseType_t ) 0 )
+		{
+			if( prvHandOver( pxRWLock ) != pdFALSE )
+			{
+				portYIELD_WITHIN_API();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	taskEXIT_CRITICAL();
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xRWLockTakeWrite( RWLockHandle_t xRWLock, TickType_t xTicksToWait )
+{
+RWLock_t * const pxRWLock = xRWLock;
+TaskHandle_t const xCurrentTask = xTaskGetCurrentTaskHandle();
+TimeOut_t xTimeOut;
+BaseType_t xEntryTimeSet = pdFALSE;
+
+	configASSERT( pxRWLock );
+
+	for( ;; )
+	{
+		taskENTER_CRITICAL();
+		{
+			/* The lock is either free, or was handed to this task while it
+			was blocked. */
+			if( ( pxRWLock->xWriter == NULL ) && ( pxRWLock->uxReaders == ( UBaseType_t ) 0 ) )
+			{
+				pxRWLock->xWriter = xCurrentTask;
+			}
+
+			if( pxRWLock->xWriter == xCurrentTask )
+			{
+				taskEXIT_CRITICAL();
+				return pdPASS;
+			}
+
+			if( xEntryTimeSet == pdFALSE )
+			{
+				vTaskInternalSetTimeOutState( &xTimeOut );
+				xEntryTimeSet = pdTRUE;
+			}
+			else
+			{
+				( void ) xTaskCheckForTimeOut( &xTimeOut, &xTicksToWait );
+			}
+
+			if( xTicksToWait == ( TickType_t ) 0 )
+			{
+				/* Readers may have been held back only because this task was
+				waiting, let them in if no other writer wants the lock. */
+				if( ( pxRWLock->xWriter == NULL ) && ( prvHandOver( pxRWLock ) != pdFALSE ) )
+				{
+					portYIELD_WITHIN_API();
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				taskEXIT_CRITICAL();
+				return pdFAIL;
+			}
+
+			vTaskPlaceOnEventList( &( pxRWLock->xTasksWaitingToWrite ), xTicksToWait );
+			portYIELD_WITHIN_API();
+		}
+		taskEXIT_CRITICAL();
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vRWLockGiveWrite( RWLockHandle_t xRWLock )
+{
+RWLock_t * const pxRWLock = xRWLock;
+
+	configASSERT( pxRWLock );
+
+	taskENTER_CRITICAL();
+	{
+		configASSERT( pxRWLock->xWriter == xTaskGetCurrentTaskHandle() );
+		pxRWLock->xWriter = NULL;
+
+		if( prvHandOver( pxRWLock ) != pdFALSE )
+		{
+			portYIELD_WITHIN_API();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	taskEXIT_CRITICAL();
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xRWLockTryTakeReadFromISR( RWLockHandle_t xRWLock )
+{
+RWLock_t * const pxRWLock = xRWLock;
+BaseType_t xReturn = pdFAIL;
+UBaseType_t uxSavedInterruptStatus;
+
+	configASSERT( pxRWLock );
+
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		if( prvReadAllowed( pxRWLock ) )
+		{
+			( pxRWLock->uxReaders )++;
+			xReturn = pdPASS;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vRWLockGiveReadFromISR( RWLockHandle_t xRWLock, BaseType_t *pxHigherPriorityTaskWoken )
+{
+RWLock_t * const pxRWLock = xRWLock;
+UBaseType_t uxSavedInterruptStatus;
+
+	configASSERT( pxRWLock );
+
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		configASSERT( pxRWLock->uxReaders );
+		( pxRWLock->uxReaders )--;
+
+		if( ( pxRWLock->uxReaders == ( UBaseType_t ) 0 ) && ( prvHandOver( pxRWLock ) != pdFALSE ) )
+		{
+			if( pxHigherPriorityTaskWoken != NULL )
+			{
+				*pxHigherPriorityTaskWoken = pdTRUE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvHandOver( RWLock_t * const pxRWLock )
+{
+BaseType_t xYieldRequired = pdFALSE;
+
+	if( listLIST_IS_EMPTY( &( pxRWLock->xTasksWaitingToWrite ) ) == pdFALSE )
+	{
+		if( pxRWLock->uxReaders == ( UBaseType_t ) 0 )
+		{
+			/* The head of the list is the highest priority waiting writer.  It
+			owns the lock from now on, before it even runs. */
+			pxRWLock->xWriter = ( TaskHandle_t ) listGET_OWNER_OF_HEAD_ENTRY( &( pxRWLock->xTasksWaitingToWrite ) );
+			xYieldRequired = xTaskRemoveFromEventList( &( pxRWLock->xTasksWaitingToWrite ) );
+		}
+		else
+		{
+			/* The last reader to leave will hand over. */
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	else
+	{
+		/* No writer wants the lock, so every waiting reader can have it.  The
+		readers take it themselves when they run, in priority order. */
+		while( listLIST_IS_EMPTY( &( pxRWLock->xTasksWaitingToRead ) ) == pdFALSE )
+		{
+			if( xTaskRemoveFromEventList( &( pxRWLock->xTasksWaitingToRead ) ) != pdFALSE )
+			{
+				xYieldRequired = pdTRUE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+	}
+
+	return xYieldRequired;
+}
@@ -5,6 +5,7 @@
 #include "FreeRTOS.h"
 #include "task.h"
 #include "semphr.h"
+#include "workqueue.h"
 
 /* Hardware includes. */
 #include "msp430.h"
@@ -14,42 +15,29 @@
 
 
 static void prvSetupHardware( void );
-static void prvTask1Function( void *pvParameters );
+static void prvButtonWork( void *pvParameter, uint32_t buttonEvents );
 static void prvTask2Function( void *pvParameters );
 static void prvTask3Function( void *pvParameters );
 
 
-/** Task 1 Priority */
-#define mainTAKS_1_PRIO        ( 1 )
+/** Button work queue class and its worker priority */
+#define mainBUTTON_WORK_CLASS  ( 0 )
+#define mainBUTTON_WORK_PRIO   ( 1 )
 /** Task 2 Priority */
 #define mainTAKS_2_PRIO        ( 2 )
 #define mainTAKS_3_PRIO        ( 3 )
 
-xSemaphoreHandle xEvent_Button;
-xSemaphoreHandle xEvent_Counter;
-xSemaphoreHandle xEvent_Button_Pressed;
+/*Each semaphore is taken by one task only, so notification semaphores are used*/
+NotifySemaphoreHandle_t xEvent_Button;
+NotifySemaphoreHandle_t xEvent_Counter;
 
-static void prvTask1Function( void *pvParameters )
+/*Run by button work queue worker for each debounced SW3 press*/
+static void prvButtonWork( void *pvParameter, uint32_t buttonEvents )
 {
-            uint16_t i;
-
-            uint8_t     currentButtonState  = 1;
-            for ( ;; )
-            {
-                /*Read button state*/
-                xSemaphoreTake(xEvent_Button_Pressed, portMAX_DELAY);
-                currentButtonState = ((P1IN & 0x10) >> 4);//BIT4
-
-                    for(i = 0; i < 10000; i++);
-
-                    if(currentButtonState == 0){
-                        /* If button is still pressed toggle diode LD3 */
-                        xSemaphoreGive( xEvent_Button);
-                    }
-
-
-            }
-
+    if(buttonEvents & HAL_BUTTON_EVENT_PRESS(HAL_BUTTON_SW3)){
+        /* If button is pressed signal counting task */
+        xSemaphoreNotifyGive( xEvent_Button);
+    }
 }
 
 static void prvTask2Function( void *pvParameters )
@@ -59,10 +47,10 @@ static void prvTask2Function( void *pvParameters )
     for ( ;; )
     {
 
-        xSemaphoreTake( xEvent_Button, portMAX_DELAY );
+        xSemaphoreNotifyTake( xEvent_Button, portMAX_DELAY );
         if(cnt == 9){
             cnt = 0;
-            xSemaphoreGive(xEvent_Counter);
+            xSemaphoreNotifyGive(xEvent_Counter);
         }
         else{
             cnt++;
@@ -74,7 +62,7 @@ static void prvTask2Function( void *pvParameters )
 
 static void prvTask3Function(void *pvParameters){
     for(;;){
-    xSemaphoreTake( xEvent_Counter, portMAX_DELAY );
+    xSemaphoreNotifyTake( xEvent_Counter, portMAX_DELAY );
     halTOGGLE_LED( LED3 );
     }
 }
@@ -84,13 +72,12 @@ void main( void )
     prvSetupHardware();
 
     /* Create tasks */
-    if(xTaskCreate( prvTask1Function,
-                 "Task 1",
-                 configMINIMAL_STACK_SIZE,
-                 NULL,//no arguments
-                 mainTAKS_1_PRIO,
-                 NULL
+    /*Button events are handled by shared work queue worker, not own task*/
+    if(xWorkQueueCreateClass( mainBUTTON_WORK_CLASS,
+                 mainBUTTON_WORK_PRIO,
+                 4
                ) != pdPASS) while(1);
+    xHALButtonSubscribeWork(mainBUTTON_WORK_CLASS, prvButtonWork, NULL, HAL_BUTTON_EVENT_PRESS(HAL_BUTTON_SW3));
     if(xTaskCreate( prvTask2Function,
                  "Task 2",
                  configMINIMAL_STACK_SIZE,
@@ -106,9 +93,8 @@ void main( void )
                  NULL
                ) != pdPASS) while(1);
 
-    xEvent_Button = xSemaphoreCreateBinary();
-    xEvent_Button_Pressed= xSemaphoreCreateBinary();
-    xEvent_Counter =  xSemaphoreCreateBinary();
+    xEvent_Button = xSemaphoreCreateBinaryNotify();
+    xEvent_Counter =  xSemaphoreCreateBinaryNotify();
     /* Start the scheduler. */
     vTaskStartScheduler();
 
@@ -129,14 +115,7 @@ static void prvSetupHardware( void )
     hal430SetSystemClock( configCPU_CLOCK_HZ, configLFXT_CLOCK_HZ );
 
     /* Init buttons */
-    P1DIR &= ~0x30;
-    P1REN |= 0x30;
-    P1OUT |= 0x30;
-    /*Enable interrupt for pin connected to S3*/
-    P1IE  |= 0x10;
-    P1IFG &=~0x10;
-    /*Interrupt is generated during high to low transition*/
-    P1IES |= 0x10;
+    vHALButtonInit();
     /* initialize LEDs */
     vHALInitLED();
 
@@ -146,18 +125,3 @@ static void prvSetupHardware( void )
     HAL_7SEG_DISPLAY_2_ON;
     taskENABLE_INTERRUPTS();
 }
-void __attribute__ ( ( interrupt( PORT1_VECTOR  ) ) ) vPORT1ISR( void )
-{
-    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
-
-    /* Give semaphore if button SW3 is pressed*/
-    /* Note: This check is not truly necessary but it is good to
-     * have it*/
-    if((P1IFG & 0x10) == 0x10){
-        xSemaphoreGiveFromISR(xEvent_Button_Pressed, &xHigherPriorityTaskWoken);
-    }
-    /*Clear IFG register on exit. Read more about it in official MSP430F5529 documentation*/
-    P1IFG &=~0x10;
-    /* trigger scheduler if higher priority task is woken */
-    portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
-}
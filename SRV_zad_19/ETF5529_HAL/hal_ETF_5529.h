@@ -13,6 +13,14 @@ in order to use MSP-EXP430F5438 HAL.
 #include "hal_board.h"
 #include "hal_led.h"
 #include "hal_7seg.h"
+#include "hal_gpio.h"
+#include "hal_button.h"
+#include "hal_frame.h"
+#include "hal_clock.h"
+#include "hal_uart.h"
+#include "hal_hrtimer.h"
+#include "hal_cycles.h"
+#include "hal_latency.h"
 #include "../drivers/MSP430F5xx_6xx/pmm.h"
 #include "../drivers/MSP430F5xx_6xx/ucs.h"
 
@@ -0,0 +1,45 @@
+/**
+ * @file    hal_gpio.h
+ * @date    2021
+ * @brief   GPIO INTERRUPT API
+ *
+ * Port 1 and Port 2 interrupt dispatcher. Port ISRs read P1IV/P2IV,
+ * call handler registered for the pin which caused the interrupt and
+ * clear only that pin's flag, so edges on other pins are never lost.
+ */
+
+#include <stdint.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#ifndef HAL_GPIO_H_
+#define HAL_GPIO_H_
+
+/*Number of pins on one port*/
+#define HAL_GPIO_PINS_PER_PORT          8
+
+typedef enum{
+    HAL_GPIO_PORT_1 = 0,
+    HAL_GPIO_PORT_2 = 1
+}hal_gpio_port_t;
+
+typedef enum{
+    HAL_GPIO_EDGE_RISING    = 0,
+    HAL_GPIO_EDGE_FALLING   = 1
+}hal_gpio_edge_t;
+
+/*Pin interrupt handler, called from port ISR. Handler which unblocks task
+ *sets *pxHigherPriorityTaskWoken the same way FromISR API does. Port ISR
+ *stamps its entry for latency probe, handler can HAL_LATENCY_ISR_MARK*/
+typedef void ( *hal_gpio_handler_t )( void *pvParameter, BaseType_t *pxHigherPriorityTaskWoken );
+
+/*Register pin handler, configure interrupt edge and enable pin interrupt*/
+BaseType_t  xHALGPIORegisterHandler( hal_gpio_port_t ePort, uint8_t ucPin, hal_gpio_edge_t eEdge,
+                                     hal_gpio_handler_t pxHandler, void *pvParameter );
+/*Disable pin interrupt and remove its handler*/
+void        vHALGPIOUnregisterHandler( hal_gpio_port_t ePort, uint8_t ucPin );
+
+/*Ready-made handlers, pvParameter is TaskHandle_t or SemaphoreHandle_t*/
+void        vHALGPIONotifyGiveHandler( void *pvParameter, BaseType_t *pxHigherPriorityTaskWoken );
+void        vHALGPIOSemaphoreGiveHandler( void *pvParameter, BaseType_t *pxHigherPriorityTaskWoken );
+
+#endif /* HAL_GPIO_H_ */
@@ -0,0 +1,45 @@
+/**
+ * @file    hal_hrtimer.h
+ * @date    2021
+ * @brief   HIGH-RESOLUTION TIMER API
+ *
+ * Microsecond timeouts on Timer A1 compare channels, independent of
+ * the RTOS tick. TA1 runs continuously from SMCLK divided down to at
+ * most HAL_HRTIMER_MAX_COUNT_HZ, each channel fires its callback from
+ * the compare ISR, so a task can block for less than one tick without
+ * raising the tick rate.
+ */
+
+#include <stdint.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#ifndef HAL_HRTIMER_H_
+#define HAL_HRTIMER_H_
+
+/*Number of timeouts which can run at the same time, TA1 CCR0 to CCR2*/
+#define HAL_HRTIMER_CHANNELS            3
+/*Highest TA1 count rate, SMCLK is divided down to it*/
+#ifndef HAL_HRTIMER_MAX_COUNT_HZ
+#define HAL_HRTIMER_MAX_COUNT_HZ        1000000UL
+#endif
+/*Returned instead of channel when all channels are busy*/
+#define HAL_HRTIMER_NO_CHANNEL          ( ( BaseType_t ) -1 )
+
+/*Timeout callback, called from TA1 ISR. Callback which unblocks task
+ *sets *pxHigherPriorityTaskWoken the same way FromISR API does*/
+typedef void ( *hal_hrtimer_callback_t )( void *pvParameter, BaseType_t *pxHigherPriorityTaskWoken );
+
+/*Start TA1 and create semaphores used by xHALHRTimerDelay, call before scheduler starts*/
+BaseType_t  xHALHRTimerInit( void );
+/*Call pxCallback once after ulMicroseconds, returns channel or HAL_HRTIMER_NO_CHANNEL*/
+BaseType_t  xHALHRTimerStart( uint32_t ulMicroseconds, hal_hrtimer_callback_t pxCallback, void *pvParameter );
+/*Same as xHALHRTimerStart, must be called from ISR*/
+BaseType_t  xHALHRTimerStartFromISR( uint32_t ulMicroseconds, hal_hrtimer_callback_t pxCallback, void *pvParameter );
+/*Stop timeout before it expires, callback is not called afterwards*/
+void        vHALHRTimerCancel( BaseType_t xChannel );
+/*Block calling task for ulMicroseconds, pdFAIL if no channel was free*/
+BaseType_t  xHALHRTimerDelay( uint32_t ulMicroseconds );
+/*Current TA1 count rate, changes with SMCLK*/
+uint32_t    ulHALHRTimerGetCountHz( void );
+
+#endif /* HAL_HRTIMER_H_ */
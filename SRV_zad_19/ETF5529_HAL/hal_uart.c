@@ -0,0 +1,65 @@
+/**
+ * @file    hal_uart.c
+ * @date    2021
+ * @brief   UART API
+ *
+ * Low-frequency baud rate mode is used: UCBRx is integer part of
+ * SMCLK / baud rate and UCBRSx is fractional part rounded to eighths.
+ */
+
+#include "hal_uart.h"
+#include "hal_clock.h"
+#include "msp430.h"
+
+static uint32_t ulUARTBaudrate = 9600;
+
+static void prvUARTSetDivider( uint32_t ulSMCLKHz )
+{
+    uint16_t    usDivider   = ( uint16_t ) ( ulSMCLKHz / ulUARTBaudrate );
+    uint8_t     ucModulation;
+    uint8_t     ucInterrupts;
+
+    ucModulation = ( uint8_t ) ( ( ( ulSMCLKHz % ulUARTBaudrate ) * 8 + ulUARTBaudrate / 2 ) / ulUARTBaudrate );
+    if( ucModulation == 8 ){
+        usDivider++;
+        ucModulation = 0;
+    }
+
+    /* Software reset clears interrupt enable bits, keep them */
+    ucInterrupts = UCA1IE;
+    UCA1CTL1    |= UCSWRST;                      // **Put state machine in reset**
+    UCA1BRW      = usDivider;
+    UCA1MCTL     = ( ucModulation << 1 ) + UCBRF_0;
+    UCA1CTL1    &= ~UCSWRST;                     // **Initialize USCI state machine**
+    UCA1IE       = ucInterrupts;
+}
+
+static void prvUARTClockListener( uint32_t ulSMCLKHz, void *pvParameter )
+{
+    ( void ) pvParameter;
+    prvUARTSetDivider( ulSMCLKHz );
+}
+
+void vHALUARTInit( uint32_t ulBaudrate ){
+    ulUARTBaudrate = ulBaudrate;
+
+    P4SEL       |= BIT4+BIT5;                    // P4.4,5 = USCI_A1 TXD/RXD
+    UCA1CTL1    |= UCSWRST;                      // **Put state machine in reset**
+    UCA1CTL1    |= UCSSEL_2;                     // SMCLK
+    prvUARTSetDivider( ulHALClockGetFrequency() );
+    UCA1IE      |= UCRXIE;                       // Enable USCI_A1 RX interrupt
+
+    xHALClockRegisterListener( prvUARTClockListener, NULL );
+}
+
+void vHALUARTSetBaudrate( uint32_t ulBaudrate ){
+    ulUARTBaudrate = ulBaudrate;
+    prvUARTSetDivider( ulHALClockGetFrequency() );
+}
+
+void vHALUARTSendString( const char *pcString ){
+    while( *pcString != '\0' ){
+        while( !( UCA1IFG & UCTXIFG ) );
+        UCA1TXBUF = *pcString++;
+    }
+}
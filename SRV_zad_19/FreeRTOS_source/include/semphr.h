@@ -716,6 +716,45 @@ typedef QueueHandle_t SemaphoreHandle_t;
 	#define xSemaphoreCreateMutex() xQueueCreateMutex( queueQUEUE_TYPE_MUTEX )
 #endif
 
+/**
+ * semphr. h
+ * <pre>SemaphoreHandle_t xSemaphoreCreateMutexCeiling( UBaseType_t uxCeilingPriority );</pre>
+ *
+ * Creates a mutex that uses the immediate priority ceiling protocol instead of
+ * priority inheritance.  configUSE_CEILING_MUTEXES must be set to 1 in
+ * FreeRTOSConfig.h for this macro to be available.
+ *
+ * The task that takes the mutex is immediately raised to uxCeilingPriority and
+ * is restored to its previous priority when it gives the mutex back.  The
+ * ceiling must be at least the priority of the highest priority task that
+ * ever takes the mutex.  Because the holder then runs at the ceiling, no other
+ * user of the mutex can run while it is held, so a take never blocks, the
+ * holder's priority is never changed while it holds the mutex, and a task is
+ * delayed by at most one critical section of lower priority tasks.
+ *
+ * The holder must not block while holding the mutex.  A task that finds a
+ * ceiling mutex held (which is only possible if the ceiling is set too low or
+ * the holder blocked) fails configASSERT(), and the take returns pdFALSE
+ * without blocking.  Nested ceiling mutexes must be given back in the reverse
+ * order to that in which they were taken.
+ *
+ * Mutexes created using this function are accessed using the xSemaphoreTake()
+ * and xSemaphoreGive() macros, and cannot be used from interrupts.
+ *
+ * @param uxCeilingPriority The priority of the highest priority task that uses
+ * the mutex.  Must be greater than zero and less than configMAX_PRIORITIES.
+ *
+ * @return If the mutex was successfully created then a handle to the created
+ * mutex is returned.  If there was not enough heap to allocate the mutex
+ * data structures then NULL is returned.
+ *
+ * \defgroup xSemaphoreCreateMutexCeiling xSemaphoreCreateMutexCeiling
+ * \ingroup Semaphores
+ */
+#if( ( configUSE_CEILING_MUTEXES == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+	#define xSemaphoreCreateMutexCeiling( uxCeilingPriority ) xQueueCreateMutexCeiling( ( uxCeilingPriority ) )
+#endif
+
 /**
  * semphr. h
  * <pre>SemaphoreHandle_t xSemaphoreCreateMutexStatic( StaticSemaphore_t *pxMutexBuffer )</pre>
@@ -1135,6 +1174,112 @@ typedef QueueHandle_t SemaphoreHandle_t;
  */
 #define uxSemaphoreGetCount( xSemaphore ) uxQueueMessagesWaiting( ( QueueHandle_t ) ( xSemaphore ) )
 
+#if( configUSE_NOTIFY_SEMAPHORES == 1 )
+
+/**
+ * semphr. h
+ * <pre>NotifySemaphoreHandle_t xSemaphoreCreateBinaryNotify( void );</pre>
+ *
+ * Creates a binary semaphore that is implemented on the task notification
+ * value of the single task that takes it, rather than on a queue.  Giving and
+ * taking it is considerably faster than giving and taking a semaphore created
+ * by xSemaphoreCreateBinary(), and it needs only a few bytes of RAM.
+ *
+ * The restriction is that only one task may ever take the semaphore.  The
+ * first task that calls xSemaphoreNotifyTake() becomes the owner, an attempt
+ * by any other task to take it fails configASSERT().  The owner must not use
+ * its notification value for anything else.  Any number of tasks and
+ * interrupts may give the semaphore.
+ *
+ * The semaphore is created in the 'empty' state, gives made before the owner
+ * first takes the semaphore are not lost.
+ *
+ * @return Handle to the created semaphore, or NULL if there was not enough
+ * heap available.
+ *
+ * \defgroup xSemaphoreCreateBinaryNotify xSemaphoreCreateBinaryNotify
+ * \ingroup Semaphores
+ */
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+	#define xSemaphoreCreateBinaryNotify() xTaskNotifySemaphoreCreate( ( UBaseType_t ) 1, ( UBaseType_t ) 0 )
+#endif
+
+/**
+ * semphr. h
+ * <pre>NotifySemaphoreHandle_t xSemaphoreCreateCountingNotify( UBaseType_t uxMaxCount, UBaseType_t uxInitialCount );</pre>
+ *
+ * Counting version of xSemaphoreCreateBinaryNotify(), with the same single
+ * taker restriction.
+ *
+ * @param uxMaxCount The maximum count value that can be reached.
+ *
+ * @param uxInitialCount The count value assigned to the semaphore when it is
+ * created.
+ *
+ * @return Handle to the created semaphore, or NULL if there was not enough
+ * heap available.
+ *
+ * \defgroup xSemaphoreCreateCountingNotify xSemaphoreCreateCountingNotify
+ * \ingroup Semaphores
+ */
+#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+	#define xSemaphoreCreateCountingNotify( uxMaxCount, uxInitialCount ) xTaskNotifySemaphoreCreate( ( uxMaxCount ), ( uxInitialCount ) )
+#endif
+
+/**
+ * semphr. h
+ * <pre>BaseType_t xSemaphoreNotifyTake( NotifySemaphoreHandle_t xSemaphore, TickType_t xBlockTime );</pre>
+ *
+ * Take a notification semaphore, see xSemaphoreTake().  Must only ever be
+ * called by one task.
+ *
+ * @return pdTRUE if the semaphore was obtained.  pdFALSE if xBlockTime
+ * expired without the semaphore becoming available.
+ *
+ * \defgroup xSemaphoreNotifyTake xSemaphoreNotifyTake
+ * \ingroup Semaphores
+ */
+#define xSemaphoreNotifyTake( xSemaphore, xBlockTime ) xTaskNotifySemaphoreTake( ( xSemaphore ), ( xBlockTime ) )
+
+/**
+ * semphr. h
+ * <pre>BaseType_t xSemaphoreNotifyGive( NotifySemaphoreHandle_t xSemaphore );</pre>
+ *
+ * Give a notification semaphore, see xSemaphoreGive().
+ *
+ * @return pdTRUE if the semaphore was given.  pdFALSE if the count was
+ * already at its maximum value.
+ *
+ * \defgroup xSemaphoreNotifyGive xSemaphoreNotifyGive
+ * \ingroup Semaphores
+ */
+#define xSemaphoreNotifyGive( xSemaphore ) xTaskNotifySemaphoreGive( ( xSemaphore ) )
+
+/**
+ * semphr. h
+ * <pre>BaseType_t xSemaphoreNotifyGiveFromISR( NotifySemaphoreHandle_t xSemaphore, BaseType_t *pxHigherPriorityTaskWoken );</pre>
+ *
+ * Interrupt safe version of xSemaphoreNotifyGive(), see
+ * xSemaphoreGiveFromISR().
+ *
+ * @return pdTRUE if the semaphore was given.  pdFALSE if the count was
+ * already at its maximum value.
+ *
+ * \defgroup xSemaphoreNotifyGiveFromISR xSemaphoreNotifyGiveFromISR
+ * \ingroup Semaphores
+ */
+#define xSemaphoreNotifyGiveFromISR( xSemaphore, pxHigherPriorityTaskWoken ) xTaskNotifySemaphoreGiveFromISR( ( xSemaphore ), ( pxHigherPriorityTaskWoken ) )
+
+/**
+ * semphr.h
+ * <pre>UBaseType_t uxSemaphoreNotifyGetCount( NotifySemaphoreHandle_t xSemaphore );</pre>
+ *
+ * Returns the current count of a notification semaphore.
+ */
+#define uxSemaphoreNotifyGetCount( xSemaphore ) uxTaskNotifySemaphoreGetCount( ( xSemaphore ) )
+
+#endif /* configUSE_NOTIFY_SEMAPHORES */
+
 #endif /* SEMAPHORE_H */
 
 
@@ -39,15 +39,37 @@
 	.def vPortPreemptiveTickISR
 	.def vPortCooperativeTickISR
 	.def vPortYield
+	.def vPortYieldFullFrame
 	.def xPortStartScheduler
 
 ;-----------------------------------------------------------
 
+; Set in the stacked critical nesting count of a full frame.  Must match
+; portFULL_CONTEXT_FRAME in port.c.
+portFULL_FRAME	.set	08000h
+
+;-----------------------------------------------------------
+
+; A full frame holds r4 to r15, for switches that can interrupt a task between
+; any two instructions.
 portSAVE_CONTEXT .macro
 
 	;Save the remaining registers.
 	pushm_x	#12, r15
 	mov.w	&usCriticalNesting, r14
+	bis.w	#portFULL_FRAME, r14
+	push_x r14
+	mov_x	&pxCurrentTCB, r12
+	mov_x	sp, 0( r12 )
+	.endm
+;-----------------------------------------------------------
+
+; A reduced frame only holds r4 to r10.  r11 to r15 are save on call registers,
+; so they are already dead when a task calls vPortYield().
+portSAVE_REDUCED_CONTEXT .macro
+
+	pushm_x	#7, r10
+	mov.w	&usCriticalNesting, r14
 	push_x r14
 	mov_x	&pxCurrentTCB, r12
 	mov_x	sp, 0( r12 )
@@ -59,8 +81,16 @@ portRESTORE_CONTEXT .macro
 	mov_x	&pxCurrentTCB, r12
 	mov_x	@r12, sp
 	pop_x	r15
+	popm_x	#7, r10
+	bit.w	#portFULL_FRAME, r15
+	jz		reduced_frame?
+	bic.w	#portFULL_FRAME, r15
 	mov.w	r15, &usCriticalNesting
-	popm_x	#12, r15
+	popm_x	#5, r15
+	jmp		restore_sr?
+reduced_frame?:
+	mov.w	r15, &usCriticalNesting
+restore_sr?:
 	nop
 	pop.w	sr
 	nop
@@ -125,8 +155,10 @@ vPortYield: .asmfunc
 	dint
 	nop
 
-	; Save the context of the current task.
-	portSAVE_CONTEXT
+	; Save the context of the current task.  This is also called from
+	; interrupts by portYIELD_FROM_ISR(), in which case the interrupt function
+	; has already stacked the save on call registers of the interrupted task.
+	portSAVE_REDUCED_CONTEXT
 
 	; Select the next task to run.
 	call_x	#vTaskSwitchContext
@@ -136,6 +168,24 @@ vPortYield: .asmfunc
 	.endasmfunc
 ;-----------------------------------------------------------
 
+;
+; Same as vPortYield() but saves a full frame, as every yield did before the
+; reduced frame.  Only there to measure what the reduced frame saves.
+;
+
+	.align 2
+
+vPortYieldFullFrame: .asmfunc
+
+	push.w	sr
+	dint
+	nop
+	portSAVE_CONTEXT
+	call_x	#vTaskSwitchContext
+	portRESTORE_CONTEXT
+	.endasmfunc
+;-----------------------------------------------------------
+
 
 ;
 ; Start off the scheduler by initialising the RTOS tick timer, then restoring
@@ -79,6 +79,69 @@ typedef unsigned short UBaseType_t;
 /* Critical section control macros. */
 #define portNO_CRITICAL_SECTION_NESTING		( ( uint16_t ) 0 )
 
+#ifndef configUSE_SELECTIVE_CRITICAL_SECTIONS
+	#define configUSE_SELECTIVE_CRITICAL_SECTIONS	0
+#endif
+
+/* Interrupt sources passed to vPortModifyKernelIE(). */
+#define portKERNEL_IE_P1					( ( UBaseType_t ) 0 )
+#define portKERNEL_IE_P2					( ( UBaseType_t ) 1 )
+#define portKERNEL_IE_ADC12					( ( UBaseType_t ) 2 )
+#define portKERNEL_IE_UCA1					( ( UBaseType_t ) 3 )
+#define portKERNEL_IE_TA1					( ( UBaseType_t ) 4 )
+#define portKERNEL_IE_TB0					( ( UBaseType_t ) 5 )
+
+/* Set and clear interrupt enable bits of a kernel aware source.  Code that
+changes P1IE, P2IE, ADC12IE, UCA1IE or the CCIE bits of Timer A1 or Timer B0
+from inside a critical section must use this, as those registers are masked
+while selective critical sections are active.  For portKERNEL_IE_TA1 and
+portKERNEL_IE_TB0 bit n of the masks stands for CCIE of TA1CCTLn or TB0CCTLn. */
+void vPortModifyKernelIE( UBaseType_t uxSource, uint16_t usBitsToClear, uint16_t usBitsToSet );
+
+#if( configUSE_SELECTIVE_CRITICAL_SECTIONS == 1 )
+
+	/* Critical sections only clear the interrupt enable bits of the sources
+	that call the kernel - the tick (TA0 CCR0) and the bits selected by the
+	masks below - instead of clearing GIE, so other interrupts keep their
+	latency.  Interrupts left enabled must never call the FreeRTOS API, with
+	the one exception of xSeqLockRead(), as seqlock writers hold off all
+	interrupts with the mask below. */
+	#ifndef configKERNEL_P1IE_MASK
+		#define configKERNEL_P1IE_MASK		0xFF
+	#endif
+	#ifndef configKERNEL_P2IE_MASK
+		#define configKERNEL_P2IE_MASK		0xFF
+	#endif
+	#ifndef configKERNEL_ADC12IE_MASK
+		#define configKERNEL_ADC12IE_MASK	0xFFFF
+	#endif
+	#ifndef configKERNEL_UCA1IE_MASK
+		#define configKERNEL_UCA1IE_MASK	0xFF
+	#endif
+	#ifndef configKERNEL_TA1CCIE_MASK
+		#define configKERNEL_TA1CCIE_MASK	0x07
+	#endif
+	#ifndef configKERNEL_TB0CCIE_MASK
+		#define configKERNEL_TB0CCIE_MASK	0x7F
+	#endif
+	#if( ( ( configKERNEL_TA1CCIE_MASK ) & ~0x07 ) != 0 ) || ( ( ( configKERNEL_TB0CCIE_MASK ) & ~0x7F ) != 0 )
+		#error configKERNEL_TA1CCIE_MASK and configKERNEL_TB0CCIE_MASK can only select existing capture/compare registers
+	#endif
+
+	void vPortEnterCritical( void );
+	void vPortExitCritical( void );
+	#define portENTER_CRITICAL()	vPortEnterCritical()
+	#define portEXIT_CRITICAL()		vPortExitCritical()
+
+	/* Clear GIE and return whether it was set, so code that interrupts left
+	enabled above may run into can hold them off too. */
+	UBaseType_t uxPortSetAllInterruptMask( void );
+	void vPortClearAllInterruptMask( UBaseType_t uxSavedStatus );
+	#define portSET_ALL_INTERRUPT_MASK()		uxPortSetAllInterruptMask()
+	#define portCLEAR_ALL_INTERRUPT_MASK( x )	vPortClearAllInterruptMask( x )
+
+#else
+
 #define portENTER_CRITICAL()													\
 {																				\
 extern volatile uint16_t usCriticalNesting;										\
@@ -108,6 +171,8 @@ extern volatile uint16_t usCriticalNesting;										\
 		}																		\
 	}																			\
 }
+
+#endif /* configUSE_SELECTIVE_CRITICAL_SECTIONS */
 /*-----------------------------------------------------------*/
 
 /* Task utilities. */
@@ -116,7 +181,21 @@ extern volatile uint16_t usCriticalNesting;										\
  * Manual context switch called by portYIELD or taskYIELD.
  */
 extern void vPortYield( void );
-#define portYIELD() vPortYield()
+
+/*
+ * vPortYield() saving the full frame an interrupt saves, for benchmarks of the
+ * reduced frame only.
+ */
+extern void vPortYieldFullFrame( void );
+#if( configUSE_SELECTIVE_CRITICAL_SECTIONS == 1 )
+	/* A task can yield inside a critical section, the kernel aware interrupts
+	must be unmasked for the task switched in and masked again when the
+	yielding task resumes. */
+	extern void vPortYieldFromTask( void );
+	#define portYIELD() vPortYieldFromTask()
+#else
+	#define portYIELD() vPortYield()
+#endif
 /*-----------------------------------------------------------*/
 
 /* Hardware specifics. */
@@ -124,6 +203,12 @@ extern void vPortYield( void );
 #define portSTACK_GROWTH			( -1 )
 #define portTICK_PERIOD_MS			( ( TickType_t ) 1000 / configTICK_RATE_HZ )
 #define portNOP()					__no_operation()
+
+/* Runs first in the C body of the tick interrupt, after the compiler prologue
+has pushed the save on call registers and before the context is saved. */
+#ifndef configTICK_ISR_ENTRY_HOOK
+	#define configTICK_ISR_ENTRY_HOOK()
+#endif
 /*-----------------------------------------------------------*/
 
 /* Task function macros as described on the FreeRTOS.org WEB site. */
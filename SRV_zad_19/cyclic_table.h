@@ -0,0 +1,23 @@
+/* Generated by host/cyclic_table from cyclic_jobs.txt, do not edit. */
+
+#ifndef CYCLIC_TABLE_H
+#define CYCLIC_TABLE_H
+
+/* Periods and offsets in minor frames, job table must list jobs in this order */
+#define tableDISPLAY_PERIOD             ( 1 )
+#define tableDISPLAY_OFFSET             ( 0 )
+#define tableADC_PERIOD                 ( 40 )
+#define tableADC_OFFSET                 ( 0 )
+#define tableJOBS                       ( 2 )
+#define tableFRAMES                     ( 40 )
+
+/* Bit n of entry f is set if job n runs in minor frame f */
+static const UBaseType_t puxCyclicTable[ tableFRAMES ] = {
+    0x0003, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001,
+    0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001, 0x0001
+};
+
+#endif /* CYCLIC_TABLE_H */
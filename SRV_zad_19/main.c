@@ -15,85 +15,83 @@
 #include "task.h"
 #include "semphr.h"
 #include "queue.h"
+#include "seqlock.h"
+#include "workqueue.h"
+#include "cyclic.h"
 
 /* Hardware includes. */
 #include "msp430.h"
 
 /* User's includes */
 #include "../common/ETF5529_HAL/hal_ETF_5529.h"
-
-/** "Display task" priority */
-#define mainDISPLAY_TASK_PRIO           ( 1 )
-/** "ADC task" priority */
-#define mainADC_TASK_PRIO               ( 2 )
-#define mainBUTTON_TASK_PRIO               ( 3 )
-
-/* Display queue parameters value*/
-/* Queue with length 1 is mailbox*/
-#define mainDISPLAY_QUEUE_LENGTH            1
+/* Schedule table generated from cyclic_jobs.txt, ADC every 40 minor frames
+ * (200 sys-ticks) */
+#include "cyclic_table.h"
+
+/** Cyclic executive dispatcher priority, runs display and ADC jobs */
+#define mainCYCLIC_PRIO                 ( 4 )
+/** Minor frame length, one display digit is shown per frame */
+#define mainMINOR_FRAME_TICKS           ( 5 )
+/** Button work queue class and its worker priority */
+#define mainBUTTON_WORK_CLASS           ( 0 )
+#define mainBUTTON_WORK_PRIO            ( 3 )
 
 static void prvSetupHardware( void );
 
-/* This queue will be used to send data to display task*/
-xQueueHandle        xDisplayMailbox;
-/* This semaphore will be used to signal "Button press" event*/
-xSemaphoreHandle    xEvent_Button;
+/* Latest scaled ADC value, written by ADC ISR and read by display and button
+ * tasks without blocking*/
+SeqLock_t           xDisplayValue;
 /**
- * @brief "Display Task" Function
+ * @brief Button work function
  *
- * This task read data from xDisplayQueue but reading is not blocking.
- * xDisplayQueue is used to send data which will be printed on 7Seg
- * display. After data is received it is decomposed on high and low digit.
+ * Run by button work queue worker for each debounced SW3 press.
  */
-
-static void prvTask2Function( void *pvParameters )
+static void prvButtonWork( void *pvParameter, uint32_t buttonEvents )
 {
-    uint16_t i;
-    /*Initial button states are 1 because of pull-up configuration*/
-    uint8_t     currentButtonState  = 1;
     /* New received 8bit data */
     uint8_t         NewValueToShow      = 0;
     /* High and Low number digit*/
     uint8_t         digitLow, digitHigh;
-    for(;;){
-        xSemaphoreTake(xEvent_Button,portMAX_DELAY);
-        /*wait for a little to check that button is still pressed*/
-        for(i = 0; i < 1000; i++);
-        /*take button state*/
-        currentButtonState = ((P1IN & 0x10) >> 4);
-        if(currentButtonState == 0){
-            /* If button is still pressed send signal to "Diode" task */
-            /* Check if new number is received*/
-            if(xQueuePeek(xDisplayMailbox, &NewValueToShow, 0) == pdTRUE){
-                     /* If there is new number to show on display, split it on High and Low digit */
-                     /* Extract high digit*/
-                     digitHigh = NewValueToShow/10;
-                     /* Extract low digit*/
-                     digitLow = NewValueToShow - digitHigh*10;
+    if(buttonEvents & HAL_BUTTON_EVENT_PRESS(HAL_BUTTON_SW3)){
+        /* If button is pressed send value over UART */
+        /* Check if new number is received*/
+        if(xSeqLockRead(&xDisplayValue, &NewValueToShow) == pdTRUE){
+                 /* If there is new number to show on display, split it on High and Low digit */
+                 /* Extract high digit*/
+                 digitHigh = NewValueToShow/10;
+                 /* Extract low digit*/
+                 digitLow = NewValueToShow - digitHigh*10;
 
 
 
 
-                 UCA1TXBUF = digitHigh+ 48;
-                 while(!(UCA1IFG&UCTXIFG));
-                 UCA1TXBUF = digitLow+48;
+             UCA1TXBUF = digitHigh+ 48;
+             while(!(UCA1IFG&UCTXIFG));
+             UCA1TXBUF = digitLow+48;
 
-            }
         }
     }
-
 }
 
-static void prvDisplayTaskFunction( void *pvParameters )
+/**
+ * @brief "Display Job" Function
+ *
+ * Run by cyclic executive every minor frame, shows low and high digit in
+ * turn. Latest value is read without blocking when low digit is shown and
+ * decomposed on high and low digit.
+ */
+static void prvDisplayJob( void *pvParameter )
 {
     /* New received 8bit data */
-    uint8_t         NewValueToShow      = 0;
+    static uint8_t  NewValueToShow      = 0;
     /* High and Low number digit*/
-    uint8_t         digitLow, digitHigh;
-    for ( ;; )
-    {
+    static uint8_t  digitLow = 0, digitHigh = 0;
+    /* Digit shown in this frame*/
+    static uint8_t  showHigh = 0;
+
+    if(showHigh == 0){
         /* Check if new number is received*/
-        if(xQueuePeek(xDisplayMailbox, &NewValueToShow, 0) == pdTRUE){
+        if(xSeqLockRead(&xDisplayValue, &NewValueToShow) == pdTRUE){
             /* If there is new number to show on display, split it on High and Low digit */
             /* Extract high digit*/
             digitHigh = NewValueToShow/10;
@@ -103,29 +101,32 @@ static void prvDisplayTaskFunction( void *pvParameters )
         HAL_7SEG_DISPLAY_1_ON;
         HAL_7SEG_DISPLAY_2_OFF;
         vHAL7SEGWriteDigit(digitLow);
-        vTaskDelay(5);
+    }
+    else{
         HAL_7SEG_DISPLAY_2_ON;
         HAL_7SEG_DISPLAY_1_OFF;
         vHAL7SEGWriteDigit(digitHigh);
-        vTaskDelay(5);
     }
+    showHigh ^= 1;
 }
 
 /**
- * @brief "ADC Task" Function
+ * @brief "ADC Job" Function
  *
- * This task periodically, with 200 sys-tick period, trigger ADC
+ * Run by cyclic executive every tableADC_PERIOD minor frames, trigger ADC
  */
-static void prvADCTaskFunction( void *pvParameters )
+static void prvADCJob( void *pvParameter )
 {
-
-    for ( ;; )
-    {
-       /*Trigger ADC Conversion*/
-       ADC12CTL0 |= ADC12SC;
-       vTaskDelay(200);
-    }
+    /*Trigger ADC Conversion*/
+    ADC12CTL0 |= ADC12SC;
 }
+
+/* Periodic jobs, in the order of cyclic_jobs.txt*/
+static const CyclicJob_t xJobTable[ tableJOBS ] = {
+    cyclicJOB( prvDisplayJob, NULL, tableDISPLAY_PERIOD, tableDISPLAY_OFFSET ),
+    cyclicJOB( prvADCJob, NULL, tableADC_PERIOD, tableADC_OFFSET )
+};
+
 /**
  * @brief main function
  */
@@ -135,31 +136,22 @@ void main( void )
     prvSetupHardware();
 
     /* Create tasks */
-    xTaskCreate( prvDisplayTaskFunction,
-                 "Display Task",
-                 configMINIMAL_STACK_SIZE,
-                 NULL,
-                 mainDISPLAY_TASK_PRIO,
-                 NULL
+    /* Display multiplexing and ADC triggering run from one cyclic executive*/
+    xCyclicExecutiveStartFromTable( xJobTable,
+                 tableJOBS,
+                 puxCyclicTable,
+                 tableFRAMES,
+                 mainMINOR_FRAME_TICKS,
+                 mainCYCLIC_PRIO
                );
-    xTaskCreate( prvADCTaskFunction,
-                 "ADC Task",
-                 configMINIMAL_STACK_SIZE,
-                 NULL,
-                 mainADC_TASK_PRIO,
-                 NULL
-               );
-    xTaskCreate(prvTask2Function,
-                "Button task",
-                configMINIMAL_STACK_SIZE,
-                NULL,
-                mainBUTTON_TASK_PRIO,
-                NULL
+    /* Button events are handled by shared work queue worker*/
+    xWorkQueueCreateClass(mainBUTTON_WORK_CLASS,
+                mainBUTTON_WORK_PRIO,
+                4
                 );
+    xHALButtonSubscribeWork(mainBUTTON_WORK_CLASS, prvButtonWork, NULL, HAL_BUTTON_EVENT_PRESS(HAL_BUTTON_SW3));
     /* Create FreeRTOS objects  */
-    xDisplayMailbox       =   xQueueCreate(mainDISPLAY_QUEUE_LENGTH,sizeof(uint8_t));
-    /* Create semaphores        */
-    xEvent_Button           =   xSemaphoreCreateBinary();
+    vSeqLockInit(&xDisplayValue, sizeof(uint8_t));
     /* Start the scheduler. */
     vTaskStartScheduler();
 
@@ -183,16 +175,7 @@ static void prvSetupHardware( void )
     hal430SetSystemClock( configCPU_CLOCK_HZ, configLFXT_CLOCK_HZ );
 
     /* - Init buttons - */
-    /*Set direction to input*/
-    P1DIR &= ~0x10;
-    /*Enable pull-up resistor*/
-    P1REN |= 0x10;
-    P1OUT |= 0x10;
-    /*Enable interrupt for pin connected to S3*/
-    P1IE  |= 0x10;
-    P1IFG &=~0x10;
-    /*Interrupt is generated during high to low transition*/
-    P1IES |= 0x10;
+    vHALButtonInit();
 
     /*Initialize ADC */
     ADC12CTL0      = ADC12SHT02 + ADC12ON;       // Sampling time, ADC12 on
@@ -203,14 +186,7 @@ static void prvSetupHardware( void )
     P6SEL          |= 0x01;                      // P6.0 ADC option select
 
     /* Initialize UART */
-
-         P4SEL       |= BIT4+BIT5;                    // P4.4,5 = USCI_AA TXD/RXD
-         UCA1CTL1    |= UCSWRST;                      // **Put state machine in reset**
-         UCA1CTL1    |= UCSSEL_2;                     // SMCLK
-         UCA1BRW      = 1041;                         // 1MHz 115200
-         UCA1MCTL    |= UCBRS_6 + UCBRF_0;            // Modulation UCBRSx=1, UCBRFx=0
-         UCA1CTL1    &= ~UCSWRST;                     // **Initialize USCI state machine**
-         UCA1IE      |= UCRXIE;                       // Enable USCI_A1 RX interrupt
+    vHALUARTInit( 9600 );
 
     /* initialize LEDs */
     vHALInitLED();
@@ -221,8 +197,7 @@ static void prvSetupHardware( void )
 }
 void __attribute__ ( ( interrupt( ADC12_VECTOR  ) ) ) vADC12ISR( void )
 {
-    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
-    uint16_t    temp;
+    uint8_t     temp;
     switch(__even_in_range(ADC12IV,34))
     {
         case  0: break;                           // Vector  0:  No interrupt
@@ -231,7 +206,7 @@ void __attribute__ ( ( interrupt( ADC12_VECTOR  ) ) ) vADC12ISR( void )
         case  6:                                  // Vector  6:  ADC12IFG0
             /* Scaling ADC value to fit on two digits representation*/
             temp    = ADC12MEM0>>6;
-            xQueueOverwriteFromISR(xDisplayMailbox,&temp,&xHigherPriorityTaskWoken);
+            vSeqLockWriteFromISR(&xDisplayValue,&temp);
             break;
         case  8:                                  // Vector  8:  ADC12IFG1
             break;
@@ -250,21 +225,5 @@ void __attribute__ ( ( interrupt( ADC12_VECTOR  ) ) ) vADC12ISR( void )
         case 34: break;                           // Vector 34:  ADC12IFG14
         default: break;
     }
-    /* trigger scheduler if higher priority task is woken */
-    portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
-}
-void __attribute__ ( ( interrupt( PORT1_VECTOR  ) ) ) vPORT1ISR( void )
-{
-    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
-
-    /* Give semaphore if button SW3 is pressed*/
-    /* Note: This check is not truly necessary but it is good to
-     * have it*/
-    if((P1IFG & 0x10) == 0x10 ){
-        xSemaphoreGiveFromISR(xEvent_Button, &xHigherPriorityTaskWoken);
-    }
-    /*Clear IFG register on exit. Read more about it in official MSP430F5529 documentation*/
-    P1IFG &=~0x10;
-    /* trigger scheduler if higher priority task is woken */
-    portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
+    /* Readers poll the value, no task is woken */
 }
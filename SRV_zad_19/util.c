@@ -26,7 +26,8 @@
  */
 void vApplicationTickHook( void )
 {
-    ;
+    /* Sample and debounce buttons */
+    vHALButtonTickHook();
 }
 
 /**
@@ -12,5 +12,6 @@
  */
 extern void halBoardInit(void);
 void hal430SetSystemClock(unsigned long req_clock_rate, unsigned long ref_clock_rate);
+unsigned short hal430GetVCoreLevel(unsigned long clock_rate_khz);
 
 #endif /* HAL_BOARD_H */
@@ -0,0 +1,25 @@
+/**
+ * @file    hal_cobs.h
+ * @date    2021
+ * @brief   COBS AND CRC-16 API
+ *
+ * Consistent Overhead Byte Stuffing and CRC-16/CCITT helpers used by the
+ * UART frame protocol. No hardware or kernel dependencies, so the same
+ * code can be built on host to encode frames for the board.
+ */
+
+#include <stdint.h>
+#ifndef HAL_COBS_H_
+#define HAL_COBS_H_
+
+/*Worst case size of COBS encoded block of usLength bytes*/
+#define HAL_COBS_MAX_ENCODED( usLength )    ( ( usLength ) + ( ( usLength ) / 254 ) + 1 )
+
+/*CRC-16/CCITT (polynomial 0x1021, initial value 0xFFFF)*/
+uint16_t    usHALCRC16( const uint8_t *pucData, uint16_t usLength );
+/*Encode block, result contains no zero bytes and no delimiter*/
+uint16_t    usHALCOBSEncode( const uint8_t *pucIn, uint16_t usLength, uint8_t *pucOut );
+/*Decode block without delimiter, returns 0 for malformed input. pucOut can be pucIn*/
+uint16_t    usHALCOBSDecode( const uint8_t *pucIn, uint16_t usLength, uint8_t *pucOut );
+
+#endif /* HAL_COBS_H_ */
@@ -0,0 +1,16 @@
+/**
+ * @file    hal_cycles.c
+ * @date    2021
+ * @brief   CYCLE COUNTER API
+ *
+ * TB0 is clocked from SMCLK without divider. SMCLK is synchronous to
+ * MCLK, so TB0R can be read without majority vote.
+ */
+
+#include "hal_cycles.h"
+
+void vHALCyclesInit( void ){
+    TB0CTL  = TBSSEL_2 + MC_0;                   // SMCLK, stopped
+    TB0CTL |= TBCLR;                             // clear counter and divider
+    TB0CTL |= MC_2;                              // continuous mode, 16-bit
+}
@@ -0,0 +1,25 @@
+/**
+ * @file    hal_cycles.h
+ * @date    2021
+ * @brief   CYCLE COUNTER API
+ *
+ * Timer B0 counts SMCLK cycles in continuous mode, so differences of
+ * two readings are CPU cycles as long as SMCLK runs at MCLK frequency.
+ * The counter is 16-bit and wraps every 65536 cycles, differences are
+ * only valid for intervals shorter than that.
+ */
+
+#include <stdint.h>
+#include "msp430.h"
+#ifndef HAL_CYCLES_H_
+#define HAL_CYCLES_H_
+
+/*Current cycle count, one register read*/
+#define HAL_CYCLES_NOW()                ( ( uint16_t ) TB0R )
+/*Cycles elapsed since usStart*/
+#define HAL_CYCLES_SINCE( usStart )     ( ( uint16_t ) ( HAL_CYCLES_NOW() - ( usStart ) ) )
+
+/*Start TB0 from SMCLK, TB0 compare channels stay free for users*/
+void        vHALCyclesInit( void );
+
+#endif /* HAL_CYCLES_H_ */
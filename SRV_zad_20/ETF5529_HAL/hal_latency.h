@@ -0,0 +1,87 @@
+/**
+ * @file    hal_latency.h
+ * @date    2021
+ * @brief   INTERRUPT TO TASK LATENCY PROBE
+ *
+ * Measures the time from entry of an ISR to the first instruction of
+ * the task it wakes, after its xSemaphoreTake, ulTaskNotifyTake or
+ * xTaskNotifyWait returns. ISR entry is stamped by a software capture
+ * of the cycle counter into TB0 CCR6, the task stamps TB0R directly.
+ * Each ISR-task pair keeps min, mean, max and a histogram of latencies
+ * in cycles. With configUSE_LATENCY_PROBE 0 all macros below expand to
+ * nothing and no code or data is left.
+ *
+ * Usage:
+ *  ISR:  HAL_LATENCY_ISR_ENTRY() first, HAL_LATENCY_ISR_MARK( pair )
+ *        where the task is given the semaphore or notification
+ *  Task: HAL_LATENCY_TASK_RESUMED( pair ) right after take returns
+ */
+
+#include <stdint.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#include "hal_cycles.h"
+#ifndef HAL_LATENCY_H_
+#define HAL_LATENCY_H_
+
+#ifndef configUSE_LATENCY_PROBE
+#define configUSE_LATENCY_PROBE         0
+#endif
+
+/*Number of ISR-task pairs, pair is index 0 to HAL_LATENCY_MAX_PAIRS-1*/
+#ifndef HAL_LATENCY_MAX_PAIRS
+#define HAL_LATENCY_MAX_PAIRS           4
+#endif
+/*Number of histogram bins, the last one counts all longer latencies*/
+#ifndef HAL_LATENCY_BINS
+#define HAL_LATENCY_BINS                8
+#endif
+/*Width of one histogram bin is 2^HAL_LATENCY_BIN_SHIFT cycles*/
+#ifndef HAL_LATENCY_BIN_SHIFT
+#define HAL_LATENCY_BIN_SHIFT           7
+#endif
+
+#if( configUSE_LATENCY_PROBE == 1 )
+
+/*Writing CCIS0 switches capture input between GND and VCC, the edge
+ *captures TB0R into TB0CCR6. The ISR prologue generated by the compiler
+ *runs before it, so samples miss the registers it pushes plus the 6
+ *cycle interrupt acceptance. FreeRTOSConfig.h puts it into tick ISR,
+ *after a PUSHM of r11 to r15: 7 cycles, 12 in large data model*/
+#define HAL_LATENCY_ISR_ENTRY()         ( TB0CCTL6 ^= CCIS0 )
+#define HAL_LATENCY_ISR_MARK( ucPair )  vHALLatencyISRMark( ucPair )
+/*TB0R is read before the call, so call overhead is not counted*/
+#define HAL_LATENCY_TASK_RESUMED( ucPair )  vHALLatencyTaskResumed( ( ucPair ), HAL_CYCLES_NOW() )
+#define HAL_LATENCY_INIT()              vHALLatencyInit()
+
+typedef struct{
+    uint16_t    usCount;                         // samples, saturates
+    uint16_t    usMin;                           // cycles
+    uint16_t    usMean;                          // cycles, set by vHALLatencyGetStats
+    uint16_t    usMax;                           // cycles
+    uint32_t    ulSum;                           // cycles
+    uint16_t    pusHistogram[ HAL_LATENCY_BINS ];
+}hal_latency_stats_t;
+
+/*Start TB0 and set CCR6 to capture mode, called by HAL_LATENCY_INIT*/
+void        vHALLatencyInit( void );
+/*Task waiting on ucPair is woken by current ISR. Keeps older stamp if
+ *the task did not run since an earlier mark*/
+void        vHALLatencyISRMark( uint8_t ucPair );
+/*Task of ucPair runs, add latency to statistics if pair was marked*/
+void        vHALLatencyTaskResumed( uint8_t ucPair, uint16_t usNow );
+/*Copy statistics of ucPair and compute mean*/
+void        vHALLatencyGetStats( uint8_t ucPair, hal_latency_stats_t *pxStats );
+/*Clear statistics of ucPair*/
+void        vHALLatencyReset( uint8_t ucPair );
+
+#else
+
+#define HAL_LATENCY_ISR_ENTRY()
+#define HAL_LATENCY_ISR_MARK( ucPair )
+#define HAL_LATENCY_TASK_RESUMED( ucPair )
+#define HAL_LATENCY_INIT()
+
+#endif /* configUSE_LATENCY_PROBE */
+
+#endif /* HAL_LATENCY_H_ */
@@ -0,0 +1,118 @@
+/*
+ * Schedulability analysis and admission control for FreeRTOS.
+ *
+ * Tasks created with xTaskCreateAdmitted() declare a period, a worst case
+ * execution time and a deadline.  Before such a task is created, response time
+ * analysis is run on the set of admitted tasks with the new task added.  If
+ * any task in the set could miss its deadline, the new task is rejected, or,
+ * if configADMISSION_REJECT_UNSCHEDULABLE is 0, created anyway with the set
+ * flagged as overloaded.
+ *
+ * Only admitted tasks take part in the analysis.  Tasks created with
+ * xTaskCreate(), the idle task, the timer task and interrupts are not
+ * accounted for, so their load has to be covered by margin in the declared
+ * execution times.  Blocking on mutexes is not accounted for either.
+ *
+ * 1 tab == 4 spaces!
+ */
+
+#ifndef ADMISSION_H
+#define ADMISSION_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h" must appear in source files before "include admission.h"
+#endif
+
+#include "task.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Declared timing of a periodic or sporadic task.  Any time unit can be used,
+ * ticks or microseconds for example, as long as all admitted tasks use the
+ * same one.
+ */
+typedef struct xTASK_TIMING
+{
+	uint32_t ulPeriod;		/*< Minimum time between two releases of the task. */
+	uint32_t ulWCET;		/*< Worst case execution time of one release. */
+	uint32_t ulDeadline;	/*< Deadline relative to the release, 0 to use the period. */
+} TaskTiming_t;
+
+/**
+ * admission.h
+ * <pre>BaseType_t xTaskCreateAdmitted( TaskFunction_t pxTaskCode, const char *pcName, configSTACK_DEPTH_TYPE usStackDepth, void *pvParameters, UBaseType_t uxPriority, const TaskTiming_t *pxTiming, TaskHandle_t *pxCreatedTask );</pre>
+ *
+ * As xTaskCreate(), but the task is only created if the admitted task set,
+ * including the new task, remains schedulable.
+ *
+ * Tasks at configEDF_PRIORITY, when configUSE_EDF_SCHEDULING is 1, are checked
+ * with a density test over the EDF tasks and all tasks of higher priority.
+ * All other tasks are checked with fixed priority response time analysis, in
+ * which tasks of equal priority are counted as interference.
+ *
+ * @return pdPASS if the task was created.  errTASK_SET_UNSCHEDULABLE if the
+ * task set would not be schedulable, or configADMISSION_MAX_TASKS tasks are
+ * already admitted, and the task was not created.
+ * errCOULD_NOT_ALLOCATE_REQUIRED_MEMORY if there was not enough heap.
+ *
+ * \defgroup xTaskCreateAdmitted xTaskCreateAdmitted
+ * \ingroup Admission
+ */
+BaseType_t xTaskCreateAdmitted( TaskFunction_t pxTaskCode,
+								const char * const pcName,	/*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+								const configSTACK_DEPTH_TYPE usStackDepth,
+								void * const pvParameters,
+								UBaseType_t uxPriority,
+								const TaskTiming_t * const pxTiming,
+								TaskHandle_t * const pxCreatedTask ) PRIVILEGED_FUNCTION;
+
+/**
+ * admission.h
+ * <pre>BaseType_t xAdmissionTest( UBaseType_t uxPriority, const TaskTiming_t *pxTiming );</pre>
+ *
+ * Run the same analysis as xTaskCreateAdmitted() without creating anything.
+ *
+ * @return pdPASS if a task with the given priority and timing would be
+ * admitted, otherwise errTASK_SET_UNSCHEDULABLE.
+ */
+BaseType_t xAdmissionTest( UBaseType_t uxPriority, const TaskTiming_t * const pxTiming ) PRIVILEGED_FUNCTION;
+
+/**
+ * admission.h
+ * <pre>BaseType_t xAdmissionIsOverloaded( void );</pre>
+ *
+ * @return pdTRUE if a task has been created that made the admitted task set
+ * unschedulable.  Can only happen if configADMISSION_REJECT_UNSCHEDULABLE is 0.
+ */
+BaseType_t xAdmissionIsOverloaded( void ) PRIVILEGED_FUNCTION;
+
+/**
+ * admission.h
+ * <pre>uint32_t ulAdmissionGetResponseTime( TaskHandle_t xTask );</pre>
+ *
+ * @return The worst case response time computed for xTask the last time a task
+ * was admitted, in the unit used for the declared timing.  For tasks checked
+ * by the density test this is their deadline.  0 if xTask was not admitted or
+ * could miss its deadline.
+ */
+uint32_t ulAdmissionGetResponseTime( TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+
+/*
+ * THIS FUNCTION MUST NOT BE USED FROM APPLICATION CODE.  IT IS ONLY INTENDED
+ * FOR USE BY vTaskDelete().
+ *
+ * Remove xTask from the admitted task set, freeing its entry.  Called from a
+ * critical section, so only the entry is removed and the set is not analysed
+ * again.  Response times kept for the remaining tasks stay valid upper bounds,
+ * as removing a task can only shorten them.
+ */
+void vAdmissionRemoveTask( TaskHandle_t xTask ) PRIVILEGED_FUNCTION;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ADMISSION_H */
@@ -0,0 +1,137 @@
+/*
+ * Reader-writer lock for FreeRTOS.
+ *
+ * Built on the same priority ordered event lists as queues.  Any number of
+ * readers can hold the lock at the same time, taking and giving a read lock
+ * that is not held for writing is a counter update in a short critical
+ * section, so readers never contend with each other.
+ *
+ * 1 tab == 4 spaces!
+ */
+
+#ifndef RWLOCK_H
+#define RWLOCK_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h" must appear in source files before "include rwlock.h"
+#endif
+
+#include "task.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * rwlock.h
+ *
+ * Type by which reader-writer locks are referenced.
+ *
+ * \defgroup RWLockHandle_t RWLockHandle_t
+ * \ingroup RWLock
+ */
+struct RWLockDefinition;
+typedef struct RWLockDefinition * RWLockHandle_t;
+
+/**
+ * rwlock.h
+ * <pre>RWLockHandle_t xRWLockCreate( void );</pre>
+ *
+ * Create a reader-writer lock.  The lock uses writer preference: once a writer
+ * is waiting, new readers block until all waiting writers have been served, so
+ * a steady stream of readers cannot starve a writer.  Blocked writers, and
+ * blocked readers, are woken in task priority order.
+ *
+ * A task must not block while holding the lock for reading if a higher
+ * priority writer could be waiting for it - as with any lock, readers hold it
+ * for a short time only.
+ *
+ * Priority inheritance is not performed.  Readers are only counted, not
+ * recorded, so the lock does not know which tasks to raise.  Recording them
+ * would need a holder table per lock and a walk of it in every take and
+ * give, and readers taking the lock from interrupts have no task to raise.
+ * With writer preference no reader enters once a writer waits, so a waiting
+ * writer is delayed by at most the rest of the read sections in progress -
+ * but only while those readers are not preempted.  A reader of lower priority
+ * than the writer can be preempted by any task in between, and then the wait
+ * of the writer has no bound.  Where that matters the reader can raise its
+ * preemption threshold to one below the writer priority for the read section
+ * with vTaskSetPreemptionThreshold(), which restores the bound: the longest
+ * read section, plus the time taken by tasks above the writer.
+ *
+ * @return Handle to the created lock, or NULL if there was not enough heap.
+ *
+ * \defgroup xRWLockCreate xRWLockCreate
+ * \ingroup RWLock
+ */
+RWLockHandle_t xRWLockCreate( void ) PRIVILEGED_FUNCTION;
+
+/**
+ * rwlock.h
+ * <pre>BaseType_t xRWLockTakeRead( RWLockHandle_t xRWLock, TickType_t xTicksToWait );</pre>
+ *
+ * Take the lock for reading.  Succeeds immediately if the lock is not held for
+ * writing and no writer is waiting, otherwise blocks for up to xTicksToWait.
+ *
+ * @return pdPASS if the lock was taken, pdFAIL on timeout.
+ */
+BaseType_t xRWLockTakeRead( RWLockHandle_t xRWLock, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * rwlock.h
+ * <pre>void vRWLockGiveRead( RWLockHandle_t xRWLock );</pre>
+ *
+ * Give back a lock taken with xRWLockTakeRead().  The last reader hands the
+ * lock directly to the highest priority waiting writer.
+ */
+void vRWLockGiveRead( RWLockHandle_t xRWLock ) PRIVILEGED_FUNCTION;
+
+/**
+ * rwlock.h
+ * <pre>BaseType_t xRWLockTakeWrite( RWLockHandle_t xRWLock, TickType_t xTicksToWait );</pre>
+ *
+ * Take the lock for writing.  Succeeds when there are no readers and no other
+ * writer, otherwise blocks for up to xTicksToWait.
+ *
+ * @return pdPASS if the lock was taken, pdFAIL on timeout.
+ */
+BaseType_t xRWLockTakeWrite( RWLockHandle_t xRWLock, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * rwlock.h
+ * <pre>void vRWLockGiveWrite( RWLockHandle_t xRWLock );</pre>
+ *
+ * Give back a lock taken with xRWLockTakeWrite().  The lock is handed to the
+ * highest priority waiting writer if there is one, otherwise all waiting
+ * readers are unblocked.
+ */
+void vRWLockGiveWrite( RWLockHandle_t xRWLock ) PRIVILEGED_FUNCTION;
+
+/**
+ * rwlock.h
+ * <pre>BaseType_t xRWLockTryTakeReadFromISR( RWLockHandle_t xRWLock );</pre>
+ *
+ * Take the lock for reading from an interrupt.  Never blocks, fails if the
+ * lock is held or wanted by a writer.  Must be given back by the same
+ * interrupt with vRWLockGiveReadFromISR().
+ *
+ * @return pdPASS if the lock was taken, otherwise pdFAIL.
+ */
+BaseType_t xRWLockTryTakeReadFromISR( RWLockHandle_t xRWLock ) PRIVILEGED_FUNCTION;
+
+/**
+ * rwlock.h
+ * <pre>void vRWLockGiveReadFromISR( RWLockHandle_t xRWLock, BaseType_t *pxHigherPriorityTaskWoken );</pre>
+ *
+ * Interrupt safe version of vRWLockGiveRead().  *pxHigherPriorityTaskWoken is
+ * set to pdTRUE if a writer of higher priority than the interrupted task was
+ * handed the lock, in which case a context switch should be requested before
+ * the interrupt exits.
+ */
+void vRWLockGiveReadFromISR( RWLockHandle_t xRWLock, BaseType_t *pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RWLOCK_H */
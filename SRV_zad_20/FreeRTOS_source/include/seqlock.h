@@ -0,0 +1,100 @@
+/*
+ * Sequence lock snapshot cell for FreeRTOS.
+ *
+ * Shares a small value (up to seqlockMAX_DATA_SIZE bytes) between one writer
+ * and any number of readers, in tasks or interrupts.  The writer bumps a
+ * sequence counter before and after updating the value.  Readers copy the value
+ * without entering a critical section and copy it again if the sequence
+ * counter shows a write happened meanwhile, so reading never blocks and never
+ * delays interrupts.
+ *
+ * Readers in interrupts must never find a write half finished, as the writer
+ * could not run again to finish it.  Writers therefore hold off every
+ * interrupt a reader may be in, which on ports with selective critical
+ * sections means all of them, not only those that call the kernel.
+ *
+ * 1 tab == 4 spaces!
+ */
+
+#ifndef SEQLOCK_H
+#define SEQLOCK_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h" must appear in source files before "include seqlock.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Largest value that can be stored in a cell, in bytes. */
+#ifndef seqlockMAX_DATA_SIZE
+	#define seqlockMAX_DATA_SIZE	16
+#endif
+
+/*
+ * The cell is allocated by the application, normally as a global variable.
+ * Members must only be accessed through the functions below.
+ */
+typedef struct xSEQLOCK
+{
+	volatile UBaseType_t uxSequence;	/*< Even when the value is stable, odd while it is written.  0 until the first write. */
+	UBaseType_t uxDataSize;
+	volatile uint8_t ucData[ seqlockMAX_DATA_SIZE ];
+} SeqLock_t;
+
+/**
+ * seqlock.h
+ * <pre>void vSeqLockInit( SeqLock_t *pxSeqLock, UBaseType_t uxDataSize );</pre>
+ *
+ * Prepare a cell to hold values of uxDataSize bytes.  Must be called before the
+ * cell is written or read.
+ */
+void vSeqLockInit( SeqLock_t * const pxSeqLock, UBaseType_t uxDataSize ) PRIVILEGED_FUNCTION;
+
+/**
+ * seqlock.h
+ * <pre>void vSeqLockWrite( SeqLock_t *pxSeqLock, const void *pvData );</pre>
+ *
+ * Publish a new value from a task.  Only one task or interrupt may write a
+ * given cell.  The copy is done in a short critical section, so a reader can
+ * never preempt a writer that is half way through an update.
+ */
+void vSeqLockWrite( SeqLock_t * const pxSeqLock, const void * const pvData ) PRIVILEGED_FUNCTION;
+
+/**
+ * seqlock.h
+ * <pre>void vSeqLockWriteFromISR( SeqLock_t *pxSeqLock, const void *pvData );</pre>
+ *
+ * Publish a new value from an interrupt.  Never unblocks a task, so no context
+ * switch is ever required.
+ */
+void vSeqLockWriteFromISR( SeqLock_t * const pxSeqLock, const void * const pvData ) PRIVILEGED_FUNCTION;
+
+/**
+ * seqlock.h
+ * <pre>BaseType_t xSeqLockRead( const SeqLock_t *pxSeqLock, void *pvData );</pre>
+ *
+ * Copy the latest value into pvData.  Can be called from tasks and interrupts.
+ * The copy is retried only if the writer ran while it was being made.
+ *
+ * @return pdTRUE if a value has been written to the cell, otherwise pdFALSE
+ * and pvData is left holding the cell's initial (zero) contents.
+ */
+BaseType_t xSeqLockRead( const SeqLock_t * const pxSeqLock, void * const pvData ) PRIVILEGED_FUNCTION;
+
+/**
+ * seqlock.h
+ * <pre>UBaseType_t uxSeqLockGetSequence( const SeqLock_t *pxSeqLock );</pre>
+ *
+ * Returns the sequence counter, which changes on every write.  Comparing it to
+ * a previously returned value tells a reader whether the value changed without
+ * copying it.
+ */
+#define uxSeqLockGetSequence( pxSeqLock ) ( ( pxSeqLock )->uxSequence )
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SEQLOCK_H */
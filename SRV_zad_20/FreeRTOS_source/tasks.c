@@ -40,6 +40,10 @@ task.h is included from an application file. */
 #include "timers.h"
 #include "stack_macros.h"
 
+#if( configUSE_ADMISSION_CONTROL == 1 )
+	#include "admission.h"
+#endif
+
 /* Lint e9021, e961 and e750 are suppressed as a MISRA exception justified
 because the MPU ports require MPU_WRAPPERS_INCLUDED_FROM_API_FILE to be defined
 for the header files above, but not in this file, in order to generate the
@@ -112,6 +116,63 @@ configIDLE_TASK_NAME in FreeRTOSConfig.h. */
 	#define configIDLE_TASK_NAME "IDLE"
 #endif
 
+#if( configUSE_PREEMPTION_THRESHOLD == 1 )
+
+	/* A running task can only be preempted by tasks with a priority above its
+	run priority, which is its preemption threshold if that is above its
+	priority. */
+	#define taskTHRESHOLD_RAISED( pxTCB ) ( ( pxTCB )->uxPreemptionThreshold > ( pxTCB )->uxPriority )
+	#define taskRUN_PRIORITY( pxTCB ) ( taskTHRESHOLD_RAISED( pxTCB ) ? ( pxTCB )->uxPreemptionThreshold : ( pxTCB )->uxPriority )
+
+#else
+
+	#define taskTHRESHOLD_RAISED( pxTCB ) pdFALSE
+	#define taskRUN_PRIORITY( pxTCB ) ( ( pxTCB )->uxPriority )
+
+#endif /* configUSE_PREEMPTION_THRESHOLD */
+
+#if( configUSE_EDF_SCHEDULING == 1 )
+
+	/* Ready tasks at configEDF_PRIORITY are selected by earliest absolute
+	deadline rather than in turn, and one of them preempts another if its
+	deadline is earlier.  Tasks at all other priorities are scheduled as
+	normal. */
+	#define taskSELECT_FROM_READY_LIST( uxPriority )													\
+	{																									\
+		if( ( uxPriority ) == ( UBaseType_t ) configEDF_PRIORITY )										\
+		{																								\
+			pxCurrentTCB = prvSelectEarliestDeadlineTask( &( pxReadyTasksLists[ ( uxPriority ) ] ) );	\
+		}																								\
+		else																							\
+		{																								\
+			listGET_OWNER_OF_NEXT_ENTRY( pxCurrentTCB, &( pxReadyTasksLists[ ( uxPriority ) ] ) );		\
+		}																								\
+	}
+
+	#define taskPREEMPTS_CURRENT( pxTCB )																\
+		( ( ( pxTCB )->uxPriority > taskRUN_PRIORITY( pxCurrentTCB ) ) ||								\
+		  ( ( ( pxTCB )->uxPriority == ( UBaseType_t ) configEDF_PRIORITY ) &&							\
+			( pxCurrentTCB->uxPriority == ( UBaseType_t ) configEDF_PRIORITY ) &&						\
+			( taskTHRESHOLD_RAISED( pxCurrentTCB ) == pdFALSE ) &&										\
+			( prvDeadlineIsEarlier( ( pxTCB ), pxCurrentTCB ) != pdFALSE ) ) )
+
+#else
+
+	#define taskSELECT_FROM_READY_LIST( uxPriority ) listGET_OWNER_OF_NEXT_ENTRY( pxCurrentTCB, &( pxReadyTasksLists[ ( uxPriority ) ] ) )
+
+	#define taskPREEMPTS_CURRENT( pxTCB ) ( ( pxTCB )->uxPriority > taskRUN_PRIORITY( pxCurrentTCB ) )
+
+#endif /* configUSE_EDF_SCHEDULING */
+
+/* Whether a task made ready by the tick or by a resume should request a
+switch.  Tasks of equal priority request one too, so they get their turn, but
+not while the running task has raised its preemption threshold. */
+#define taskSHOULD_SWITCH_TO( pxTCB )																	\
+	( ( ( pxTCB )->uxPriority >= pxCurrentTCB->uxPriority ) &&											\
+	  ( ( taskTHRESHOLD_RAISED( pxCurrentTCB ) == pdFALSE ) || taskPREEMPTS_CURRENT( pxTCB ) ) )
+
+/*-----------------------------------------------------------*/
+
 #if ( configUSE_PORT_OPTIMISED_TASK_SELECTION == 0 )
 
 	/* If configUSE_PORT_OPTIMISED_TASK_SELECTION is 0 then task selection is
@@ -143,7 +204,7 @@ configIDLE_TASK_NAME in FreeRTOSConfig.h. */
 																										\
 		/* listGET_OWNER_OF_NEXT_ENTRY indexes through the list, so the tasks of						\
 		the	same priority get an equal share of the processor time. */									\
-		listGET_OWNER_OF_NEXT_ENTRY( pxCurrentTCB, &( pxReadyTasksLists[ uxTopPriority ] ) );			\
+		taskSELECT_FROM_READY_LIST( uxTopPriority );													\
 		uxTopReadyPriority = uxTopPriority;																\
 	} /* taskSELECT_HIGHEST_PRIORITY_TASK */
 
@@ -173,7 +234,7 @@ configIDLE_TASK_NAME in FreeRTOSConfig.h. */
 		/* Find the highest priority list that contains ready tasks. */								\
 		portGET_HIGHEST_PRIORITY( uxTopPriority, uxTopReadyPriority );								\
 		configASSERT( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ uxTopPriority ] ) ) > 0 );		\
-		listGET_OWNER_OF_NEXT_ENTRY( pxCurrentTCB, &( pxReadyTasksLists[ uxTopPriority ] ) );		\
+		taskSELECT_FROM_READY_LIST( uxTopPriority );												\
 	} /* taskSELECT_HIGHEST_PRIORITY_TASK() */
 
 	/*-----------------------------------------------------------*/
@@ -244,6 +305,14 @@ to its original value when it is released. */
 	#define taskEVENT_LIST_ITEM_VALUE_IN_USE	0x80000000UL
 #endif
 
+/* The 32 bit tick count.  With 16 bit ticks the number of tick count overflows
+is the upper half.  Must be read with the tick interrupt masked. */
+#if( configUSE_16_BIT_TICKS == 1 )
+	#define taskGET_TICK_COUNT_32()	( ( ( uint32_t ) ( uint16_t ) xNumOfOverflows << 16 ) | ( uint32_t ) xTickCount )
+#else
+	#define taskGET_TICK_COUNT_32()	( ( uint32_t ) xTickCount )
+#endif
+
 /*
  * Task control block.  A task control block (TCB) is allocated for each task,
  * and stores task state information, including a pointer to the task's context
@@ -281,6 +350,23 @@ typedef struct tskTaskControlBlock 			/* The old naming convention is used to pr
 		UBaseType_t		uxMutexesHeld;
 	#endif
 
+	#if ( configUSE_EDF_SCHEDULING == 1 )
+		TickType_t		xRelativeDeadline;	/*< Deadline of each release relative to its start, 0 if the task has no deadline. */
+		TickType_t		xAbsoluteDeadline;	/*< Tick count by which the current release should complete. */
+	#endif
+
+	#if ( configUSE_PREEMPTION_THRESHOLD == 1 )
+		UBaseType_t		uxPreemptionThreshold;	/*< Only tasks above this priority preempt the task while it runs, has no effect if not above uxPriority. */
+	#endif
+
+	#if ( configUSE_RELEASE_MONITOR == 1 )
+		TaskReleaseMonitor_t *pxReleaseMonitor;	/*< Updated by vTaskDelayUntil(), NULL if the task is not monitored. */
+	#endif
+
+	#if ( configUSE_TASK_BUDGETS == 1 )
+		TaskBudget_t	*pxBudget;			/*< NULL if the task has no execution budget. */
+	#endif
+
 	#if ( configUSE_APPLICATION_TASK_TAG == 1 )
 		TaskHookFunction_t pxTaskTag;
 	#endif
@@ -394,6 +480,12 @@ PRIVILEGED_DATA static volatile UBaseType_t uxSchedulerSuspended	= ( UBaseType_t
 
 #endif
 
+#if ( configUSE_TASK_BUDGETS == 1 )
+
+	PRIVILEGED_DATA static TaskBudget_t *pxBudgetList = NULL;	/*< Budgets charged and replenished by the tick. */
+
+#endif
+
 /*lint -restore */
 
 /*-----------------------------------------------------------*/
@@ -411,6 +503,12 @@ PRIVILEGED_DATA static volatile UBaseType_t uxSchedulerSuspended	= ( UBaseType_t
 
 #endif
 
+#if( ( configUSE_RELEASE_MONITOR == 1 ) && ( configUSE_DEADLINE_MISS_HOOK == 1 ) )
+
+	extern void vApplicationDeadlineMissHook( TaskHandle_t xTask, TickType_t xResponseTime ); /*lint !e526 Symbol not defined as it is an application callback. */
+
+#endif
+
 #if( configSUPPORT_STATIC_ALLOCATION == 1 )
 
 	extern void vApplicationGetIdleTaskMemory( StaticTask_t **ppxIdleTaskTCBBuffer, StackType_t **ppxIdleTaskStackBuffer, uint32_t *pulIdleTaskStackSize ); /*lint !e526 Symbol not defined as it is an application callback. */
@@ -531,6 +629,95 @@ static void prvAddCurrentTaskToDelayedList( TickType_t xTicksToWait, const BaseT
  */
 static void prvResetNextTaskUnblockTime( void );
 
+#if( configUSE_PREEMPTION_THRESHOLD == 1 )
+
+	/*
+	 * Returns pdTRUE if the running task has raised its preemption threshold,
+	 * is still ready, and no ready task has a priority above its threshold.
+	 */
+	static BaseType_t prvThresholdHoldsCurrentTask( void ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if( configUSE_EDF_SCHEDULING == 1 )
+
+	/*
+	 * Returns pdTRUE if pxTCB should run before pxOtherTCB when both are ready
+	 * at configEDF_PRIORITY.  A task with a deadline runs before one without.
+	 */
+	static BaseType_t prvDeadlineIsEarlier( const TCB_t * const pxTCB, const TCB_t * const pxOtherTCB ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Returns the ready task at configEDF_PRIORITY that should run next.
+	 */
+	static TCB_t *prvSelectEarliestDeadlineTask( List_t * const pxReadyList ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if( configUSE_RELEASE_MONITOR == 1 )
+
+	/*
+	 * Called by vTaskDelayUntil() on entry, and by
+	 * vTaskReleaseMonitorComplete(), with the release time of the job the
+	 * calling task has just completed.
+	 */
+	static void prvRecordCompletion( TickType_t xReleaseTime ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Called by vTaskDelayUntil() on return, and by vTaskReleaseMonitorMark(),
+	 * with the release time of the job the calling task is about to start.
+	 */
+	static void prvRecordRelease( TickType_t xReleaseTime ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Append a space and ulValue in decimal to pcBuffer.  Returns pcBuffer
+	 * advanced past the written characters.
+	 */
+	static char *prvWriteDecimal( char *pcBuffer, uint32_t ulValue ) PRIVILEGED_FUNCTION;
+
+#endif
+
+#if( configUSE_TASK_BUDGETS == 1 )
+
+	/*
+	 * Called from the tick with the scheduler not suspended.  Replenishes the
+	 * budgets that are due and charges the tick to the running task.  Returns
+	 * pdTRUE if a task changed priority in a way that needs a context switch.
+	 */
+	static BaseType_t prvUpdateBudgets( void ) PRIVILEGED_FUNCTION;
+
+	/*
+	 * Change the base priority of a budgeted task, moving it to the right
+	 * ready list if it is ready.  Does not yield.  Nothing is changed while
+	 * the task holds a mutex, the change is applied when the last mutex is
+	 * given back.
+	 */
+	static void prvSetBudgetPriority( TCB_t * const pxTCB, UBaseType_t uxNewPriority ) PRIVILEGED_FUNCTION;
+
+	#if ( configUSE_MUTEXES == 1 )
+
+		/*
+		 * The base priority a task returns to when it gives back its last
+		 * mutex: the budget priority, or the background priority while the
+		 * budget is used up.  uxPriority is returned for a task without a
+		 * budget.
+		 */
+		static UBaseType_t prvGetBudgetBasePriority( const TCB_t * const pxTCB, UBaseType_t uxPriority ) PRIVILEGED_FUNCTION;
+
+	#endif
+
+	#if ( INCLUDE_vTaskDelete == 1 )
+
+		/*
+		 * Unlink the budget of a task that is being deleted, so the tick no
+		 * longer charges it.  Called from a critical section.
+		 */
+		static void prvRemoveBudget( const TaskBudget_t * const pxBudget ) PRIVILEGED_FUNCTION;
+
+	#endif
+
+#endif
+
 #if ( ( configUSE_TRACE_FACILITY == 1 ) && ( configUSE_STATS_FORMATTING_FUNCTIONS > 0 ) )
 
 	/*
@@ -928,6 +1115,12 @@ UBaseType_t x;
 	}
 
 	pxNewTCB->uxPriority = uxPriority;
+	#if ( configUSE_RELEASE_MONITOR == 1 )
+	{
+		pxNewTCB->pxReleaseMonitor = NULL;
+	}
+	#endif /* configUSE_RELEASE_MONITOR */
+
 	#if ( configUSE_MUTEXES == 1 )
 	{
 		pxNewTCB->uxBasePriority = uxPriority;
@@ -935,6 +1128,25 @@ UBaseType_t x;
 	}
 	#endif /* configUSE_MUTEXES */
 
+	#if ( configUSE_EDF_SCHEDULING == 1 )
+	{
+		pxNewTCB->xRelativeDeadline = ( TickType_t ) 0U;
+		pxNewTCB->xAbsoluteDeadline = ( TickType_t ) 0U;
+	}
+	#endif /* configUSE_EDF_SCHEDULING */
+
+	#if ( configUSE_PREEMPTION_THRESHOLD == 1 )
+	{
+		pxNewTCB->uxPreemptionThreshold = tskIDLE_PRIORITY;
+	}
+	#endif /* configUSE_PREEMPTION_THRESHOLD */
+
+	#if ( configUSE_TASK_BUDGETS == 1 )
+	{
+		pxNewTCB->pxBudget = NULL;
+	}
+	#endif /* configUSE_TASK_BUDGETS */
+
 	vListInitialiseItem( &( pxNewTCB->xStateListItem ) );
 	vListInitialiseItem( &( pxNewTCB->xEventListItem ) );
 
@@ -1136,7 +1348,7 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 	{
 		/* If the created task is of a higher priority than the current task
 		then it should run now. */
-		if( pxCurrentTCB->uxPriority < pxNewTCB->uxPriority )
+		if( taskPREEMPTS_CURRENT( pxNewTCB ) )
 		{
 			taskYIELD_IF_USING_PREEMPTION();
 		}
@@ -1184,148 +1396,901 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 				mtCOVERAGE_TEST_MARKER();
 			}
 
-			/* Increment the uxTaskNumber also so kernel aware debuggers can
-			detect that the task lists need re-generating.  This is done before
-			portPRE_TASK_DELETE_HOOK() as in the Windows port that macro will
-			not return. */
-			uxTaskNumber++;
-
-			if( pxTCB == pxCurrentTCB )
-			{
-				/* A task is deleting itself.  This cannot complete within the
-				task itself, as a context switch to another task is required.
-				Place the task in the termination list.  The idle task will
-				check the termination list and free up any memory allocated by
-				the scheduler for the TCB and stack of the deleted task. */
-				vListInsertEnd( &xTasksWaitingTermination, &( pxTCB->xStateListItem ) );
+			#if ( configUSE_TASK_BUDGETS == 1 )
+			{
+				if( pxTCB->pxBudget != NULL )
+				{
+					prvRemoveBudget( pxTCB->pxBudget );
+					pxTCB->pxBudget = NULL;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			#endif
+
+			#if( ( configUSE_ADMISSION_CONTROL == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+			{
+				/* Free the entry of an admitted task, a no-op for others. */
+				vAdmissionRemoveTask( ( TaskHandle_t ) pxTCB );
+			}
+			#endif
+
+			/* Increment the uxTaskNumber also so kernel aware debuggers can
+			detect that the task lists need re-generating.  This is done before
+			portPRE_TASK_DELETE_HOOK() as in the Windows port that macro will
+			not return. */
+			uxTaskNumber++;
+
+			if( pxTCB == pxCurrentTCB )
+			{
+				/* A task is deleting itself.  This cannot complete within the
+				task itself, as a context switch to another task is required.
+				Place the task in the termination list.  The idle task will
+				check the termination list and free up any memory allocated by
+				the scheduler for the TCB and stack of the deleted task. */
+				vListInsertEnd( &xTasksWaitingTermination, &( pxTCB->xStateListItem ) );
+
+				/* Increment the ucTasksDeleted variable so the idle task knows
+				there is a task that has been deleted and that it should therefore
+				check the xTasksWaitingTermination list. */
+				++uxDeletedTasksWaitingCleanUp;
+
+				/* The pre-delete hook is primarily for the Windows simulator,
+				in which Windows specific clean up operations are performed,
+				after which it is not possible to yield away from this task -
+				hence xYieldPending is used to latch that a context switch is
+				required. */
+				portPRE_TASK_DELETE_HOOK( pxTCB, &xYieldPending );
+			}
+			else
+			{
+				--uxCurrentNumberOfTasks;
+				prvDeleteTCB( pxTCB );
+
+				/* Reset the next expected unblock time in case it referred to
+				the task that has just been deleted. */
+				prvResetNextTaskUnblockTime();
+			}
+
+			traceTASK_DELETE( pxTCB );
+		}
+		taskEXIT_CRITICAL();
+
+		/* Force a reschedule if it is the currently running task that has just
+		been deleted. */
+		if( xSchedulerRunning != pdFALSE )
+		{
+			if( pxTCB == pxCurrentTCB )
+			{
+				configASSERT( uxSchedulerSuspended == 0 );
+				portYIELD_WITHIN_API();
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+	}
+
+#endif /* INCLUDE_vTaskDelete */
+/*-----------------------------------------------------------*/
+
+#if ( INCLUDE_vTaskDelayUntil == 1 )
+
+	void vTaskDelayUntil( TickType_t * const pxPreviousWakeTime, const TickType_t xTimeIncrement )
+	{
+	TickType_t xTimeToWake;
+	BaseType_t xAlreadyYielded, xShouldDelay = pdFALSE;
+
+		configASSERT( pxPreviousWakeTime );
+		configASSERT( ( xTimeIncrement > 0U ) );
+		configASSERT( uxSchedulerSuspended == 0 );
+
+		#if( configUSE_RELEASE_MONITOR == 1 )
+		{
+			prvRecordCompletion( *pxPreviousWakeTime );
+		}
+		#endif
+
+		vTaskSuspendAll();
+		{
+			/* Minor optimisation.  The tick count cannot change in this
+			block. */
+			const TickType_t xConstTickCount = xTickCount;
+
+			/* Generate the tick time at which the task wants to wake. */
+			xTimeToWake = *pxPreviousWakeTime + xTimeIncrement;
+
+			if( xConstTickCount < *pxPreviousWakeTime )
+			{
+				/* The tick count has overflowed since this function was
+				lasted called.  In this case the only time we should ever
+				actually delay is if the wake time has also	overflowed,
+				and the wake time is greater than the tick time.  When this
+				is the case it is as if neither time had overflowed. */
+				if( ( xTimeToWake < *pxPreviousWakeTime ) && ( xTimeToWake > xConstTickCount ) )
+				{
+					xShouldDelay = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				/* The tick time has not overflowed.  In this case we will
+				delay if either the wake time has overflowed, and/or the
+				tick time is less than the wake time. */
+				if( ( xTimeToWake < *pxPreviousWakeTime ) || ( xTimeToWake > xConstTickCount ) )
+				{
+					xShouldDelay = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+
+			/* Update the wake time ready for the next call. */
+			*pxPreviousWakeTime = xTimeToWake;
+
+			#if( configUSE_EDF_SCHEDULING == 1 )
+			{
+				/* The next release starts at the wake time, even if that has
+				already passed, so its deadline is measured from there. */
+				if( pxCurrentTCB->xRelativeDeadline != ( TickType_t ) 0U )
+				{
+					pxCurrentTCB->xAbsoluteDeadline = xTimeToWake + pxCurrentTCB->xRelativeDeadline;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			#endif /* configUSE_EDF_SCHEDULING */
+
+			if( xShouldDelay != pdFALSE )
+			{
+				traceTASK_DELAY_UNTIL( xTimeToWake );
+
+				/* prvAddCurrentTaskToDelayedList() needs the block time, not
+				the time to wake, so subtract the current tick count. */
+				prvAddCurrentTaskToDelayedList( xTimeToWake - xConstTickCount, pdFALSE );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		xAlreadyYielded = xTaskResumeAll();
+
+		/* Force a reschedule if xTaskResumeAll has not already done so, we may
+		have put ourselves to sleep. */
+		if( xAlreadyYielded == pdFALSE )
+		{
+			portYIELD_WITHIN_API();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		#if( configUSE_RELEASE_MONITOR == 1 )
+		{
+			prvRecordRelease( xTimeToWake );
+		}
+		#endif
+	}
+
+#endif /* INCLUDE_vTaskDelayUntil */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_EDF_SCHEDULING == 1 )
+
+	void vTaskSetDeadline( TaskHandle_t xTask, TickType_t xRelativeDeadline )
+	{
+	TCB_t *pxTCB;
+
+		/* Deadlines are compared as signed tick differences. */
+		configASSERT( xRelativeDeadline < ( ( TickType_t ) portMAX_DELAY >> 1 ) );
+
+		taskENTER_CRITICAL();
+		{
+			pxTCB = prvGetTCBFromHandle( xTask );
+			pxTCB->xRelativeDeadline = xRelativeDeadline;
+
+			/* The current release is taken to start now. */
+			pxTCB->xAbsoluteDeadline = xTickCount + xRelativeDeadline;
+		}
+		taskEXIT_CRITICAL();
+
+		/* The changed deadline may order the ready tasks differently. */
+		if( xSchedulerRunning != pdFALSE )
+		{
+			taskYIELD_IF_USING_PREEMPTION();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	/*-----------------------------------------------------------*/
+
+	TickType_t xTaskGetDeadline( TaskHandle_t xTask )
+	{
+	TCB_t *pxTCB;
+	TickType_t xReturn = ( TickType_t ) 0U;
+
+		taskENTER_CRITICAL();
+		{
+			pxTCB = prvGetTCBFromHandle( xTask );
+
+			if( pxTCB->xRelativeDeadline != ( TickType_t ) 0U )
+			{
+				xReturn = pxTCB->xAbsoluteDeadline;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		return xReturn;
+	}
+	/*-----------------------------------------------------------*/
+
+	static BaseType_t prvDeadlineIsEarlier( const TCB_t * const pxTCB, const TCB_t * const pxOtherTCB )
+	{
+	BaseType_t xReturn;
+
+		if( pxTCB->xRelativeDeadline == ( TickType_t ) 0U )
+		{
+			xReturn = pdFALSE;
+		}
+		else if( pxOtherTCB->xRelativeDeadline == ( TickType_t ) 0U )
+		{
+			xReturn = pdTRUE;
+		}
+		else
+		{
+			/* Both deadlines are within half the tick range of the current
+			tick count, so the sign of their difference orders them even if
+			the tick count has wrapped between them. */
+			#if( configUSE_16_BIT_TICKS == 1 )
+			{
+				xReturn = ( ( int16_t ) ( pxTCB->xAbsoluteDeadline - pxOtherTCB->xAbsoluteDeadline ) < 0 ) ? pdTRUE : pdFALSE;
+			}
+			#else
+			{
+				xReturn = ( ( int32_t ) ( pxTCB->xAbsoluteDeadline - pxOtherTCB->xAbsoluteDeadline ) < 0 ) ? pdTRUE : pdFALSE;
+			}
+			#endif
+		}
+
+		return xReturn;
+	}
+	/*-----------------------------------------------------------*/
+
+	static TCB_t *prvSelectEarliestDeadlineTask( List_t * const pxReadyList )
+	{
+	const ListItem_t *pxEndMarker = listGET_END_MARKER( pxReadyList );
+	ListItem_t *pxIterator;
+	TCB_t *pxTCB, *pxEarliestTCB = NULL;
+
+		for( pxIterator = listGET_HEAD_ENTRY( pxReadyList ); pxIterator != pxEndMarker; pxIterator = listGET_NEXT( pxIterator ) )
+		{
+			pxTCB = ( TCB_t * ) listGET_LIST_ITEM_OWNER( pxIterator );
+
+			#if( configUSE_MUTEXES == 1 )
+			{
+				/* A task raised into the band by priority inheritance holds a
+				mutex that a task in the band is waiting for, so it must run
+				first whatever its deadline. */
+				if( pxTCB->uxBasePriority < pxTCB->uxPriority )
+				{
+					return pxTCB;
+				}
+			}
+			#endif
+
+			if( ( pxEarliestTCB == NULL ) || ( prvDeadlineIsEarlier( pxTCB, pxEarliestTCB ) != pdFALSE ) )
+			{
+				pxEarliestTCB = pxTCB;
+			}
+		}
+
+		configASSERT( pxEarliestTCB );
+
+		if( pxEarliestTCB->xRelativeDeadline == ( TickType_t ) 0U )
+		{
+			/* None of the ready tasks has a deadline, so share the processor
+			between them as at any other priority. */
+			listGET_OWNER_OF_NEXT_ENTRY( pxEarliestTCB, pxReadyList );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return pxEarliestTCB;
+	}
+
+#endif /* configUSE_EDF_SCHEDULING */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_PREEMPTION_THRESHOLD == 1 )
+
+	void vTaskSetPreemptionThreshold( TaskHandle_t xTask, UBaseType_t uxThreshold )
+	{
+	TCB_t *pxTCB;
+
+		configASSERT( ( uxThreshold < configMAX_PRIORITIES ) );
+
+		/* Ensure the threshold is valid. */
+		if( uxThreshold >= ( UBaseType_t ) configMAX_PRIORITIES )
+		{
+			uxThreshold = ( UBaseType_t ) configMAX_PRIORITIES - ( UBaseType_t ) 1U;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		taskENTER_CRITICAL();
+		{
+			pxTCB = prvGetTCBFromHandle( xTask );
+			pxTCB->uxPreemptionThreshold = uxThreshold;
+		}
+		taskEXIT_CRITICAL();
+
+		/* A lower threshold may let ready tasks preempt the running task. */
+		if( xSchedulerRunning != pdFALSE )
+		{
+			taskYIELD_IF_USING_PREEMPTION();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	/*-----------------------------------------------------------*/
+
+	UBaseType_t uxTaskGetPreemptionThreshold( TaskHandle_t xTask )
+	{
+	TCB_t *pxTCB;
+	UBaseType_t uxReturn;
+
+		taskENTER_CRITICAL();
+		{
+			pxTCB = prvGetTCBFromHandle( xTask );
+			uxReturn = taskRUN_PRIORITY( pxTCB );
+		}
+		taskEXIT_CRITICAL();
+
+		return uxReturn;
+	}
+	/*-----------------------------------------------------------*/
+
+	static BaseType_t prvThresholdHoldsCurrentTask( void )
+	{
+	UBaseType_t uxPriority;
+
+		if( taskTHRESHOLD_RAISED( pxCurrentTCB ) == pdFALSE )
+		{
+			return pdFALSE;
+		}
+
+		/* Not ready if it is switched out because it blocked or suspended
+		itself. */
+		if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ pxCurrentTCB->uxPriority ] ), &( pxCurrentTCB->xStateListItem ) ) == pdFALSE )
+		{
+			return pdFALSE;
+		}
+
+		for( uxPriority = pxCurrentTCB->uxPreemptionThreshold + ( UBaseType_t ) 1U; uxPriority < ( UBaseType_t ) configMAX_PRIORITIES; uxPriority++ )
+		{
+			if( listLIST_IS_EMPTY( &( pxReadyTasksLists[ uxPriority ] ) ) == pdFALSE )
+			{
+				return pdFALSE;
+			}
+		}
+
+		return pdTRUE;
+	}
+
+#endif /* configUSE_PREEMPTION_THRESHOLD */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_RELEASE_MONITOR == 1 )
+
+	void vTaskSetReleaseMonitor( TaskHandle_t xTask, TaskReleaseMonitor_t * const pxMonitor, TickType_t xPeriod, TickType_t xDeadline )
+	{
+	TCB_t *pxTCB;
+	UBaseType_t x;
+
+		configASSERT( ( pxMonitor == NULL ) || ( xPeriod > ( TickType_t ) 0U ) );
+
+		pxTCB = prvGetTCBFromHandle( xTask );
+
+		if( pxMonitor != NULL )
+		{
+			pxMonitor->xTask = pxTCB;
+			pxMonitor->xPeriod = xPeriod;
+			pxMonitor->xDeadline = ( xDeadline != ( TickType_t ) 0U ) ? xDeadline : xPeriod;
+			pxMonitor->xMaxResponse = ( TickType_t ) 0U;
+			pxMonitor->xRelease = ( TickType_t ) 0U;
+			pxMonitor->usReleases = 0U;
+			pxMonitor->usMisses = 0U;
+
+			for( x = ( UBaseType_t ) 0U; x < ( UBaseType_t ) configRELEASE_JITTER_BINS; x++ )
+			{
+				pxMonitor->usJitter[ x ] = 0U;
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		/* Only the task itself reads the pointer, in vTaskDelayUntil(). */
+		taskENTER_CRITICAL();
+		{
+			pxTCB->pxReleaseMonitor = pxMonitor;
+		}
+		taskEXIT_CRITICAL();
+	}
+	/*-----------------------------------------------------------*/
+
+	size_t xTaskReleaseMonitorDump( const TaskReleaseMonitor_t * const pxMonitor, char * const pcBuffer, size_t xBufferLength )
+	{
+	/* Name, up to 5 + configRELEASE_JITTER_BINS numbers of up to 10 digits
+	each with a leading space, newline and null. */
+	const size_t xMaxLength = ( size_t ) configMAX_TASK_NAME_LEN + ( ( 5U + ( size_t ) configRELEASE_JITTER_BINS ) * 11U ) + 2U;
+	const char *pcName;
+	char *pcWrite = pcBuffer;
+	UBaseType_t x;
+
+		configASSERT( pxMonitor );
+		configASSERT( pcBuffer );
+
+		if( xBufferLength < xMaxLength )
+		{
+			return 0;
+		}
+
+		pcName = pcTaskGetName( pxMonitor->xTask );
+		for( x = ( UBaseType_t ) 0U; ( x < ( UBaseType_t ) configMAX_TASK_NAME_LEN ) && ( pcName[ x ] != ( char ) 0x00 ); x++ )
+		{
+			/* Spaces would split the name into two fields. */
+			*pcWrite = ( pcName[ x ] == ' ' ) ? '_' : pcName[ x ];
+			pcWrite++;
+		}
+
+		pcWrite = prvWriteDecimal( pcWrite, ( uint32_t ) pxMonitor->xPeriod );
+		pcWrite = prvWriteDecimal( pcWrite, ( uint32_t ) pxMonitor->xDeadline );
+		pcWrite = prvWriteDecimal( pcWrite, ( uint32_t ) pxMonitor->usReleases );
+		pcWrite = prvWriteDecimal( pcWrite, ( uint32_t ) pxMonitor->usMisses );
+		pcWrite = prvWriteDecimal( pcWrite, ( uint32_t ) pxMonitor->xMaxResponse );
+
+		for( x = ( UBaseType_t ) 0U; x < ( UBaseType_t ) configRELEASE_JITTER_BINS; x++ )
+		{
+			pcWrite = prvWriteDecimal( pcWrite, ( uint32_t ) pxMonitor->usJitter[ x ] );
+		}
+
+		*pcWrite = '\n';
+		pcWrite++;
+		*pcWrite = ( char ) 0x00;
+
+		return ( size_t ) ( pcWrite - pcBuffer );
+	}
+	/*-----------------------------------------------------------*/
+
+	void vTaskReleaseMonitorMark( TickType_t xReleaseTime )
+	{
+	TaskReleaseMonitor_t * const pxMonitor = pxCurrentTCB->pxReleaseMonitor;
+
+		if( pxMonitor != NULL )
+		{
+			pxMonitor->xRelease = xReleaseTime;
+			prvRecordRelease( xReleaseTime );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	/*-----------------------------------------------------------*/
+
+	void vTaskReleaseMonitorComplete( void )
+	{
+	TaskReleaseMonitor_t * const pxMonitor = pxCurrentTCB->pxReleaseMonitor;
+
+		if( pxMonitor != NULL )
+		{
+			prvRecordCompletion( pxMonitor->xRelease );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	/*-----------------------------------------------------------*/
+
+	static void prvRecordCompletion( TickType_t xReleaseTime )
+	{
+	TaskReleaseMonitor_t * const pxMonitor = pxCurrentTCB->pxReleaseMonitor;
+	TickType_t xResponseTime;
+
+		if( pxMonitor != NULL )
+		{
+			xResponseTime = xTaskGetTickCount() - xReleaseTime;
+
+			if( xResponseTime > pxMonitor->xMaxResponse )
+			{
+				pxMonitor->xMaxResponse = xResponseTime;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			if( xResponseTime > pxMonitor->xDeadline )
+			{
+				if( pxMonitor->usMisses != 0xffffU )
+				{
+					pxMonitor->usMisses++;
+				}
+
+				#if( configUSE_DEADLINE_MISS_HOOK == 1 )
+				{
+					vApplicationDeadlineMissHook( pxMonitor->xTask, xResponseTime );
+				}
+				#endif
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	/*-----------------------------------------------------------*/
+
+	static void prvRecordRelease( TickType_t xReleaseTime )
+	{
+	TaskReleaseMonitor_t * const pxMonitor = pxCurrentTCB->pxReleaseMonitor;
+	TickType_t xLateness;
+
+		if( pxMonitor != NULL )
+		{
+			/* The wake time is never in the future when the task runs, as
+			vTaskDelayUntil() only returns early if it has already passed. */
+			xLateness = xTaskGetTickCount() - xReleaseTime;
+
+			if( xLateness >= ( TickType_t ) configRELEASE_JITTER_BINS )
+			{
+				xLateness = ( TickType_t ) configRELEASE_JITTER_BINS - ( TickType_t ) 1U;
+			}
+
+			if( pxMonitor->usJitter[ xLateness ] != 0xffffU )
+			{
+				pxMonitor->usJitter[ xLateness ]++;
+			}
+
+			if( pxMonitor->usReleases != 0xffffU )
+			{
+				pxMonitor->usReleases++;
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	/*-----------------------------------------------------------*/
+
+	static char *prvWriteDecimal( char *pcBuffer, uint32_t ulValue )
+	{
+	char cDigits[ 10 ];
+	UBaseType_t uxCount = ( UBaseType_t ) 0U;
+
+		do
+		{
+			cDigits[ uxCount ] = ( char ) ( '0' + ( char ) ( ulValue % 10UL ) );
+			uxCount++;
+			ulValue /= 10UL;
+		} while( ulValue != 0UL );
+
+		*pcBuffer = ' ';
+		pcBuffer++;
+
+		while( uxCount > ( UBaseType_t ) 0U )
+		{
+			uxCount--;
+			*pcBuffer = cDigits[ uxCount ];
+			pcBuffer++;
+		}
+
+		return pcBuffer;
+	}
+
+#endif /* configUSE_RELEASE_MONITOR */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_TASK_BUDGETS == 1 )
+
+	void vTaskSetBudget( TaskHandle_t xTask, TaskBudget_t * const pxBudget, TickType_t xBudget, TickType_t xPeriod )
+	{
+	TCB_t *pxTCB;
+
+		configASSERT( pxBudget );
+		configASSERT( ( xBudget > ( TickType_t ) 0U ) && ( xBudget <= xPeriod ) );
+
+		taskENTER_CRITICAL();
+		{
+			pxTCB = prvGetTCBFromHandle( xTask );
+
+			/* A task can only be given one budget. */
+			configASSERT( pxTCB->pxBudget == NULL );
+
+			/* The base priority of a ceiling mutex holder is the ceiling, not
+			the priority the budget should restore. */
+			#if ( configUSE_CEILING_MUTEXES == 1 )
+			{
+				configASSERT( pxTCB->uxMutexesHeld == ( UBaseType_t ) 0 );
+			}
+			#endif
+
+			pxBudget->xTask = pxTCB;
+			pxBudget->xBudget = xBudget;
+			pxBudget->xPeriod = xPeriod;
+			pxBudget->xRemaining = xBudget;
+			pxBudget->xReplenishTime = xTickCount;
+			pxBudget->xLastCharge = xTickCount;
+			pxBudget->uxThreshold = tskIDLE_PRIORITY;
+			pxBudget->usExhausted = 0U;
+
+			#if ( configUSE_MUTEXES == 1 )
+			{
+				pxBudget->uxPriority = pxTCB->uxBasePriority;
+			}
+			#else
+			{
+				pxBudget->uxPriority = pxTCB->uxPriority;
+			}
+			#endif
+
+			pxBudget->pxNext = pxBudgetList;
+			pxBudgetList = pxBudget;
+			pxTCB->pxBudget = pxBudget;
+		}
+		taskEXIT_CRITICAL();
+	}
+	/*-----------------------------------------------------------*/
+
+	static BaseType_t prvUpdateBudgets( void )
+	{
+	TaskBudget_t *pxBudget;
+	TCB_t *pxTCB;
+	BaseType_t xSwitchRequired = pdFALSE;
+
+		for( pxBudget = pxBudgetList; pxBudget != NULL; pxBudget = pxBudget->pxNext )
+		{
+			pxTCB = ( TCB_t * ) pxBudget->xTask;
+
+			if( ( pxBudget->xRemaining != pxBudget->xBudget ) && ( pxBudget->xReplenishTime == xTickCount ) )
+			{
+				if( pxBudget->xRemaining == ( TickType_t ) 0U )
+				{
+					/* Back from background priority. */
+					#if ( configUSE_PREEMPTION_THRESHOLD == 1 )
+					{
+						pxTCB->uxPreemptionThreshold = pxBudget->uxThreshold;
+					}
+					#endif
+
+					prvSetBudgetPriority( pxTCB, pxBudget->uxPriority );
+
+					if( ( pxTCB != pxCurrentTCB ) &&
+						( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ pxTCB->uxPriority ] ), &( pxTCB->xStateListItem ) ) != pdFALSE ) &&
+						( taskPREEMPTS_CURRENT( pxTCB ) ) )
+					{
+						xSwitchRequired = pdTRUE;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				pxBudget->xRemaining = pxBudget->xBudget;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			/* The tick that just ended is charged to the task that was running
+			when it ended. */
+			if( ( pxTCB == pxCurrentTCB ) && ( pxBudget->xRemaining != ( TickType_t ) 0U ) )
+			{
+				/* The budget used by a burst of execution is returned one
+				period after the burst started.  Only one replenishment is
+				kept, so a later burst moves it back and returns all of the
+				budget then.  The task can therefore never run for more than
+				its budget in any window of one period. */
+				if( ( pxBudget->xRemaining == pxBudget->xBudget ) || ( pxBudget->xLastCharge != ( TickType_t ) ( xTickCount - ( TickType_t ) 1U ) ) )
+				{
+					pxBudget->xReplenishTime = xTickCount + pxBudget->xPeriod;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				pxBudget->xLastCharge = xTickCount;
+				pxBudget->xRemaining--;
+
+				if( pxBudget->xRemaining == ( TickType_t ) 0U )
+				{
+					if( pxBudget->usExhausted != 0xffffU )
+					{
+						pxBudget->usExhausted++;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+
+					/* A raised preemption threshold would keep the task from
+					being preempted at background priority. */
+					#if ( configUSE_PREEMPTION_THRESHOLD == 1 )
+					{
+						pxBudget->uxThreshold = pxTCB->uxPreemptionThreshold;
+						pxTCB->uxPreemptionThreshold = tskIDLE_PRIORITY;
+					}
+					#endif
+
+					prvSetBudgetPriority( pxTCB, ( UBaseType_t ) configBUDGET_BACKGROUND_PRIORITY );
+					xSwitchRequired = pdTRUE;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+
+		return xSwitchRequired;
+	}
+	/*-----------------------------------------------------------*/
 
-				/* Increment the ucTasksDeleted variable so the idle task knows
-				there is a task that has been deleted and that it should therefore
-				check the xTasksWaitingTermination list. */
-				++uxDeletedTasksWaitingCleanUp;
+	static void prvSetBudgetPriority( TCB_t * const pxTCB, UBaseType_t uxNewPriority )
+	{
+	UBaseType_t uxPriorityUsedOnEntry = pxTCB->uxPriority;
 
-				/* The pre-delete hook is primarily for the Windows simulator,
-				in which Windows specific clean up operations are performed,
-				after which it is not possible to yield away from this task -
-				hence xYieldPending is used to latch that a context switch is
-				required. */
-				portPRE_TASK_DELETE_HOOK( pxTCB, &xYieldPending );
+		#if ( configUSE_MUTEXES == 1 )
+		{
+			/* A task holding a mutex keeps its priority until it gives the
+			last mutex back, prvGetBudgetBasePriority() then supplies the
+			priority to return to.  Changing the base priority here would be
+			undone by a ceiling mutex restoring the priority it saved, and
+			would drop a ceiling holder below the ceiling. */
+			if( pxTCB->uxMutexesHeld == ( UBaseType_t ) 0 )
+			{
+				pxTCB->uxPriority = uxNewPriority;
+				pxTCB->uxBasePriority = uxNewPriority;
 			}
 			else
 			{
-				--uxCurrentNumberOfTasks;
-				prvDeleteTCB( pxTCB );
-
-				/* Reset the next expected unblock time in case it referred to
-				the task that has just been deleted. */
-				prvResetNextTaskUnblockTime();
+				mtCOVERAGE_TEST_MARKER();
 			}
-
-			traceTASK_DELETE( pxTCB );
 		}
-		taskEXIT_CRITICAL();
+		#else
+		{
+			pxTCB->uxPriority = uxNewPriority;
+		}
+		#endif
 
-		/* Force a reschedule if it is the currently running task that has just
-		been deleted. */
-		if( xSchedulerRunning != pdFALSE )
+		if( pxTCB->uxPriority != uxPriorityUsedOnEntry )
 		{
-			if( pxTCB == pxCurrentTCB )
+			if( ( listGET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ) ) & taskEVENT_LIST_ITEM_VALUE_IN_USE ) == 0UL )
 			{
-				configASSERT( uxSchedulerSuspended == 0 );
-				portYIELD_WITHIN_API();
+				listSET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ), ( ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) pxTCB->uxPriority ) ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
 			}
 			else
 			{
 				mtCOVERAGE_TEST_MARKER();
 			}
-		}
-	}
-
-#endif /* INCLUDE_vTaskDelete */
-/*-----------------------------------------------------------*/
-
-#if ( INCLUDE_vTaskDelayUntil == 1 )
-
-	void vTaskDelayUntil( TickType_t * const pxPreviousWakeTime, const TickType_t xTimeIncrement )
-	{
-	TickType_t xTimeToWake;
-	BaseType_t xAlreadyYielded, xShouldDelay = pdFALSE;
-
-		configASSERT( pxPreviousWakeTime );
-		configASSERT( ( xTimeIncrement > 0U ) );
-		configASSERT( uxSchedulerSuspended == 0 );
-
-		vTaskSuspendAll();
-		{
-			/* Minor optimisation.  The tick count cannot change in this
-			block. */
-			const TickType_t xConstTickCount = xTickCount;
 
-			/* Generate the tick time at which the task wants to wake. */
-			xTimeToWake = *pxPreviousWakeTime + xTimeIncrement;
-
-			if( xConstTickCount < *pxPreviousWakeTime )
+			if( listIS_CONTAINED_WITHIN( &( pxReadyTasksLists[ uxPriorityUsedOnEntry ] ), &( pxTCB->xStateListItem ) ) != pdFALSE )
 			{
-				/* The tick count has overflowed since this function was
-				lasted called.  In this case the only time we should ever
-				actually delay is if the wake time has also	overflowed,
-				and the wake time is greater than the tick time.  When this
-				is the case it is as if neither time had overflowed. */
-				if( ( xTimeToWake < *pxPreviousWakeTime ) && ( xTimeToWake > xConstTickCount ) )
+				if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
 				{
-					xShouldDelay = pdTRUE;
+					portRESET_READY_PRIORITY( uxPriorityUsedOnEntry, uxTopReadyPriority );
 				}
 				else
 				{
 					mtCOVERAGE_TEST_MARKER();
 				}
+				prvAddTaskToReadyList( pxTCB );
 			}
 			else
 			{
-				/* The tick time has not overflowed.  In this case we will
-				delay if either the wake time has overflowed, and/or the
-				tick time is less than the wake time. */
-				if( ( xTimeToWake < *pxPreviousWakeTime ) || ( xTimeToWake > xConstTickCount ) )
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	/*-----------------------------------------------------------*/
+
+	#if ( configUSE_MUTEXES == 1 )
+
+		static UBaseType_t prvGetBudgetBasePriority( const TCB_t * const pxTCB, UBaseType_t uxPriority )
+		{
+			if( pxTCB->pxBudget != NULL )
+			{
+				if( pxTCB->pxBudget->xRemaining == ( TickType_t ) 0U )
 				{
-					xShouldDelay = pdTRUE;
+					uxPriority = ( UBaseType_t ) configBUDGET_BACKGROUND_PRIORITY;
 				}
 				else
 				{
-					mtCOVERAGE_TEST_MARKER();
+					uxPriority = pxTCB->pxBudget->uxPriority;
 				}
 			}
-
-			/* Update the wake time ready for the next call. */
-			*pxPreviousWakeTime = xTimeToWake;
-
-			if( xShouldDelay != pdFALSE )
-			{
-				traceTASK_DELAY_UNTIL( xTimeToWake );
-
-				/* prvAddCurrentTaskToDelayedList() needs the block time, not
-				the time to wake, so subtract the current tick count. */
-				prvAddCurrentTaskToDelayedList( xTimeToWake - xConstTickCount, pdFALSE );
-			}
 			else
 			{
 				mtCOVERAGE_TEST_MARKER();
 			}
-		}
-		xAlreadyYielded = xTaskResumeAll();
 
-		/* Force a reschedule if xTaskResumeAll has not already done so, we may
-		have put ourselves to sleep. */
-		if( xAlreadyYielded == pdFALSE )
-		{
-			portYIELD_WITHIN_API();
+			return uxPriority;
 		}
-		else
+
+	#endif /* configUSE_MUTEXES */
+	/*-----------------------------------------------------------*/
+
+	#if ( INCLUDE_vTaskDelete == 1 )
+
+		static void prvRemoveBudget( const TaskBudget_t * const pxBudget )
 		{
-			mtCOVERAGE_TEST_MARKER();
+		TaskBudget_t **ppxLink;
+
+			for( ppxLink = &pxBudgetList; *ppxLink != NULL; ppxLink = &( ( *ppxLink )->pxNext ) )
+			{
+				if( *ppxLink == pxBudget )
+				{
+					*ppxLink = pxBudget->pxNext;
+					break;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
 		}
-	}
 
-#endif /* INCLUDE_vTaskDelayUntil */
+	#endif /* INCLUDE_vTaskDelete */
+
+#endif /* configUSE_TASK_BUDGETS */
 /*-----------------------------------------------------------*/
 
 #if ( INCLUDE_vTaskDelay == 1 )
@@ -1565,6 +2530,31 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 			}
 			#endif
 
+			#if ( configUSE_TASK_BUDGETS == 1 )
+			{
+				if( pxTCB->pxBudget != NULL )
+				{
+					/* Replenishment restores the budget priority, so that is
+					what changes.  A task that has used up its budget stays at
+					background priority until then. */
+					pxTCB->pxBudget->uxPriority = uxNewPriority;
+
+					if( pxTCB->pxBudget->xRemaining == ( TickType_t ) 0U )
+					{
+						uxNewPriority = uxCurrentBasePriority;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			#endif
+
 			if( uxCurrentBasePriority != uxNewPriority )
 			{
 				/* The priority change may have readied a task of higher
@@ -1863,7 +2853,7 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 					prvAddTaskToReadyList( pxTCB );
 
 					/* A higher priority task may have just been resumed. */
-					if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
+					if( taskSHOULD_SWITCH_TO( pxTCB ) )
 					{
 						/* This yield may not cause the task just resumed to run,
 						but will leave the lists in the correct state for the
@@ -1931,7 +2921,7 @@ static void prvAddNewTaskToReadyList( TCB_t *pxNewTCB )
 				{
 					/* Ready lists can be accessed so move the task from the
 					suspended list to the ready list directly. */
-					if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
+					if( taskSHOULD_SWITCH_TO( pxTCB ) )
 					{
 						xYieldRequired = pdTRUE;
 					}
@@ -2203,7 +3193,7 @@ BaseType_t xAlreadyYielded = pdFALSE;
 
 					/* If the moved task has a priority higher than the current
 					task then a yield must be performed. */
-					if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
+					if( taskSHOULD_SWITCH_TO( pxTCB ) )
 					{
 						xYieldPending = pdTRUE;
 					}
@@ -2326,6 +3316,116 @@ UBaseType_t uxSavedInterruptStatus;
 }
 /*-----------------------------------------------------------*/
 
+#if( configUSE_TICK_EPOCH == 1 )
+
+	uint32_t ulTaskGetTickCount32( void )
+	{
+	uint32_t ulReturn;
+
+		/* The tick count and the overflow count are only updated together by
+		the tick interrupt, so a critical section gives a consistent pair. */
+		taskENTER_CRITICAL();
+		{
+			ulReturn = taskGET_TICK_COUNT_32();
+		}
+		taskEXIT_CRITICAL();
+
+		return ulReturn;
+	}
+
+#endif /* configUSE_TICK_EPOCH */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_TICK_EPOCH == 1 )
+
+	uint32_t ulTaskGetTickCount32FromISR( void )
+	{
+	uint32_t ulReturn;
+	UBaseType_t uxSavedInterruptStatus;
+
+		portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		{
+			ulReturn = taskGET_TICK_COUNT_32();
+		}
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+		return ulReturn;
+	}
+
+#endif /* configUSE_TICK_EPOCH */
+/*-----------------------------------------------------------*/
+
+#if( ( configUSE_TICK_EPOCH == 1 ) && ( INCLUDE_vTaskDelay == 1 ) )
+
+	void vTaskDelayLong( uint32_t ulTicksToDelay )
+	{
+	TimeOutLong_t xTimeOut;
+	TickType_t xBlockTime;
+
+		vTaskSetTimeOutStateLong( &xTimeOut, ulTicksToDelay );
+
+		for( ;; )
+		{
+			xBlockTime = xTaskGetTimeOutLongBlockTime( &xTimeOut );
+
+			if( xBlockTime == ( TickType_t ) 0U )
+			{
+				break;
+			}
+
+			vTaskDelay( xBlockTime );
+		}
+	}
+
+#endif /* ( configUSE_TICK_EPOCH == 1 ) && ( INCLUDE_vTaskDelay == 1 ) */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_TICK_EPOCH == 1 )
+
+	void vTaskSetTimeOutStateLong( TimeOutLong_t * const pxTimeOut, uint32_t ulTicksToWait )
+	{
+		configASSERT( pxTimeOut );
+
+		pxTimeOut->ulTimeOnEntering = ulTaskGetTickCount32();
+		pxTimeOut->ulTicksToWait = ulTicksToWait;
+	}
+
+#endif /* configUSE_TICK_EPOCH */
+/*-----------------------------------------------------------*/
+
+#if( configUSE_TICK_EPOCH == 1 )
+
+	TickType_t xTaskGetTimeOutLongBlockTime( TimeOutLong_t * const pxTimeOut )
+	{
+	uint32_t ulElapsed;
+	TickType_t xReturn;
+
+		configASSERT( pxTimeOut );
+
+		ulElapsed = ulTaskGetTickCount32() - pxTimeOut->ulTimeOnEntering;
+
+		if( ulElapsed >= pxTimeOut->ulTicksToWait )
+		{
+			xReturn = ( TickType_t ) 0U;
+		}
+		else if( ( pxTimeOut->ulTicksToWait - ulElapsed ) < ( uint32_t ) portMAX_DELAY )
+		{
+			xReturn = ( TickType_t ) ( pxTimeOut->ulTicksToWait - ulElapsed );
+		}
+		else
+		{
+			/* portMAX_DELAY itself would block indefinitely. */
+			xReturn = portMAX_DELAY - ( TickType_t ) 1U;
+		}
+
+		return xReturn;
+	}
+
+#endif /* configUSE_TICK_EPOCH */
+/*-----------------------------------------------------------*/
+
 UBaseType_t uxTaskGetNumberOfTasks( void )
 {
 	/* A critical section is not required because the variables are of type
@@ -2635,7 +3735,7 @@ implementations require configUSE_TICKLESS_IDLE to be set to a value other than
 					/* Preemption is on, but a context switch should only be
 					performed if the unblocked task has a priority that is
 					equal to or higher than the currently executing task. */
-					if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+					if( taskPREEMPTS_CURRENT( pxTCB ) )
 					{
 						/* Pend the yield to be performed when the scheduler
 						is unsuspended. */
@@ -2758,7 +3858,7 @@ BaseType_t xSwitchRequired = pdFALSE;
 						only be performed if the unblocked task has a
 						priority that is equal to or higher than the
 						currently executing task. */
-						if( pxTCB->uxPriority >= pxCurrentTCB->uxPriority )
+						if( taskSHOULD_SWITCH_TO( pxTCB ) )
 						{
 							xSwitchRequired = pdTRUE;
 						}
@@ -2772,12 +3872,26 @@ BaseType_t xSwitchRequired = pdFALSE;
 			}
 		}
 
+		#if ( configUSE_TASK_BUDGETS == 1 )
+		{
+			if( prvUpdateBudgets() != pdFALSE )
+			{
+				xSwitchRequired = pdTRUE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#endif /* configUSE_TASK_BUDGETS */
+
 		/* Tasks of equal priority to the currently running task will share
 		processing time (time slice) if preemption is on, and the application
 		writer has not explicitly turned time slicing off. */
 		#if ( ( configUSE_PREEMPTION == 1 ) && ( configUSE_TIME_SLICING == 1 ) )
 		{
-			if( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ pxCurrentTCB->uxPriority ] ) ) > ( UBaseType_t ) 1 )
+			if( ( listCURRENT_LIST_LENGTH( &( pxReadyTasksLists[ pxCurrentTCB->uxPriority ] ) ) > ( UBaseType_t ) 1 ) &&
+				( taskTHRESHOLD_RAISED( pxCurrentTCB ) == pdFALSE ) )
 			{
 				xSwitchRequired = pdTRUE;
 			}
@@ -2995,7 +4109,24 @@ void vTaskSwitchContext( void )
 
 		/* Select a new task to run using either the generic C or port
 		optimised asm code. */
-		taskSELECT_HIGHEST_PRIORITY_TASK(); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+		#if( configUSE_PREEMPTION_THRESHOLD == 1 )
+		{
+			/* The task switched out keeps running if it is still ready and
+			no ready task is above its preemption threshold. */
+			if( prvThresholdHoldsCurrentTask() == pdFALSE )
+			{
+				taskSELECT_HIGHEST_PRIORITY_TASK(); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		#else
+		{
+			taskSELECT_HIGHEST_PRIORITY_TASK(); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+		}
+		#endif /* configUSE_PREEMPTION_THRESHOLD */
 		traceTASK_SWITCHED_IN();
 
 		/* After the new task is switched in, update the global errno. */
@@ -3138,7 +4269,7 @@ BaseType_t xReturn;
 		vListInsertEnd( &( xPendingReadyList ), &( pxUnblockedTCB->xEventListItem ) );
 	}
 
-	if( pxUnblockedTCB->uxPriority > pxCurrentTCB->uxPriority )
+	if( taskPREEMPTS_CURRENT( pxUnblockedTCB ) )
 	{
 		/* Return true if the task removed from the event list has a higher
 		priority than the calling task.  This allows the calling task to know if
@@ -3181,7 +4312,7 @@ TCB_t *pxUnblockedTCB;
 	( void ) uxListRemove( &( pxUnblockedTCB->xStateListItem ) );
 	prvAddTaskToReadyList( pxUnblockedTCB );
 
-	if( pxUnblockedTCB->uxPriority > pxCurrentTCB->uxPriority )
+	if( taskPREEMPTS_CURRENT( pxUnblockedTCB ) )
 	{
 		/* The unblocked task has a priority above that of the calling task, so
 		a context switch is required.  This function is called with the
@@ -3192,6 +4323,63 @@ TCB_t *pxUnblockedTCB;
 }
 /*-----------------------------------------------------------*/
 
+#if( configUSE_EVENT_GROUP_DIRECT_FROM_ISR == 1 )
+
+	BaseType_t xTaskRemoveFromUnorderedEventListFromISR( ListItem_t * pxEventListItem, const TickType_t xItemValue )
+	{
+	TCB_t *pxUnblockedTCB;
+	BaseType_t xReturn;
+
+		/* THIS FUNCTION MUST BE CALLED WITH INTERRUPTS DISABLED.  Unlike
+		vTaskRemoveFromUnorderedEventList() the scheduler need not be suspended,
+		so it can be used by an interrupt that sets event bits directly.  The
+		event group module only touches the event list with interrupts disabled
+		when it is built for direct setting from interrupts. */
+		listSET_LIST_ITEM_VALUE( pxEventListItem, xItemValue | taskEVENT_LIST_ITEM_VALUE_IN_USE );
+
+		pxUnblockedTCB = listGET_LIST_ITEM_OWNER( pxEventListItem ); /*lint !e9079 void * is used as this macro is used with timers and co-routines too.  Alignment is known to be fine as the type of the pointer stored and retrieved is the same. */
+		configASSERT( pxUnblockedTCB );
+		( void ) uxListRemove( pxEventListItem );
+
+		if( uxSchedulerSuspended == ( UBaseType_t ) pdFALSE )
+		{
+			( void ) uxListRemove( &( pxUnblockedTCB->xStateListItem ) );
+			prvAddTaskToReadyList( pxUnblockedTCB );
+
+			#if( configUSE_TICKLESS_IDLE != 0 )
+			{
+				/* See xTaskRemoveFromEventList(). */
+				prvResetNextTaskUnblockTime();
+			}
+			#endif
+		}
+		else
+		{
+			/* The delayed and ready lists cannot be accessed, so hold the task
+			pending until the scheduler is resumed.  The event list item is free
+			as it was removed from the event group above. */
+			vListInsertEnd( &( xPendingReadyList ), &( pxUnblockedTCB->xEventListItem ) );
+		}
+
+		if( taskPREEMPTS_CURRENT( pxUnblockedTCB ) )
+		{
+			xReturn = pdTRUE;
+
+			/* Mark that a yield is pending in case the caller does not use the
+			return value. */
+			xYieldPending = pdTRUE;
+		}
+		else
+		{
+			xReturn = pdFALSE;
+		}
+
+		return xReturn;
+	}
+
+#endif /* configUSE_EVENT_GROUP_DIRECT_FROM_ISR */
+/*-----------------------------------------------------------*/
+
 void vTaskSetTimeOutState( TimeOut_t * const pxTimeOut )
 {
 	configASSERT( pxTimeOut );
@@ -3638,6 +4826,16 @@ static void prvCheckTasksWaitingTermination( void )
 		}
 		#endif
 
+		#if ( configUSE_TASK_BUDGETS == 1 )
+		{
+			pxTaskStatus->pxBudget = pxTCB->pxBudget;
+		}
+		#else
+		{
+			pxTaskStatus->pxBudget = NULL;
+		}
+		#endif
+
 		/* Obtaining the task state is a little fiddly, so is only done if the
 		value of eState passed into this function is eInvalid - otherwise the
 		state is just set to whatever is passed in. */
@@ -4049,6 +5247,21 @@ TCB_t *pxTCB;
 			configASSERT( pxTCB->uxMutexesHeld );
 			( pxTCB->uxMutexesHeld )--;
 
+			/* Budget priority changes are held back while mutexes are held,
+			apply the one that is due. */
+			#if ( configUSE_TASK_BUDGETS == 1 )
+			{
+				if( pxTCB->uxMutexesHeld == ( UBaseType_t ) 0 )
+				{
+					pxTCB->uxBasePriority = prvGetBudgetBasePriority( pxTCB, pxTCB->uxBasePriority );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			#endif
+
 			/* Has the holder of the mutex inherited the priority of another
 			task? */
 			if( pxTCB->uxPriority != pxTCB->uxBasePriority )
@@ -4112,6 +5325,142 @@ TCB_t *pxTCB;
 #endif /* configUSE_MUTEXES */
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_CEILING_MUTEXES == 1 )
+
+	UBaseType_t uxTaskPriorityRaiseToCeiling( UBaseType_t uxCeilingPriority )
+	{
+	UBaseType_t uxSavedPriority;
+
+		/* Called from a critical section by the task that has just taken the
+		mutex, so the task is running and its event list item is not in use. */
+		uxSavedPriority = pxCurrentTCB->uxBasePriority;
+
+		/* A task with a priority above the ceiling could preempt the holder and
+		then find the mutex held. */
+		configASSERT( uxSavedPriority <= uxCeilingPriority );
+
+		if( uxCeilingPriority > uxSavedPriority )
+		{
+			/* The ceiling becomes the base priority, so disinheriting a priority
+			inheritance mutex taken inside the ceiling section does not drop the
+			task below the ceiling. */
+			pxCurrentTCB->uxBasePriority = uxCeilingPriority;
+
+			if( uxCeilingPriority > pxCurrentTCB->uxPriority )
+			{
+				if( uxListRemove( &( pxCurrentTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
+				{
+					taskRESET_READY_PRIORITY( pxCurrentTCB->uxPriority );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				/* Raising the running task never requires a context switch. */
+				traceTASK_PRIORITY_INHERIT( pxCurrentTCB, uxCeilingPriority );
+				pxCurrentTCB->uxPriority = uxCeilingPriority;
+				listSET_LIST_ITEM_VALUE( &( pxCurrentTCB->xEventListItem ), ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) uxCeilingPriority ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+				prvAddTaskToReadyList( pxCurrentTCB );
+			}
+			else
+			{
+				/* Already running above the ceiling through inheritance. */
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return uxSavedPriority;
+	}
+
+#endif /* configUSE_CEILING_MUTEXES */
+/*-----------------------------------------------------------*/
+
+#if ( configUSE_CEILING_MUTEXES == 1 )
+
+	BaseType_t xTaskPriorityRestoreFromCeiling( TaskHandle_t const pxMutexHolder, UBaseType_t uxSavedPriority )
+	{
+	TCB_t * const pxTCB = pxMutexHolder;
+	BaseType_t xReturn = pdFALSE;
+	UBaseType_t uxNewPriority;
+
+		if( pxMutexHolder != NULL )
+		{
+			/* As in xTaskPriorityDisinherit(), the mutex can only be given by
+			the running task. */
+			configASSERT( pxTCB == pxCurrentTCB );
+			configASSERT( pxTCB->uxMutexesHeld );
+			( pxTCB->uxMutexesHeld )--;
+
+			/* The saved priority is stale if the budget ran out or was
+			replenished inside the section, as budget priority changes are
+			held back while mutexes are held. */
+			#if ( configUSE_TASK_BUDGETS == 1 )
+			{
+				if( pxTCB->uxMutexesHeld == ( UBaseType_t ) 0 )
+				{
+					uxSavedPriority = prvGetBudgetBasePriority( pxTCB, uxSavedPriority );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			#endif
+
+			/* Keep a priority inherited above the ceiling while other mutexes
+			are still held, otherwise drop to the saved priority. */
+			if( ( pxTCB->uxPriority == pxTCB->uxBasePriority ) || ( pxTCB->uxMutexesHeld == ( UBaseType_t ) 0 ) )
+			{
+				uxNewPriority = uxSavedPriority;
+			}
+			else
+			{
+				uxNewPriority = pxTCB->uxPriority;
+			}
+
+			pxTCB->uxBasePriority = uxSavedPriority;
+
+			if( uxNewPriority != pxTCB->uxPriority )
+			{
+				if( uxListRemove( &( pxTCB->xStateListItem ) ) == ( UBaseType_t ) 0 )
+				{
+					taskRESET_READY_PRIORITY( pxTCB->uxPriority );
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+
+				traceTASK_PRIORITY_DISINHERIT( pxTCB, uxNewPriority );
+				pxTCB->uxPriority = uxNewPriority;
+				listSET_LIST_ITEM_VALUE( &( pxTCB->xEventListItem ), ( TickType_t ) configMAX_PRIORITIES - ( TickType_t ) uxNewPriority ); /*lint !e961 MISRA exception as the casts are only redundant for some ports. */
+				prvAddTaskToReadyList( pxTCB );
+
+				/* A task that was kept out by the ceiling may now be the
+				highest priority ready task. */
+				xReturn = pdTRUE;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return xReturn;
+	}
+
+#endif /* configUSE_CEILING_MUTEXES */
+/*-----------------------------------------------------------*/
+
 #if ( configUSE_MUTEXES == 1 )
 
 	void vTaskPriorityDisinheritAfterTimeout( TaskHandle_t const pxMutexHolder, UBaseType_t uxHighestPriorityWaitingTask )
@@ -4798,7 +6147,7 @@ TickType_t uxReturn;
 				}
 				#endif
 
-				if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+				if( taskPREEMPTS_CURRENT( pxTCB ) )
 				{
 					/* The notified task has a priority above the currently
 					executing task so a yield is required. */
@@ -4923,7 +6272,7 @@ TickType_t uxReturn;
 					vListInsertEnd( &( xPendingReadyList ), &( pxTCB->xEventListItem ) );
 				}
 
-				if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+				if( taskPREEMPTS_CURRENT( pxTCB ) )
 				{
 					/* The notified task has a priority above the currently
 					executing task so a yield is required. */
@@ -5011,7 +6360,7 @@ TickType_t uxReturn;
 					vListInsertEnd( &( xPendingReadyList ), &( pxTCB->xEventListItem ) );
 				}
 
-				if( pxTCB->uxPriority > pxCurrentTCB->uxPriority )
+				if( taskPREEMPTS_CURRENT( pxTCB ) )
 				{
 					/* The notified task has a priority above the currently
 					executing task so a yield is required. */
@@ -5069,6 +6418,189 @@ TickType_t uxReturn;
 #endif /* configUSE_TASK_NOTIFICATIONS */
 /*-----------------------------------------------------------*/
 
+#if( configUSE_NOTIFY_SEMAPHORES == 1 )
+
+	/* The count of a notification semaphore lives in the notification value of
+	the task that owns it.  Until the owner is bound by the first take the count
+	is held in uxPendingCount. */
+	typedef struct tskNotifySemaphore
+	{
+		TCB_t * volatile pxOwner;
+		UBaseType_t uxMaxCount;
+		volatile UBaseType_t uxPendingCount;
+	} NotifySemaphore_t;
+
+	#if( configSUPPORT_DYNAMIC_ALLOCATION == 1 )
+
+		NotifySemaphoreHandle_t xTaskNotifySemaphoreCreate( UBaseType_t uxMaxCount, UBaseType_t uxInitialCount )
+		{
+		NotifySemaphore_t *pxSemaphore;
+
+			configASSERT( uxMaxCount != ( UBaseType_t ) 0 );
+			configASSERT( uxInitialCount <= uxMaxCount );
+
+			pxSemaphore = ( NotifySemaphore_t * ) pvPortMalloc( sizeof( NotifySemaphore_t ) );
+
+			if( pxSemaphore != NULL )
+			{
+				pxSemaphore->pxOwner = NULL;
+				pxSemaphore->uxMaxCount = uxMaxCount;
+				pxSemaphore->uxPendingCount = uxInitialCount;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+
+			return pxSemaphore;
+		}
+
+	#endif /* configSUPPORT_DYNAMIC_ALLOCATION */
+/*-----------------------------------------------------------*/
+
+	BaseType_t xTaskNotifySemaphoreTake( NotifySemaphoreHandle_t xSemaphore, TickType_t xTicksToWait )
+	{
+	NotifySemaphore_t * const pxSemaphore = xSemaphore;
+
+		configASSERT( pxSemaphore );
+
+		if( pxSemaphore->pxOwner != pxCurrentTCB )
+		{
+			taskENTER_CRITICAL();
+			{
+				/* Only one task can ever block on the notification value, a
+				second taker is a design error. */
+				configASSERT( pxSemaphore->pxOwner == NULL );
+
+				pxCurrentTCB->ulNotifiedValue = ( uint32_t ) pxSemaphore->uxPendingCount;
+				pxSemaphore->uxPendingCount = ( UBaseType_t ) 0;
+				pxSemaphore->pxOwner = pxCurrentTCB;
+			}
+			taskEXIT_CRITICAL();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		/* ulTaskNotifyTake() blocks while the count is zero and decrements it
+		on exit, which is exactly the semaphore take operation. */
+		if( ulTaskNotifyTake( pdFALSE, xTicksToWait ) != 0UL )
+		{
+			return pdPASS;
+		}
+		else
+		{
+			return pdFAIL;
+		}
+	}
+/*-----------------------------------------------------------*/
+
+	BaseType_t xTaskNotifySemaphoreGive( NotifySemaphoreHandle_t xSemaphore )
+	{
+	NotifySemaphore_t * const pxSemaphore = xSemaphore;
+	BaseType_t xReturn = pdFAIL;
+
+		configASSERT( pxSemaphore );
+
+		taskENTER_CRITICAL();
+		{
+			if( pxSemaphore->pxOwner == NULL )
+			{
+				if( pxSemaphore->uxPendingCount < pxSemaphore->uxMaxCount )
+				{
+					( pxSemaphore->uxPendingCount )++;
+					xReturn = pdPASS;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else if( pxSemaphore->pxOwner->ulNotifiedValue < ( uint32_t ) pxSemaphore->uxMaxCount )
+			{
+				/* Critical sections nest, so the check above and the
+				increment are atomic.  Unblocks the owner if it is waiting. */
+				xReturn = xTaskGenericNotify( pxSemaphore->pxOwner, 0, eIncrement, NULL );
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		return xReturn;
+	}
+/*-----------------------------------------------------------*/
+
+	BaseType_t xTaskNotifySemaphoreGiveFromISR( NotifySemaphoreHandle_t xSemaphore, BaseType_t *pxHigherPriorityTaskWoken )
+	{
+	NotifySemaphore_t * const pxSemaphore = xSemaphore;
+	BaseType_t xReturn = pdFAIL;
+	UBaseType_t uxSavedInterruptStatus;
+
+		configASSERT( pxSemaphore );
+
+		/* See the comment in xTaskGenericNotifyFromISR(). */
+		portASSERT_IF_INTERRUPT_PRIORITY_INVALID();
+
+		uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+		{
+			if( pxSemaphore->pxOwner == NULL )
+			{
+				if( pxSemaphore->uxPendingCount < pxSemaphore->uxMaxCount )
+				{
+					( pxSemaphore->uxPendingCount )++;
+					xReturn = pdPASS;
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else if( pxSemaphore->pxOwner->ulNotifiedValue < ( uint32_t ) pxSemaphore->uxMaxCount )
+			{
+				vTaskNotifyGiveFromISR( pxSemaphore->pxOwner, pxHigherPriorityTaskWoken );
+				xReturn = pdPASS;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+		return xReturn;
+	}
+/*-----------------------------------------------------------*/
+
+	UBaseType_t uxTaskNotifySemaphoreGetCount( NotifySemaphoreHandle_t xSemaphore )
+	{
+	NotifySemaphore_t * const pxSemaphore = xSemaphore;
+	UBaseType_t uxReturn;
+
+		configASSERT( pxSemaphore );
+
+		taskENTER_CRITICAL();
+		{
+			if( pxSemaphore->pxOwner == NULL )
+			{
+				uxReturn = pxSemaphore->uxPendingCount;
+			}
+			else
+			{
+				uxReturn = ( UBaseType_t ) pxSemaphore->pxOwner->ulNotifiedValue;
+			}
+		}
+		taskEXIT_CRITICAL();
+
+		return uxReturn;
+	}
+
+#endif /* configUSE_NOTIFY_SEMAPHORES */
+/*-----------------------------------------------------------*/
+
 #if( ( configGENERATE_RUN_TIME_STATS == 1 ) && ( INCLUDE_xTaskGetIdleTaskHandle == 1 ) )
 	TickType_t xTaskGetIdleRunTimeCounter( void )
 	{
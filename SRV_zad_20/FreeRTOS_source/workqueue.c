@@ -0,0 +1,201 @@
+/*
+ * Deferred interrupt work queues for FreeRTOS, see workqueue.h.
+ *
+ * Each class is a ring buffer of work items with the class worker as its only
+ * consumer.  The ring buffer allows a single producer, so several tasks or
+ * interrupts submitting to one class are serialised with a critical section
+ * around the push.  The push only copies one small item, so the critical
+ * section is short.
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/* Standard includes. */
+#include <stdlib.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "ringbuffer.h"
+#include "workqueue.h"
+
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* This entire source file will be skipped if the application is not configured
+to include work queue functionality. */
+#if( configUSE_WORK_QUEUES == 1 )
+
+typedef struct xWORK_ITEM
+{
+	WorkFunction_t pxFunction;
+	void *pvParameter1;
+	uint32_t ulParameter2;
+} WorkItem_t;
+
+typedef struct xWORK_QUEUE_CLASS
+{
+	RingBuffer_t xItems;			/*< Pending work, consumed by xWorker. */
+	TaskHandle_t xWorker;			/*< NULL until the class is created. */
+} WorkQueueClass_t;
+
+PRIVILEGED_DATA static WorkQueueClass_t xClasses[ configWORK_QUEUE_CLASSES ];
+
+/*-----------------------------------------------------------*/
+
+/*
+ * The worker task, one per created class.  pvParameters points to the class.
+ */
+static portTASK_FUNCTION_PROTO( prvWorkerTask, pvParameters ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+BaseType_t xWorkQueueCreateClass( UBaseType_t uxClass, UBaseType_t uxPriority, UBaseType_t uxLength )
+{
+WorkQueueClass_t *pxClass;
+uint8_t *pucStorage;
+char cName[ 4 ] = "WQ0";
+BaseType_t xReturn = pdFAIL;
+
+	configASSERT( uxClass < ( UBaseType_t ) configWORK_QUEUE_CLASSES );
+	configASSERT( uxLength > ( UBaseType_t ) 0 );
+
+	pxClass = &( xClasses[ uxClass ] );
+	configASSERT( pxClass->xWorker == NULL );
+
+	pucStorage = ( uint8_t * ) pvPortMalloc( ringbufferSTORAGE_SIZE( ( size_t ) uxLength, sizeof( WorkItem_t ) ) );
+
+	if( pucStorage != NULL )
+	{
+		vRingBufferInit( &( pxClass->xItems ), pucStorage, uxLength, ( UBaseType_t ) sizeof( WorkItem_t ) );
+		cName[ 2 ] = ( char ) ( '0' + ( char ) uxClass );
+
+		/* The worker must not run before it is registered as the consumer,
+		which it would do if it has a higher priority than the calling task. */
+		vTaskSuspendAll();
+		{
+			xReturn = xTaskCreate( prvWorkerTask, cName, configWORK_QUEUE_STACK_DEPTH, ( void * ) pxClass, uxPriority, &( pxClass->xWorker ) );
+
+			if( xReturn == pdPASS )
+			{
+				vRingBufferSetConsumerTask( &( pxClass->xItems ), pxClass->xWorker, ( UBaseType_t ) 1 );
+			}
+			else
+			{
+				pxClass->xWorker = NULL;
+			}
+		}
+		( void ) xTaskResumeAll();
+
+		/* heap_1 cannot free the storage, so the class simply stays unused
+		if the worker could not be created. */
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xWorkQueueSubmit( UBaseType_t uxClass, WorkFunction_t pxFunction, void *pvParameter1, uint32_t ulParameter2 )
+{
+WorkQueueClass_t *pxClass;
+WorkItem_t xItem;
+BaseType_t xReturn;
+
+	configASSERT( uxClass < ( UBaseType_t ) configWORK_QUEUE_CLASSES );
+	configASSERT( pxFunction );
+
+	pxClass = &( xClasses[ uxClass ] );
+	configASSERT( pxClass->xWorker );
+
+	xItem.pxFunction = pxFunction;
+	xItem.pvParameter1 = pvParameter1;
+	xItem.ulParameter2 = ulParameter2;
+
+	taskENTER_CRITICAL();
+	{
+		xReturn = xRingBufferPush( &( pxClass->xItems ), &xItem );
+	}
+	taskEXIT_CRITICAL();
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xWorkQueueSubmitFromISR( UBaseType_t uxClass, WorkFunction_t pxFunction, void *pvParameter1, uint32_t ulParameter2, BaseType_t * const pxHigherPriorityTaskWoken )
+{
+WorkQueueClass_t *pxClass;
+WorkItem_t xItem;
+BaseType_t xReturn;
+UBaseType_t uxSavedInterruptStatus;
+
+	configASSERT( uxClass < ( UBaseType_t ) configWORK_QUEUE_CLASSES );
+	configASSERT( pxFunction );
+
+	pxClass = &( xClasses[ uxClass ] );
+	configASSERT( pxClass->xWorker );
+
+	xItem.pxFunction = pxFunction;
+	xItem.pvParameter1 = pvParameter1;
+	xItem.ulParameter2 = ulParameter2;
+
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		xReturn = xRingBufferPushFromISR( &( pxClass->xItems ), &xItem, pxHigherPriorityTaskWoken );
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxWorkQueueItemsWaiting( UBaseType_t uxClass )
+{
+	configASSERT( uxClass < ( UBaseType_t ) configWORK_QUEUE_CLASSES );
+
+	if( xClasses[ uxClass ].xWorker == NULL )
+	{
+		return ( UBaseType_t ) 0;
+	}
+
+	return uxRingBufferItemsWaiting( &( xClasses[ uxClass ].xItems ) );
+}
+/*-----------------------------------------------------------*/
+
+TaskHandle_t xWorkQueueGetWorkerHandle( UBaseType_t uxClass )
+{
+	configASSERT( uxClass < ( UBaseType_t ) configWORK_QUEUE_CLASSES );
+
+	return xClasses[ uxClass ].xWorker;
+}
+/*-----------------------------------------------------------*/
+
+static portTASK_FUNCTION( prvWorkerTask, pvParameters )
+{
+WorkQueueClass_t * const pxClass = ( WorkQueueClass_t * ) pvParameters;
+WorkItem_t xItem;
+
+	for( ;; )
+	{
+		if( xRingBufferReceive( &( pxClass->xItems ), &xItem, portMAX_DELAY ) != pdFAIL )
+		{
+			xItem.pxFunction( xItem.pvParameter1, xItem.ulParameter2 );
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+/* This entire source file will be skipped if the application is not configured
+to include work queue functionality. */
+#endif /* configUSE_WORK_QUEUES == 1 */
@@ -15,6 +15,8 @@
 #include "task.h"
 #include "semphr.h"
 #include "queue.h"
+#include "mailbox.h"
+#include "workqueue.h"
 
 /* Hardware includes. */
 #include "msp430.h"
@@ -26,18 +28,14 @@
 #define mainDISPLAY_TASK_PRIO           ( 1 )
 /** "ADC task" priority */
 #define mainADC_TASK_PRIO               ( 2 )
-#define mainBUTTON_TASK_PRIO               ( 3 )
-
-/* Display queue parameters value*/
-/* Queue with length 1 is mailbox*/
-#define mainDISPLAY_QUEUE_LENGTH            1
+/** Button work queue class and its worker priority */
+#define mainBUTTON_WORK_CLASS           ( 0 )
+#define mainBUTTON_WORK_PRIO            ( 3 )
 
 static void prvSetupHardware( void );
 
-/* This queue will be used to send data to display task*/
-xQueueHandle        xQueue;
-/* This semaphore will be used to signal "Button press" event*/
-xSemaphoreHandle    xEvent_Button;
+/* This mailbox will be used to send data to display task*/
+MailboxHandle_t     xDisplayMailbox;
 xSemaphoreHandle    xGuard_Pot;
 
 typedef enum{
@@ -54,27 +52,23 @@ typedef enum{
  * display. After data is received it is decomposed on high and low digit.
  */
 
-static void prvTask2Function( void *pvParameters )
+/**
+ * @brief Button work function
+ *
+ * Run by button work queue worker for each debounced SW3 or SW4 press.
+ */
+static void prvButtonWork( void *pvParameter, uint32_t buttonEvents )
 {
-    uint16_t i;
-    /*Initial button states are 1 because of pull-up configuration*/
-    uint8_t     currentButtonState  = 1;
     /* New received 8bit data */
     uint8_t     NewValueToShow      = 0;
     /* High and Low number digit*/
     uint8_t         digitLow, digitHigh;
     static active_pot_t activePot = POT1;
-    for(;;){
-        xSemaphoreTake(xEvent_Button,portMAX_DELAY);
-        /*wait for a little to check that button is still pressed*/
-        for(i = 0; i < 1000; i++);
-        /*take button state*/
-        currentButtonState = ((P1IN & 0x10) >> 4);
-        if(currentButtonState == 0){
-            /* If button is still pressed send signal to "Diode" task */
+        if(buttonEvents & HAL_BUTTON_EVENT_PRESS(HAL_BUTTON_SW3)){
+            /* If SW3 is pressed send value over UART */
             /* Check if new number is received*/
 
-            if( xQueuePeek(xQueue, &NewValueToShow, 0) == pdTRUE  ){
+            if( uxMailboxPeek(xDisplayMailbox, &NewValueToShow) != 0  ){
                      /* If there is new number to show on display, split it on High and Low digit */
                      /* Extract high digit*/
                      digitHigh = NewValueToShow/10;
@@ -89,10 +83,8 @@ static void prvTask2Function( void *pvParameters )
 
         }
 
-        for(i = 0; i < 1000; i++);
-                /*take button state*/
-                currentButtonState = ((P1IN & 0x20) >> 4);
-                if(currentButtonState == 0){
+                /* If SW4 is pressed switch active potentiometer */
+                if(buttonEvents & HAL_BUTTON_EVENT_PRESS(HAL_BUTTON_SW4)){
 
                     activePot = activePot == POT1?POT2:POT1;
                     if(activePot == POT1){
@@ -131,7 +123,6 @@ static void prvTask2Function( void *pvParameters )
                     }
 
                 }
-                 }
 
 }
 
@@ -140,12 +131,18 @@ static void prvDisplayTaskFunction( void *pvParameters )
     /* New received 8bit data */
     uint8_t         NewValueToShow      = 0;
     /* High and Low number digit*/
-    uint8_t         digitLow, digitHigh;
+    uint8_t         digitLow = 0, digitHigh = 0;
+    /* Version of the value currently shown, 0 until first value arrives*/
+    UBaseType_t     shownVersion        = 0;
+    UBaseType_t     version;
     for ( ;; )
     {
 
-        /* Check if new number is received*/
-        if(  xQueuePeek(xQueue, &NewValueToShow, 0) == pdTRUE  ){
+        /* Check if new number is received, digits are recomputed only when
+         * mailbox version changes*/
+        version = uxMailboxPeek(xDisplayMailbox, &NewValueToShow);
+        if( version != shownVersion ){
+            shownVersion = version;
             /* If there is new number to show on display, split it on High and Low digit */
             /* Extract high digit*/
             digitHigh = NewValueToShow/10;
@@ -204,18 +201,17 @@ void main( void )
                  mainADC_TASK_PRIO,
                  NULL
                );
-    xTaskCreate(prvTask2Function,
-                "Button task",
-                configMINIMAL_STACK_SIZE,
-                NULL,
-                mainBUTTON_TASK_PRIO,
-                NULL
+    /* Button events are handled by shared work queue worker*/
+    xWorkQueueCreateClass(mainBUTTON_WORK_CLASS,
+                mainBUTTON_WORK_PRIO,
+                4
                 );
+    xHALButtonSubscribeWork(mainBUTTON_WORK_CLASS, prvButtonWork, NULL, HAL_BUTTON_EVENT_PRESS(HAL_BUTTON_SW3) |
+                                                                    HAL_BUTTON_EVENT_PRESS(HAL_BUTTON_SW4));
     /* Create FreeRTOS objects  */
-    xQueue       =   xQueueCreate(mainDISPLAY_QUEUE_LENGTH,sizeof(uint8_t));
+    xDisplayMailbox  =   xMailboxCreate(sizeof(uint8_t));
 
     /* Create semaphores        */
-    xEvent_Button           =   xSemaphoreCreateBinary();
     xGuard_Pot          =   xSemaphoreCreateMutex();
     /* Start the scheduler. */
     vTaskStartScheduler();
@@ -240,16 +236,7 @@ static void prvSetupHardware( void )
     hal430SetSystemClock( configCPU_CLOCK_HZ, configLFXT_CLOCK_HZ );
 
     /* - Init buttons - */
-    /*Set direction to input*/
-    P1DIR &= ~0x30;
-    /*Enable pull-up resistor*/
-    P1REN |= 0x30;
-    P1OUT |= 0x30;
-    /*Enable interrupt for pin connected to S3*/
-    P1IE  |= 0x30;
-    P1IFG &=~0x30;
-    /*Interrupt is generated during high to low transition*/
-    P1IES |= 0x30;
+    vHALButtonInit();
 
     /*Initialize ADC */
     ADC12CTL0      &= ~ADC12ENC;
@@ -262,14 +249,7 @@ static void prvSetupHardware( void )
     P6SEL          |= 0x03;                      // P6.0 ADC option select
 
     /* Initialize UART */
-
-         P4SEL       |= BIT4+BIT5;                    // P4.4,5 = USCI_AA TXD/RXD
-         UCA1CTL1    |= UCSWRST;                      // **Put state machine in reset**
-         UCA1CTL1    |= UCSSEL_2;                     // SMCLK
-         UCA1BRW      = 1041;                         // 1MHz 115200
-         UCA1MCTL    |= UCBRS_6 + UCBRF_0;            // Modulation UCBRSx=1, UCBRFx=0
-         UCA1CTL1    &= ~UCSWRST;                     // **Initialize USCI state machine**
-         UCA1IE      |= UCRXIE;                       // Enable USCI_A1 RX interrupt
+    vHALUARTInit( 9600 );
 
     /* initialize LEDs */
     vHALInitLED();
@@ -283,7 +263,7 @@ static void prvSetupHardware( void )
 void __attribute__ ( ( interrupt( ADC12_VECTOR  ) ) ) vADC12ISR( void )
 {
     BaseType_t xHigherPriorityTaskWoken = pdFALSE;
-    uint16_t    temp;
+    uint8_t     temp;
     switch(__even_in_range(ADC12IV,34))
     {
         case  0: break;                           // Vector  0:  No interrupt
@@ -292,11 +272,11 @@ void __attribute__ ( ( interrupt( ADC12_VECTOR  ) ) ) vADC12ISR( void )
         case  6:                                  // Vector  6:  ADC12IFG0
             /* Scaling ADC value to fit on two digits representation*/
             temp    = ADC12MEM0>>6;
-            xQueueOverwriteFromISR(xQueue,&temp,&xHigherPriorityTaskWoken);
+            vMailboxOverwriteFromISR(xDisplayMailbox,&temp,&xHigherPriorityTaskWoken);
             break;
         case  8:   /* Scaling ADC value to fit on two digits representation*/
             temp    = ADC12MEM1>>6;
-            xQueueOverwriteFromISR(xQueue,&temp,&xHigherPriorityTaskWoken);// Vector  8:  ADC12IFG1
+            vMailboxOverwriteFromISR(xDisplayMailbox,&temp,&xHigherPriorityTaskWoken);// Vector  8:  ADC12IFG1
             break;
         case 10: break;                           // Vector 10:  ADC12IFG2
         case 12: break;                           // Vector 12:  ADC12IFG3
@@ -316,18 +296,3 @@ void __attribute__ ( ( interrupt( ADC12_VECTOR  ) ) ) vADC12ISR( void )
     /* trigger scheduler if higher priority task is woken */
     portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
 }
-void __attribute__ ( ( interrupt( PORT1_VECTOR  ) ) ) vPORT1ISR( void )
-{
-    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
-
-    /* Give semaphore if button SW3 is pressed*/
-    /* Note: This check is not truly necessary but it is good to
-     * have it*/
-    if((P1IFG & 0x10) == 0x10 || (P1IFG & 0x20) == 0x20 ){
-        xSemaphoreGiveFromISR(xEvent_Button, &xHigherPriorityTaskWoken);
-    }
-    /*Clear IFG register on exit. Read more about it in official MSP430F5529 documentation*/
-    P1IFG &=~0x30;
-    /* trigger scheduler if higher priority task is woken */
-    portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
-}
@@ -33,9 +33,34 @@ void halBoardInit(void)
   PJDIR  = 0xFF;
 }
 
+/**********************************************************************//**
+ * @brief  Get VCore level sufficient for MCLK frequency.
+ *
+ * @param  clock_rate_khz MCLK frequency in KHz
+ *
+ * @return PMMCOREV_x level to be passed to PMM_setVCore()
+ *************************************************************************/
+unsigned short hal430GetVCoreLevel(unsigned long clock_rate_khz)
+{
+  if(clock_rate_khz <= 8000L)
+  {
+      return PMMCOREV_0;
+  }
+  else if(clock_rate_khz <= 12000L)
+  {
+      return PMMCOREV_1;
+  }
+  else if(clock_rate_khz <= 20000L)
+  {
+      return PMMCOREV_2;
+  }
+  return PMMCOREV_3;
+}
+
 /**********************************************************************//**
  * @brief  Set function for MCLK frequency.
  *
+ * Used once at boot, hal_clock.c changes frequency at run time.
  *
  * @return none
  *************************************************************************/
@@ -52,22 +77,7 @@ void hal430SetSystemClock(unsigned long req_clock_rate, unsigned long ref_clock_
   }
 
   //Set VCore to a level sufficient for the requested clock speed.
-  if(ulCPU_Clock_KHz <= 8000L)
-  {
-      PMM_setVCore(PMMCOREV_0);
-  }
-  else if(ulCPU_Clock_KHz <= 12000L)
-  {
-      PMM_setVCore(PMMCOREV_1);
-  }
-  else if(ulCPU_Clock_KHz <= 20000L)
-  {
-      PMM_setVCore(PMMCOREV_2);
-  }
-  else
-  {
-      PMM_setVCore(PMMCOREV_3);
-  }
+  PMM_setVCore(hal430GetVCoreLevel(ulCPU_Clock_KHz));
 
   //Set the DCO
   UCS_initFLLSettle( ( unsigned short )ulCPU_Clock_KHz, req_clock_rate / ref_clock_rate );
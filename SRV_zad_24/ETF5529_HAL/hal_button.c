@@ -0,0 +1,218 @@
+/**
+ * @file    hal_button.c
+ * @date    2021
+ * @brief   BUTTON API
+ *
+ * Buttons are sampled every HAL_BUTTON_SAMPLE_PERIOD_MS from the tick
+ * hook. Each sample is shifted into per-button history register and
+ * button changes state only when last HAL_BUTTON_DEBOUNCE_SAMPLES samples
+ * are equal, so no busy waiting is needed to filter contact bounce.
+ * Sampling is armed by falling edge on button pin and disarmed again
+ * once all buttons are released, so idle ticks cost only one flag check.
+ * Subscribers are either tasks, which get events as notification bits, or
+ * work functions, which are submitted to a work queue with the events as
+ * their second parameter.
+ */
+
+#include "hal_button.h"
+#include "hal_gpio.h"
+#include "hal_latency.h"
+#include "msp430.h"
+
+#define halBUTTON_HISTORY_MASK      ( ( uint8_t ) ( ( 1U << HAL_BUTTON_DEBOUNCE_SAMPLES ) - 1U ) )
+#define halBUTTON_SAMPLE_TICKS      ( pdMS_TO_TICKS( HAL_BUTTON_SAMPLE_PERIOD_MS ) > 0 ? \
+                                      pdMS_TO_TICKS( HAL_BUTTON_SAMPLE_PERIOD_MS ) : 1 )
+#define halBUTTON_LONG_PRESS_SAMPLES ( HAL_BUTTON_LONG_PRESS_MS / HAL_BUTTON_SAMPLE_PERIOD_MS )
+
+typedef struct{
+    uint8_t     ucHistory;          /* Last samples, 1 means pressed */
+    uint8_t     ucPressed;          /* Debounced button state */
+    uint16_t    usHeldSamples;      /* Number of samples since press */
+}hal_button_state_t;
+
+typedef struct{
+    TaskHandle_t    xTask;          /* NULL for work subscribers */
+    uint32_t        ulEventMask;
+#if( configUSE_WORK_QUEUES == 1 )
+    WorkFunction_t  pxWork;
+    void           *pvParameter;
+    UBaseType_t     uxClass;
+#endif
+}hal_button_subscriber_t;
+
+static const uint8_t            pucButtonMask[ HAL_BUTTON_COUNT ] = { HAL_BUTTON_SW3_MASK, HAL_BUTTON_SW4_MASK };
+static hal_button_state_t       pxButtonState[ HAL_BUTTON_COUNT ];
+static hal_button_subscriber_t  pxSubscribers[ HAL_BUTTON_MAX_SUBSCRIBERS ];
+static volatile UBaseType_t     uxSubscriberCount = 0;
+static volatile uint8_t         ucInitialised = 0;
+static volatile uint8_t         ucArmed = 0;
+
+static void prvButtonEdgeHandler( void *pvParameter, BaseType_t *pxHigherPriorityTaskWoken )
+{
+    ( void ) pvParameter;
+    ( void ) pxHigherPriorityTaskWoken;
+
+    /* Bounce generates a burst of edges, each one only re-arms sampling */
+    ucArmed = 1;
+}
+
+static void prvButtonNotify( uint32_t ulEvents )
+{
+    UBaseType_t x;
+    uint32_t    ulToSend;
+    BaseType_t  xHigherPriorityTaskWoken = pdFALSE;
+
+    for( x = 0; x < uxSubscriberCount; x++ ){
+        ulToSend = ulEvents & pxSubscribers[ x ].ulEventMask;
+        if( ulToSend == 0 ){
+            continue;
+        }
+#if( configUSE_WORK_QUEUES == 1 )
+        if( pxSubscribers[ x ].xTask == NULL ){
+            /* Event is dropped if the class queue is full */
+            xWorkQueueSubmitFromISR( pxSubscribers[ x ].uxClass, pxSubscribers[ x ].pxWork,
+                                     pxSubscribers[ x ].pvParameter, ulToSend, &xHigherPriorityTaskWoken );
+            continue;
+        }
+#endif
+        HAL_LATENCY_ISR_MARK( HAL_BUTTON_LATENCY_PAIR );
+        xTaskNotifyFromISR( pxSubscribers[ x ].xTask, ulToSend, eSetBits, &xHigherPriorityTaskWoken );
+    }
+    /* Tick ISR always calls scheduler after the tick hook returns, so
+     * woken task will be switched in without explicit yield */
+    ( void ) xHigherPriorityTaskWoken;
+}
+
+void vHALButtonInit( void ){
+    uint8_t i;
+
+    /*Set direction to input*/
+    HAL_BUTTON_PORT_DIR &= ~HAL_BUTTON_ALL_MASK;
+    /*Enable pull-up resistor*/
+    HAL_BUTTON_PORT_REN |= HAL_BUTTON_ALL_MASK;
+    HAL_BUTTON_PORT_OUT |= HAL_BUTTON_ALL_MASK;
+
+    for( i = 0; i < HAL_BUTTON_COUNT; i++ ){
+        pxButtonState[ i ].ucHistory        = 0;
+        pxButtonState[ i ].ucPressed        = 0;
+        pxButtonState[ i ].usHeldSamples    = 0;
+    }
+    /*Button could be held during init, sample until state settles*/
+    ucArmed = 1;
+    ucInitialised = 1;
+
+    /*Arm sampling on high to low transition of any button pin*/
+    xHALGPIORegisterHandler( HAL_GPIO_PORT_1, HAL_BUTTON_SW3_PIN, HAL_GPIO_EDGE_FALLING, prvButtonEdgeHandler, NULL );
+    xHALGPIORegisterHandler( HAL_GPIO_PORT_1, HAL_BUTTON_SW4_PIN, HAL_GPIO_EDGE_FALLING, prvButtonEdgeHandler, NULL );
+}
+
+BaseType_t xHALButtonSubscribe( TaskHandle_t xTask, uint32_t ulEventMask ){
+    BaseType_t xReturn = pdFAIL;
+
+    configASSERT( xTask );
+
+    taskENTER_CRITICAL();
+    {
+        if( uxSubscriberCount < HAL_BUTTON_MAX_SUBSCRIBERS ){
+            pxSubscribers[ uxSubscriberCount ].xTask        = xTask;
+            pxSubscribers[ uxSubscriberCount ].ulEventMask  = ulEventMask & HAL_BUTTON_EVENT_ALL;
+            uxSubscriberCount++;
+            xReturn = pdPASS;
+        }
+    }
+    taskEXIT_CRITICAL();
+
+    return xReturn;
+}
+
+#if( configUSE_WORK_QUEUES == 1 )
+BaseType_t xHALButtonSubscribeWork( UBaseType_t uxClass, WorkFunction_t pxFunction, void *pvParameter, uint32_t ulEventMask ){
+    BaseType_t xReturn = pdFAIL;
+
+    configASSERT( pxFunction );
+
+    taskENTER_CRITICAL();
+    {
+        if( uxSubscriberCount < HAL_BUTTON_MAX_SUBSCRIBERS ){
+            pxSubscribers[ uxSubscriberCount ].xTask        = NULL;
+            pxSubscribers[ uxSubscriberCount ].ulEventMask  = ulEventMask & HAL_BUTTON_EVENT_ALL;
+            pxSubscribers[ uxSubscriberCount ].pxWork       = pxFunction;
+            pxSubscribers[ uxSubscriberCount ].pvParameter  = pvParameter;
+            pxSubscribers[ uxSubscriberCount ].uxClass      = uxClass;
+            uxSubscriberCount++;
+            xReturn = pdPASS;
+        }
+    }
+    taskEXIT_CRITICAL();
+
+    return xReturn;
+}
+#endif
+
+uint32_t ulHALButtonWaitEvent( TickType_t xTicksToWait ){
+    uint32_t ulEvents = 0;
+
+    /* Only button bits are cleared, other notification bits are left to
+     * the task */
+    xTaskNotifyWait( 0, HAL_BUTTON_EVENT_ALL, &ulEvents, xTicksToWait );
+    HAL_LATENCY_TASK_RESUMED( HAL_BUTTON_LATENCY_PAIR );
+
+    return ulEvents & HAL_BUTTON_EVENT_ALL;
+}
+
+void vHALButtonTickHook( void ){
+    static TickType_t   xTicksToSample = 0;
+    hal_button_state_t *pxButton;
+    uint8_t             ucPinsPressed;
+    uint32_t            ulEvents = 0;
+    uint8_t             ucActive = 0;
+    uint8_t             i;
+
+    if( ( ucInitialised == 0 ) || ( ucArmed == 0 ) ){
+        return;
+    }
+    if( xTicksToSample > 1 ){
+        xTicksToSample--;
+        return;
+    }
+    xTicksToSample = halBUTTON_SAMPLE_TICKS;
+
+    /*Buttons are pulled-up, pressed button reads as 0*/
+    ucPinsPressed = ~HAL_BUTTON_PORT_IN & HAL_BUTTON_ALL_MASK;
+
+    for( i = 0; i < HAL_BUTTON_COUNT; i++ ){
+        pxButton = &pxButtonState[ i ];
+        pxButton->ucHistory = ( ( pxButton->ucHistory << 1 ) |
+                                ( ( ucPinsPressed & pucButtonMask[ i ] ) ? 1 : 0 ) ) & halBUTTON_HISTORY_MASK;
+
+        if( pxButton->ucPressed == 0 ){
+            if( pxButton->ucHistory == halBUTTON_HISTORY_MASK ){
+                pxButton->ucPressed     = 1;
+                pxButton->usHeldSamples = 0;
+                ulEvents |= HAL_BUTTON_EVENT_PRESS( i );
+            }
+        }
+        else{
+            if( pxButton->ucHistory == 0 ){
+                pxButton->ucPressed = 0;
+                ulEvents |= HAL_BUTTON_EVENT_RELEASE( i );
+            }
+            else if( pxButton->usHeldSamples < halBUTTON_LONG_PRESS_SAMPLES ){
+                pxButton->usHeldSamples++;
+                if( pxButton->usHeldSamples == halBUTTON_LONG_PRESS_SAMPLES ){
+                    ulEvents |= HAL_BUTTON_EVENT_LONG_PRESS( i );
+                }
+            }
+        }
+        ucActive |= pxButton->ucPressed | pxButton->ucHistory;
+    }
+
+    /*All buttons released and stable, wait for next edge*/
+    if( ucActive == 0 ){
+        ucArmed = 0;
+    }
+
+    if( ulEvents != 0 ){
+        prvButtonNotify( ulEvents );
+    }
+}
@@ -0,0 +1,84 @@
+/**
+ * @file    hal_button.h
+ * @date    2021
+ * @brief   BUTTON API
+ *
+ * Debounced button service for SW3 (P1.4) and SW4 (P1.5). After an
+ * edge is reported by the GPIO dispatcher buttons are sampled from the
+ * tick hook, filtered through a shift register and press, release and
+ * long-press events are delivered to subscribed tasks as task
+ * notification bits, or submitted as work to a work queue class.
+ */
+
+#include <stdint.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#if( configUSE_WORK_QUEUES == 1 )
+#include "workqueue.h"
+#endif
+#ifndef HAL_BUTTON_H_
+#define HAL_BUTTON_H_
+
+/*Buttons port registers*/
+#define HAL_BUTTON_PORT_IN              P1IN
+#define HAL_BUTTON_PORT_OUT             P1OUT
+#define HAL_BUTTON_PORT_DIR             P1DIR
+#define HAL_BUTTON_PORT_REN             P1REN
+
+/*Buttons position inside of register*/
+#define HAL_BUTTON_SW3_PIN              4
+#define HAL_BUTTON_SW4_PIN              5
+#define HAL_BUTTON_SW3_MASK             ( 1 << HAL_BUTTON_SW3_PIN )
+#define HAL_BUTTON_SW4_MASK             ( 1 << HAL_BUTTON_SW4_PIN )
+#define HAL_BUTTON_ALL_MASK             ( HAL_BUTTON_SW3_MASK | HAL_BUTTON_SW4_MASK )
+
+/*Time between two samples of button pins*/
+#ifndef HAL_BUTTON_SAMPLE_PERIOD_MS
+#define HAL_BUTTON_SAMPLE_PERIOD_MS     5
+#endif
+/*Number of equal consecutive samples (max 8) needed to change button state*/
+#ifndef HAL_BUTTON_DEBOUNCE_SAMPLES
+#define HAL_BUTTON_DEBOUNCE_SAMPLES     4
+#endif
+/*Time button has to be held down to generate long-press event*/
+#ifndef HAL_BUTTON_LONG_PRESS_MS
+#define HAL_BUTTON_LONG_PRESS_MS        1000
+#endif
+/*Maximal number of tasks which can subscribe to button events*/
+#ifndef HAL_BUTTON_MAX_SUBSCRIBERS
+#define HAL_BUTTON_MAX_SUBSCRIBERS      4
+#endif
+/*Latency probe pair from tick ISR to task in ulHALButtonWaitEvent, see
+ *hal_latency.h, meaningful with one subscribed task*/
+#ifndef HAL_BUTTON_LATENCY_PAIR
+#define HAL_BUTTON_LATENCY_PAIR         0
+#endif
+
+typedef enum{
+    HAL_BUTTON_SW3 = 0,
+    HAL_BUTTON_SW4 = 1
+}hal_button_t;
+
+#define HAL_BUTTON_COUNT                2
+
+/*Notification bits set in subscribed task for each button event*/
+#define HAL_BUTTON_EVENT_PRESS( button )        ( ( uint32_t ) 0x01 << ( 4 * ( button ) ) )
+#define HAL_BUTTON_EVENT_RELEASE( button )      ( ( uint32_t ) 0x02 << ( 4 * ( button ) ) )
+#define HAL_BUTTON_EVENT_LONG_PRESS( button )   ( ( uint32_t ) 0x04 << ( 4 * ( button ) ) )
+#define HAL_BUTTON_EVENT_ALL                    ( ( uint32_t ) 0x77 )
+
+/*Init button pins and debouncer state*/
+void        vHALButtonInit( void );
+/*Register task which will be notified about events selected by ulEventMask*/
+BaseType_t  xHALButtonSubscribe( TaskHandle_t xTask, uint32_t ulEventMask );
+#if( configUSE_WORK_QUEUES == 1 )
+/*Submit pxFunction( pvParameter, events ) to work queue class uxClass on events
+ *selected by ulEventMask, so no task has to wait for button events*/
+BaseType_t  xHALButtonSubscribeWork( UBaseType_t uxClass, WorkFunction_t pxFunction, void *pvParameter, uint32_t ulEventMask );
+#endif
+/*Block calling task until one of button events arrives, returns received events*/
+uint32_t    ulHALButtonWaitEvent( TickType_t xTicksToWait );
+/*Sample buttons, must be called from vApplicationTickHook*/
+void        vHALButtonTickHook( void );
+
+#endif /* HAL_BUTTON_H_ */
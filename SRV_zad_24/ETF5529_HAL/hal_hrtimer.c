@@ -0,0 +1,301 @@
+/**
+ * @file    hal_hrtimer.c
+ * @date    2021
+ * @brief   HIGH-RESOLUTION TIMER API
+ *
+ * Timeouts are kept in 32-bit counts. Only the first compare of a
+ * timeout can be shorter than half of the 16-bit counter, every later
+ * compare moves CCRn exactly halfway around, so the ISR never sets a
+ * compare value which has already passed. CCIE bits are changed through
+ * the port because critical sections may mask them while they run.
+ * Timeouts pending when SMCLK changes are rescaled to the new count rate.
+ */
+
+#include "hal_hrtimer.h"
+#include "hal_clock.h"
+#include "semphr.h"
+#include "msp430.h"
+
+/*Largest step of one compare, half of the counter range*/
+#define halHRTIMER_STEP             0x8000U
+/*Ticks added to safety timeout of xHALHRTimerDelay*/
+#define halHRTIMER_DELAY_MARGIN     2
+
+typedef struct{
+    hal_hrtimer_callback_t  pxCallback;     /* NULL while channel is free */
+    void                   *pvParameter;
+    uint32_t                ulRemaining;    /* Counts left after current compare */
+}hal_hrtimer_channel_t;
+
+static volatile uint16_t * const pusCCTL[ HAL_HRTIMER_CHANNELS ] = { &TA1CCTL0, &TA1CCTL1, &TA1CCTL2 };
+static volatile uint16_t * const pusCCR[ HAL_HRTIMER_CHANNELS ]  = { &TA1CCR0, &TA1CCR1, &TA1CCR2 };
+static hal_hrtimer_channel_t        pxChannels[ HAL_HRTIMER_CHANNELS ];
+static SemaphoreHandle_t            pxDelaySemaphores[ HAL_HRTIMER_CHANNELS ];
+static uint32_t                     ulCountHz = 0;
+/* Counts per microsecond in 16.16 fixed point, rounded up */
+static uint32_t                     ulCountsPerUsQ16 = 0;
+
+/* Choose smallest ID * TAIDEX divider which keeps count rate in limit */
+static void prvHRTimerSetDivider( uint32_t ulSMCLKHz )
+{
+    static const uint16_t pusIDBits[ 4 ] = { ID_0, ID_1, ID_2, ID_3 };
+    uint32_t    ulNeeded    = ( ulSMCLKHz + HAL_HRTIMER_MAX_COUNT_HZ - 1 ) / HAL_HRTIMER_MAX_COUNT_HZ;
+    uint16_t    usDivider;
+    uint16_t    usBest      = 64;
+    uint8_t     ucBestID    = 3;
+    uint8_t     ucBestEX    = 7;
+    uint8_t     ucID;
+    uint8_t     ucEX;
+
+    for( ucID = 0; ucID < 4; ucID++ ){
+        for( ucEX = 0; ucEX < 8; ucEX++ ){
+            usDivider = ( uint16_t ) ( ( 1 << ucID ) * ( ucEX + 1 ) );
+            if( ( usDivider >= ulNeeded ) && ( usDivider < usBest ) ){
+                usBest      = usDivider;
+                ucBestID    = ucID;
+                ucBestEX    = ucEX;
+            }
+        }
+    }
+
+    TA1CTL      = TASSEL_2 + MC_0;                          // SMCLK, stopped
+    TA1EX0      = TAIDEX_0 + ucBestEX;
+    TA1CTL      = TASSEL_2 + pusIDBits[ ucBestID ] + TACLR; // TACLR resets divider logic
+    TA1CTL     |= MC_2;                                     // continuous mode
+
+    ulCountHz           = ulSMCLKHz / usBest;
+    /* 65536 / 1000000 == 1024 / 15625 */
+    ulCountsPerUsQ16    = ( ulCountHz * 1024UL + 15624UL ) / 15625UL;
+}
+
+static uint32_t prvHRTimerMicrosecondsToCounts( uint32_t ulMicroseconds )
+{
+    uint32_t    ulHigh  = ( ulMicroseconds >> 16 ) * ulCountsPerUsQ16;
+    uint32_t    ulLow   = ( ( ulMicroseconds & 0xFFFFUL ) * ulCountsPerUsQ16 + 0xFFFFUL ) >> 16;
+
+    if( ulHigh > 0xFFFFFFFFUL - ulLow ){
+        return 0xFFFFFFFFUL;
+    }
+    return ulHigh + ulLow;
+}
+
+/* Called with kernel aware interrupts masked */
+static void prvHRTimerArm( uint8_t ucChannel, uint32_t ulCounts )
+{
+    uint16_t    usFirst;
+    uint16_t    usNow;
+
+    if( ulCounts == 0 ){
+        ulCounts = 1;
+    }
+    usFirst = ( uint16_t ) ( ulCounts % halHRTIMER_STEP );
+    if( usFirst == 0 ){
+        usFirst = halHRTIMER_STEP;
+    }
+    pxChannels[ ucChannel ].ulRemaining = ulCounts - usFirst;
+
+    /* Compare keeps matching while channel is free, drop old flag */
+    *pusCCTL[ ucChannel ] &= ~CCIFG;
+    usNow = TA1R;
+    *pusCCR[ ucChannel ] = usNow + usFirst;
+    /* Interrupts left enabled by critical section may delay write past compare value */
+    if( ( uint16_t ) ( TA1R - usNow ) >= usFirst ){
+        *pusCCTL[ ucChannel ] |= CCIFG;
+    }
+    vPortModifyKernelIE( portKERNEL_IE_TA1, 0, ( uint16_t ) ( 1 << ucChannel ) );
+}
+
+/* Called with kernel aware interrupts masked */
+static BaseType_t prvHRTimerStart( uint32_t ulMicroseconds, hal_hrtimer_callback_t pxCallback, void *pvParameter )
+{
+    uint8_t i;
+
+    for( i = 0; i < HAL_HRTIMER_CHANNELS; i++ ){
+        if( pxChannels[ i ].pxCallback == NULL ){
+            pxChannels[ i ].pxCallback  = pxCallback;
+            pxChannels[ i ].pvParameter = pvParameter;
+            prvHRTimerArm( i, prvHRTimerMicrosecondsToCounts( ulMicroseconds ) );
+            return ( BaseType_t ) i;
+        }
+    }
+    return HAL_HRTIMER_NO_CHANNEL;
+}
+
+static void prvHRTimerExpired( uint8_t ucChannel, BaseType_t *pxHigherPriorityTaskWoken )
+{
+    hal_hrtimer_channel_t  *pxChannel = &pxChannels[ ucChannel ];
+    hal_hrtimer_callback_t  pxCallback;
+
+    if( pxChannel->ulRemaining != 0 ){
+        pxChannel->ulRemaining -= halHRTIMER_STEP;
+        *pusCCR[ ucChannel ] += halHRTIMER_STEP;
+        return;
+    }
+    vPortModifyKernelIE( portKERNEL_IE_TA1, ( uint16_t ) ( 1 << ucChannel ), 0 );
+    pxCallback = pxChannel->pxCallback;
+    pxChannel->pxCallback = NULL;
+    if( pxCallback != NULL ){
+        pxCallback( pxChannel->pvParameter, pxHigherPriorityTaskWoken );
+    }
+}
+
+static void prvHRTimerDelayHandler( void *pvParameter, BaseType_t *pxHigherPriorityTaskWoken )
+{
+    xSemaphoreGiveFromISR( ( SemaphoreHandle_t ) pvParameter, pxHigherPriorityTaskWoken );
+}
+
+static void prvHRTimerClockListener( uint32_t ulSMCLKHz, void *pvParameter )
+{
+    uint32_t    pulPending[ HAL_HRTIMER_CHANNELS ];
+    uint32_t    ulOldHz;
+    uint16_t    usNow;
+    uint8_t     i;
+
+    ( void ) pvParameter;
+
+    taskENTER_CRITICAL();
+    {
+        ulOldHz = ulCountHz;
+        usNow   = TA1R;
+        for( i = 0; i < HAL_HRTIMER_CHANNELS; i++ ){
+            pulPending[ i ] = pxChannels[ i ].ulRemaining;
+            /* Compare which already matched waits only for its ISR */
+            if( ( *pusCCTL[ i ] & CCIFG ) == 0 ){
+                pulPending[ i ] += ( uint16_t ) ( *pusCCR[ i ] - usNow );
+            }
+        }
+
+        prvHRTimerSetDivider( ulSMCLKHz );
+
+        for( i = 0; i < HAL_HRTIMER_CHANNELS; i++ ){
+            if( pxChannels[ i ].pxCallback != NULL ){
+                prvHRTimerArm( i, ( uint32_t ) ( ( ( uint64_t ) pulPending[ i ] * ulCountHz ) / ulOldHz ) );
+            }
+        }
+    }
+    taskEXIT_CRITICAL();
+}
+
+BaseType_t xHALHRTimerInit( void ){
+    uint8_t i;
+
+    for( i = 0; i < HAL_HRTIMER_CHANNELS; i++ ){
+        pxDelaySemaphores[ i ] = xSemaphoreCreateBinary();
+        if( pxDelaySemaphores[ i ] == NULL ){
+            return pdFAIL;
+        }
+    }
+    prvHRTimerSetDivider( ulHALClockGetFrequency() );
+
+    return xHALClockRegisterListener( prvHRTimerClockListener, NULL );
+}
+
+BaseType_t xHALHRTimerStart( uint32_t ulMicroseconds, hal_hrtimer_callback_t pxCallback, void *pvParameter ){
+    BaseType_t xChannel;
+
+    configASSERT( pxCallback );
+
+    taskENTER_CRITICAL();
+    {
+        xChannel = prvHRTimerStart( ulMicroseconds, pxCallback, pvParameter );
+    }
+    taskEXIT_CRITICAL();
+
+    return xChannel;
+}
+
+BaseType_t xHALHRTimerStartFromISR( uint32_t ulMicroseconds, hal_hrtimer_callback_t pxCallback, void *pvParameter ){
+    BaseType_t  xChannel;
+    UBaseType_t uxSavedInterruptStatus;
+
+    configASSERT( pxCallback );
+
+    uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+    {
+        xChannel = prvHRTimerStart( ulMicroseconds, pxCallback, pvParameter );
+    }
+    portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+
+    return xChannel;
+}
+
+void vHALHRTimerCancel( BaseType_t xChannel ){
+    if( ( xChannel < 0 ) || ( xChannel >= HAL_HRTIMER_CHANNELS ) ){
+        return;
+    }
+
+    taskENTER_CRITICAL();
+    {
+        vPortModifyKernelIE( portKERNEL_IE_TA1, ( uint16_t ) ( 1 << xChannel ), 0 );
+        *pusCCTL[ xChannel ] &= ~CCIFG;
+        pxChannels[ xChannel ].pxCallback   = NULL;
+        pxChannels[ xChannel ].ulRemaining  = 0;
+    }
+    taskEXIT_CRITICAL();
+}
+
+BaseType_t xHALHRTimerDelay( uint32_t ulMicroseconds ){
+    SemaphoreHandle_t   xSemaphore = NULL;
+    BaseType_t          xChannel;
+    BaseType_t          xReturn;
+    uint32_t            ulTicks;
+
+    taskENTER_CRITICAL();
+    {
+        /* TA1 is kernel aware, so channel can't expire before its
+         * semaphore is set below */
+        xChannel = prvHRTimerStart( ulMicroseconds, prvHRTimerDelayHandler, NULL );
+        if( xChannel != HAL_HRTIMER_NO_CHANNEL ){
+            xSemaphore = pxDelaySemaphores[ xChannel ];
+            pxChannels[ xChannel ].pvParameter = xSemaphore;
+        }
+    }
+    taskEXIT_CRITICAL();
+
+    if( xSemaphore == NULL ){
+        return pdFAIL;
+    }
+
+    /* Tick based safety timeout, only reached if compare interrupt is lost */
+    ulTicks = ulMicroseconds / ( 1000000UL / configTICK_RATE_HZ ) + halHRTIMER_DELAY_MARGIN;
+    if( ulTicks >= portMAX_DELAY ){
+        ulTicks = portMAX_DELAY;
+    }
+    xReturn = xSemaphoreTake( xSemaphore, ( TickType_t ) ulTicks );
+    if( xReturn == pdFAIL ){
+        vHALHRTimerCancel( xChannel );
+        /* Channel may have expired just before it was cancelled, leave
+         * semaphore empty for next delay */
+        xReturn = xSemaphoreTake( xSemaphore, 0 );
+    }
+    return xReturn;
+}
+
+uint32_t ulHALHRTimerGetCountHz( void ){
+    return ulCountHz;
+}
+
+void __attribute__ ( ( interrupt( TIMER1_A0_VECTOR ) ) ) vTIMER1A0ISR( void )
+{
+    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
+
+    /* CCR0 has its own vector, CCIFG is cleared on entry */
+    prvHRTimerExpired( 0, &xHigherPriorityTaskWoken );
+    /* trigger scheduler if higher priority task is woken */
+    portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
+}
+
+void __attribute__ ( ( interrupt( TIMER1_A1_VECTOR ) ) ) vTIMER1A1ISR( void )
+{
+    BaseType_t  xHigherPriorityTaskWoken = pdFALSE;
+    uint16_t    usVector;
+
+    /*TA1IV is 2 for CCR1 and 4 for CCR2, reading it clears that flag only*/
+    while( ( usVector = TA1IV ) != 0 ){
+        if( usVector <= 4 ){
+            prvHRTimerExpired( ( uint8_t ) ( usVector >> 1 ), &xHigherPriorityTaskWoken );
+        }
+    }
+    /* trigger scheduler if higher priority task is woken */
+    portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
+}
@@ -0,0 +1,22 @@
+/**
+ * @file    hal_uart.h
+ * @date    2021
+ * @brief   UART API
+ *
+ * USCI_A1 (P4.4 TXD, P4.5 RXD) clocked from SMCLK. Baud rate divider is
+ * computed from current SMCLK frequency and recomputed by clock manager
+ * whenever frequency changes.
+ */
+
+#include <stdint.h>
+#ifndef HAL_UART_H_
+#define HAL_UART_H_
+
+/*Init USCI_A1 pins, baud rate and enable RX interrupt*/
+void        vHALUARTInit( uint32_t ulBaudrate );
+/*Change baud rate*/
+void        vHALUARTSetBaudrate( uint32_t ulBaudrate );
+/*Send null terminated string, busy waits for TX buffer*/
+void        vHALUARTSendString( const char *pcString );
+
+#endif /* HAL_UART_H_ */
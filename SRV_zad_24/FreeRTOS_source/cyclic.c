@@ -0,0 +1,257 @@
+/*
+ * Time-triggered cyclic executive for FreeRTOS, see cyclic.h.
+ *
+ * Each schedule table entry is a bit mask with bit n set if job n runs in that
+ * minor frame, so the dispatcher does no arithmetic on periods at run time.
+ * The dispatcher waits with vTaskDelayUntil(), so frame starts do not drift
+ * however long the jobs of a frame take.
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/* Standard includes. */
+#include <stdlib.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "cyclic.h"
+
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* This entire source file will be skipped if the application is not configured
+to include cyclic executive functionality. */
+#if( configUSE_CYCLIC_EXECUTIVE == 1 )
+
+#if( INCLUDE_vTaskDelayUntil != 1 )
+	#error INCLUDE_vTaskDelayUntil must be set to 1 to use the cyclic executive.
+#endif
+
+PRIVILEGED_DATA static const CyclicJob_t *pxJobTable = NULL;
+PRIVILEGED_DATA static const UBaseType_t *puxScheduleTable = NULL;
+PRIVILEGED_DATA static UBaseType_t uxMajorFrameLength = ( UBaseType_t ) 0U;
+PRIVILEGED_DATA static TickType_t xMinorFrameLength = ( TickType_t ) 0U;
+PRIVILEGED_DATA static volatile UBaseType_t uxOverruns = ( UBaseType_t ) 0U;
+
+#if( configUSE_RELEASE_MONITOR == 1 )
+	PRIVILEGED_DATA static TaskReleaseMonitor_t xFrameMonitor;
+#endif
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Greatest common divisor, used to find the major frame length.
+ */
+static UBaseType_t prvGCD( UBaseType_t uxA, UBaseType_t uxB ) PRIVILEGED_FUNCTION;
+
+/*
+ * Record the tables and create the dispatcher task.
+ */
+static BaseType_t prvStart( const CyclicJob_t * const pxJobs, const UBaseType_t * const puxTable, UBaseType_t uxMajorFrames, TickType_t xMinorFrameTicks, UBaseType_t uxPriority ) PRIVILEGED_FUNCTION;
+
+/*
+ * The dispatcher task.
+ */
+static portTASK_FUNCTION_PROTO( prvDispatcherTask, pvParameters ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+BaseType_t xCyclicExecutiveStart( const CyclicJob_t * const pxJobs, UBaseType_t uxJobCount, TickType_t xMinorFrameTicks, UBaseType_t uxPriority )
+{
+UBaseType_t uxJob, uxFrame, uxMajor = ( UBaseType_t ) 1U;
+UBaseType_t *puxTable;
+uint32_t ulMajor;
+
+	configASSERT( pxJobTable == NULL );
+	configASSERT( pxJobs );
+	configASSERT( ( uxJobCount > ( UBaseType_t ) 0U ) && ( uxJobCount <= ( UBaseType_t ) cyclicMAX_JOBS ) );
+	configASSERT( xMinorFrameTicks > ( TickType_t ) 0U );
+
+	/* The major frame is the least common multiple of the job periods. */
+	for( uxJob = ( UBaseType_t ) 0U; uxJob < uxJobCount; uxJob++ )
+	{
+		configASSERT( pxJobs[ uxJob ].pxFunction );
+		configASSERT( pxJobs[ uxJob ].uxPeriod > ( UBaseType_t ) 0U );
+		configASSERT( pxJobs[ uxJob ].uxOffset < pxJobs[ uxJob ].uxPeriod );
+
+		/* A longer period can never fit.  Checking it first keeps the
+		product below configCYCLIC_MAX_FRAMES squared, and it is made in 32
+		bits so it cannot wrap to a small major frame even with 16 bit
+		UBaseType_t. */
+		if( pxJobs[ uxJob ].uxPeriod > ( UBaseType_t ) configCYCLIC_MAX_FRAMES )
+		{
+			return pdFAIL;
+		}
+
+		ulMajor = ( uint32_t ) ( uxMajor / prvGCD( uxMajor, pxJobs[ uxJob ].uxPeriod ) ) * ( uint32_t ) pxJobs[ uxJob ].uxPeriod;
+
+		if( ulMajor > ( uint32_t ) configCYCLIC_MAX_FRAMES )
+		{
+			return pdFAIL;
+		}
+
+		uxMajor = ( UBaseType_t ) ulMajor;
+	}
+
+	puxTable = ( UBaseType_t * ) pvPortMalloc( ( size_t ) uxMajor * sizeof( UBaseType_t ) );
+
+	if( puxTable == NULL )
+	{
+		return pdFAIL;
+	}
+
+	for( uxFrame = ( UBaseType_t ) 0U; uxFrame < uxMajor; uxFrame++ )
+	{
+		puxTable[ uxFrame ] = ( UBaseType_t ) 0U;
+
+		for( uxJob = ( UBaseType_t ) 0U; uxJob < uxJobCount; uxJob++ )
+		{
+			if( ( uxFrame % pxJobs[ uxJob ].uxPeriod ) == pxJobs[ uxJob ].uxOffset )
+			{
+				puxTable[ uxFrame ] |= ( UBaseType_t ) 1U << uxJob;
+			}
+		}
+	}
+
+	/* heap_1 cannot free the table, so it is kept if the task cannot be
+	created. */
+	return prvStart( pxJobs, puxTable, uxMajor, xMinorFrameTicks, uxPriority );
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xCyclicExecutiveStartFromTable( const CyclicJob_t * const pxJobs, UBaseType_t uxJobCount, const UBaseType_t * const puxTable, UBaseType_t uxMajorFrames, TickType_t xMinorFrameTicks, UBaseType_t uxPriority )
+{
+UBaseType_t uxJob;
+
+	configASSERT( pxJobTable == NULL );
+	configASSERT( pxJobs );
+	configASSERT( puxTable );
+	configASSERT( uxMajorFrames > ( UBaseType_t ) 0U );
+	configASSERT( ( uxJobCount > ( UBaseType_t ) 0U ) && ( uxJobCount <= ( UBaseType_t ) cyclicMAX_JOBS ) );
+	configASSERT( xMinorFrameTicks > ( TickType_t ) 0U );
+
+	/* The table was generated from a job list that must match pxJobs, a
+	period that does not divide the major frame shows it does not. */
+	for( uxJob = ( UBaseType_t ) 0U; uxJob < uxJobCount; uxJob++ )
+	{
+		configASSERT( pxJobs[ uxJob ].pxFunction );
+		configASSERT( pxJobs[ uxJob ].uxPeriod > ( UBaseType_t ) 0U );
+		configASSERT( ( uxMajorFrames % pxJobs[ uxJob ].uxPeriod ) == ( UBaseType_t ) 0U );
+	}
+
+	return prvStart( pxJobs, puxTable, uxMajorFrames, xMinorFrameTicks, uxPriority );
+}
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvStart( const CyclicJob_t * const pxJobs, const UBaseType_t * const puxTable, UBaseType_t uxMajorFrames, TickType_t xMinorFrameTicks, UBaseType_t uxPriority )
+{
+	pxJobTable = pxJobs;
+	puxScheduleTable = puxTable;
+	uxMajorFrameLength = uxMajorFrames;
+	xMinorFrameLength = xMinorFrameTicks;
+
+	return xTaskCreate( prvDispatcherTask, "Cyclic", configCYCLIC_STACK_DEPTH, NULL, uxPriority, NULL );
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxCyclicGetMajorFrameLength( void )
+{
+	return uxMajorFrameLength;
+}
+/*-----------------------------------------------------------*/
+
+UBaseType_t uxCyclicGetOverruns( void )
+{
+	return uxOverruns;
+}
+/*-----------------------------------------------------------*/
+
+#if( configUSE_RELEASE_MONITOR == 1 )
+
+	const TaskReleaseMonitor_t *pxCyclicGetReleaseMonitor( void )
+	{
+		return &xFrameMonitor;
+	}
+
+#endif
+/*-----------------------------------------------------------*/
+
+static UBaseType_t prvGCD( UBaseType_t uxA, UBaseType_t uxB )
+{
+UBaseType_t uxRemainder;
+
+	while( uxB != ( UBaseType_t ) 0U )
+	{
+		uxRemainder = uxA % uxB;
+		uxA = uxB;
+		uxB = uxRemainder;
+	}
+
+	return uxA;
+}
+/*-----------------------------------------------------------*/
+
+static portTASK_FUNCTION( prvDispatcherTask, pvParameters )
+{
+TickType_t xFrameStart;
+UBaseType_t uxFrame = ( UBaseType_t ) 0U, uxJobs, uxJob;
+
+	/* Just to prevent compiler warnings. */
+	( void ) pvParameters;
+
+	#if( configUSE_RELEASE_MONITOR == 1 )
+	{
+		/* Each minor frame is one release of the dispatcher. */
+		vTaskSetReleaseMonitor( NULL, &xFrameMonitor, xMinorFrameLength, ( TickType_t ) 0U );
+	}
+	#endif
+
+	xFrameStart = xTaskGetTickCount();
+
+	for( ;; )
+	{
+		uxJobs = puxScheduleTable[ uxFrame ];
+
+		for( uxJob = ( UBaseType_t ) 0U; uxJobs != ( UBaseType_t ) 0U; uxJob++ )
+		{
+			if( ( uxJobs & ( UBaseType_t ) 1U ) != ( UBaseType_t ) 0U )
+			{
+				pxJobTable[ uxJob ].pxFunction( pxJobTable[ uxJob ].pvParameter );
+			}
+
+			uxJobs >>= 1U;
+		}
+
+		uxFrame++;
+		if( uxFrame == uxMajorFrameLength )
+		{
+			uxFrame = ( UBaseType_t ) 0U;
+		}
+
+		/* If the next frame should already have started the delay below
+		returns at once, and the frame starts late. */
+		if( ( TickType_t ) ( xTaskGetTickCount() - xFrameStart ) >= xMinorFrameLength )
+		{
+			if( uxOverruns != ( UBaseType_t ) ~( UBaseType_t ) 0U )
+			{
+				uxOverruns++;
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		vTaskDelayUntil( &xFrameStart, xMinorFrameLength );
+	}
+}
+/*-----------------------------------------------------------*/
+
+/* This entire source file will be skipped if the application is not configured
+to include cyclic executive functionality. */
+#endif /* configUSE_CYCLIC_EXECUTIVE == 1 */
@@ -73,6 +73,7 @@ typedef struct QueueDefinition * QueueSetMemberHandle_t;
 #define queueQUEUE_TYPE_COUNTING_SEMAPHORE	( ( uint8_t ) 2U )
 #define queueQUEUE_TYPE_BINARY_SEMAPHORE	( ( uint8_t ) 3U )
 #define queueQUEUE_TYPE_RECURSIVE_MUTEX		( ( uint8_t ) 4U )
+#define queueQUEUE_TYPE_CEILING_MUTEX		( ( uint8_t ) 5U )
 
 /**
  * queue. h
@@ -1413,6 +1414,7 @@ BaseType_t xQueueCRReceive( QueueHandle_t xQueue, void *pvBuffer, TickType_t xTi
  */
 QueueHandle_t xQueueCreateMutex( const uint8_t ucQueueType ) PRIVILEGED_FUNCTION;
 QueueHandle_t xQueueCreateMutexStatic( const uint8_t ucQueueType, StaticQueue_t *pxStaticQueue ) PRIVILEGED_FUNCTION;
+QueueHandle_t xQueueCreateMutexCeiling( const UBaseType_t uxCeilingPriority ) PRIVILEGED_FUNCTION;
 QueueHandle_t xQueueCreateCountingSemaphore( const UBaseType_t uxMaxCount, const UBaseType_t uxInitialCount ) PRIVILEGED_FUNCTION;
 QueueHandle_t xQueueCreateCountingSemaphoreStatic( const UBaseType_t uxMaxCount, const UBaseType_t uxInitialCount, StaticQueue_t *pxStaticQueue ) PRIVILEGED_FUNCTION;
 BaseType_t xQueueSemaphoreTake( QueueHandle_t xQueue, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
@@ -1634,6 +1636,26 @@ BaseType_t xQueueRemoveFromSet( QueueSetMemberHandle_t xQueueOrSemaphore, QueueS
  */
 QueueSetMemberHandle_t xQueueSelectFromSet( QueueSetHandle_t xQueueSet, const TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
 
+/*
+ * As xQueueSelectFromSet(), but the item (in the case of a queue) or the
+ * count (in the case of a semaphore) that made the selected member ready is
+ * removed from it in the same call, so the caller does not have to follow up
+ * with xQueueReceive() or xSemaphoreTake().  Intended for sets of binary and
+ * counting semaphores and mailboxes (length one queues written with
+ * xQueueOverwrite()).  Mutexes must not be members of the set.
+ *
+ * @param xQueueSet The queue set on which the task will (potentially) block.
+ *
+ * @param pvBuffer Buffer large enough for the largest item of any queue in the
+ * set.  Can be NULL if all members are semaphores.
+ *
+ * @param xTicksToWait As for xQueueSelectFromSet().
+ *
+ * @return The handle of the member the item was taken from, or NULL if no
+ * member became ready before the block time expired.
+ */
+QueueSetMemberHandle_t xQueueSelectFromSetAndReceive( QueueSetHandle_t xQueueSet, void * const pvBuffer, const TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
 /*
  * A version of xQueueSelectFromSet() that can be used from an ISR.
  */
@@ -0,0 +1,141 @@
+/*
+ * Sequence lock snapshot cell for FreeRTOS, see seqlock.h.
+ *
+ * The data is copied byte by byte through volatile pointers, so the compiler
+ * cannot move the copy across the sequence counter accesses.
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "seqlock.h"
+
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/*
+ * Update the value, called with the writer protected from readers running on
+ * the same core.
+ */
+static void prvWrite( SeqLock_t * const pxSeqLock, const void * const pvData ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+void vSeqLockInit( SeqLock_t * const pxSeqLock, UBaseType_t uxDataSize )
+{
+UBaseType_t x;
+
+	configASSERT( pxSeqLock );
+	configASSERT( ( uxDataSize > ( UBaseType_t ) 0 ) && ( uxDataSize <= ( UBaseType_t ) seqlockMAX_DATA_SIZE ) );
+
+	pxSeqLock->uxSequence = ( UBaseType_t ) 0;
+	pxSeqLock->uxDataSize = uxDataSize;
+
+	for( x = 0; x < ( UBaseType_t ) seqlockMAX_DATA_SIZE; x++ )
+	{
+		pxSeqLock->ucData[ x ] = 0U;
+	}
+}
+/*-----------------------------------------------------------*/
+
+void vSeqLockWrite( SeqLock_t * const pxSeqLock, const void * const pvData )
+{
+#ifdef portSET_ALL_INTERRUPT_MASK
+UBaseType_t uxSavedStatus;
+#endif
+
+	configASSERT( pxSeqLock );
+
+	/* A reader that preempted a half finished write would spin until the
+	writer ran again, which a lower priority writer never would. */
+	#ifdef portSET_ALL_INTERRUPT_MASK
+	{
+		/* Critical sections of this port leave interrupts that do not call the
+		kernel enabled, and readers may be in those too.  The write is short,
+		so all of them are held off. */
+		uxSavedStatus = portSET_ALL_INTERRUPT_MASK();
+		{
+			prvWrite( pxSeqLock, pvData );
+		}
+		portCLEAR_ALL_INTERRUPT_MASK( uxSavedStatus );
+	}
+	#else
+	{
+		taskENTER_CRITICAL();
+		{
+			prvWrite( pxSeqLock, pvData );
+		}
+		taskEXIT_CRITICAL();
+	}
+	#endif
+}
+/*-----------------------------------------------------------*/
+
+void vSeqLockWriteFromISR( SeqLock_t * const pxSeqLock, const void * const pvData )
+{
+UBaseType_t uxSavedInterruptStatus;
+
+	configASSERT( pxSeqLock );
+
+	uxSavedInterruptStatus = portSET_INTERRUPT_MASK_FROM_ISR();
+	{
+		prvWrite( pxSeqLock, pvData );
+	}
+	portCLEAR_INTERRUPT_MASK_FROM_ISR( uxSavedInterruptStatus );
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xSeqLockRead( const SeqLock_t * const pxSeqLock, void * const pvData )
+{
+UBaseType_t uxSequence, x;
+uint8_t * const pucData = ( uint8_t * ) pvData;
+
+	configASSERT( pxSeqLock );
+
+	do
+	{
+		uxSequence = pxSeqLock->uxSequence;
+
+		for( x = 0; x < pxSeqLock->uxDataSize; x++ )
+		{
+			pucData[ x ] = pxSeqLock->ucData[ x ];
+		}
+
+		/* Odd - a write was in progress when the copy started.  Changed - a
+		write completed while the copy was made. */
+	} while( ( ( uxSequence & ( UBaseType_t ) 1 ) != ( UBaseType_t ) 0 ) || ( uxSequence != pxSeqLock->uxSequence ) );
+
+	return ( uxSequence != ( UBaseType_t ) 0 ) ? pdTRUE : pdFALSE;
+}
+/*-----------------------------------------------------------*/
+
+static void prvWrite( SeqLock_t * const pxSeqLock, const void * const pvData )
+{
+const uint8_t * const pucData = ( const uint8_t * ) pvData;
+UBaseType_t x;
+
+	( pxSeqLock->uxSequence )++;
+
+	for( x = 0; x < pxSeqLock->uxDataSize; x++ )
+	{
+		pxSeqLock->ucData[ x ] = pucData[ x ];
+	}
+
+	( pxSeqLock->uxSequence )++;
+
+	/* 0 is reserved for "never written". */
+	if( pxSeqLock->uxSequence == ( UBaseType_t ) 0 )
+	{
+		pxSeqLock->uxSequence = ( UBaseType_t ) 2;
+	}
+	else
+	{
+		mtCOVERAGE_TEST_MARKER();
+	}
+}
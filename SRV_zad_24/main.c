@@ -14,6 +14,8 @@
 #include "FreeRTOS.h"
 #include "task.h"
 #include "semphr.h"
+#include "rwlock.h"
+#include "workqueue.h"
 
 /* Hardware includes. */
 #include "msp430.h"
@@ -25,8 +27,9 @@
 #define mainMAX_COUNTING_VALUE    40
 
 /* Task priorities */
-/** "Button task" priority */
-#define mainBUTTON_TASK_PRIO        ( 3 )
+/** Button work queue class and its worker priority */
+#define mainBUTTON_WORK_CLASS       ( 0 )
+#define mainBUTTON_WORK_PRIO        ( 3 )
 /** "Counting task" Priority */
 #define mainCOUNT_TASK_PRIO      ( 4 )
 /** "LE Diode task" Priority */
@@ -34,63 +37,45 @@
 
 #define mainDISP_TASK_PRIO           (2)
 #define mainDIODE_TASK_PRIO  (1)
+/** Display multiplexing period */
+#define mainDISP_PERIOD_TICKS    pdMS_TO_TICKS( 5 )
+/** Button worker may run 2 ms in every 20 ms above display, bounce cannot starve it */
+#define mainBUTTON_BUDGET_TICKS     pdMS_TO_TICKS( 2 )
+#define mainBUTTON_BUDGET_PERIOD    pdMS_TO_TICKS( 20 )
 
 
 static void prvSetupHardware( void );
 
 /*This semaphore whill be used to signal "Button press" event*/
-xSemaphoreHandle    xEvent_ButtonPressed;
-/*Used to signal "Button press" event*/
-xSemaphoreHandle    xEvent_Button;
-xSemaphoreHandle    xLightDiode;
+NotifySemaphoreHandle_t xEvent_ButtonPressed;
+NotifySemaphoreHandle_t xLightDiode;
 
-xSemaphoreHandle    xGuard_xValue;
+/*xValue is read every 5 ms and written rarely, readers share the lock*/
+RWLockHandle_t      xGuard_xValue;
 xSemaphoreHandle xGuard_Diode;
+/*Release timing of display task, read by debugger or dumped to host*/
+TaskReleaseMonitor_t xDispMonitor;
+/*Execution budget of button worker, read by debugger*/
+TaskBudget_t         xButtonBudget;
+volatile uint8_t     xValue = 10;
+volatile uint8_t diodePeriod = 10;
 /**
- * @brief "Button Task" Function
+ * @brief Button work function
  *
- * This task detect button press event and signal it to the other task
- * Thought binary semaphore
+ * Run by button work queue worker on button press, signals press event
+ * to the other tasks thought binary semaphores
  */
-volatile uint8_t     xValue = 10;
-volatile uint8_t diodePeriod = 10;
-static void prvButtonTaskFunc( void *pvParameters )
+static void prvButtonWork( void *pvParameter, uint32_t buttonEvents )
 {
-    uint16_t i;
-        /*Initial button states are 1 because of pull-up configuration*/
-        uint8_t     currentButtonState  = 1;
-        for ( ;; )
-        {
-            xSemaphoreTake(xEvent_Button,portMAX_DELAY);
-            /*wait for a little to check that button is still pressed*/
-            for(i = 0; i < 1000; i++);
-            /*Check is SW3 still pressed*/
-            currentButtonState = ((P1IN & 0x10) >> 4);
-            if(currentButtonState == 0){
-                /* If button is still pressed write that info to global variable*/
-                /* Global variable is shared resource. To access it, first try to
-                 * take mutex */
-
-                /* Write which button press event is detect */
-                xSemaphoreGive(xEvent_ButtonPressed);
-                /* Give mutex */
-
-                /* Signal to "Diode task" to change state */
-
-                continue;
-            }
-            /*Check is SW4 still pressed*/
-            currentButtonState = ((P1IN & 0x20) >> 5);
-            if(currentButtonState == 0){
-                /* If button is still pressed write that info to global variable*/
-
-                /* Write which button press event is detect */
-                xSemaphoreGive(xLightDiode);
-                /* Give mutex */
-
-
-                continue;
-            }
+        /*Check is SW3 pressed*/
+        if(buttonEvents & HAL_BUTTON_EVENT_PRESS(HAL_BUTTON_SW3)){
+            /* Signal to "Counting task" to change value */
+            xSemaphoreNotifyGive(xEvent_ButtonPressed);
+        }
+        /*Check is SW4 pressed*/
+        if(buttonEvents & HAL_BUTTON_EVENT_PRESS(HAL_BUTTON_SW4)){
+            /* Signal to "Diode task" to change period */
+            xSemaphoreNotifyGive(xLightDiode);
         }
 }
 /**
@@ -108,7 +93,7 @@ static void prvCountingTaskFunction( void *pvParameters )
     for ( ;; )
     {
         /*Wait on "Counting" event*/
-        xSemaphoreTake(xEvent_ButtonPressed, portMAX_DELAY);
+        xSemaphoreNotifyTake(xEvent_ButtonPressed, portMAX_DELAY);
         if(counter == mainMAX_COUNTING_VALUE){
             /* if counting value reached, */
 
@@ -119,9 +104,9 @@ static void prvCountingTaskFunction( void *pvParameters )
 
             counter +=2;
         }
-        xSemaphoreTake(xGuard_xValue, portMAX_DELAY);
+        xRWLockTakeWrite(xGuard_xValue, portMAX_DELAY);
         xValue = counter;
-        xSemaphoreGive(xGuard_xValue);
+        vRWLockGiveWrite(xGuard_xValue);
 
     }
 }
@@ -133,14 +118,14 @@ static void prvCountingTaskFunction( void *pvParameters )
 static void prvDiodeTaskFunc( void *pvParameters )
 {
     for(;;){
-    xSemaphoreTake(xLightDiode, portMAX_DELAY);
+    xSemaphoreNotifyTake(xLightDiode, portMAX_DELAY);
 
     xSemaphoreTake(xGuard_Diode, portMAX_DELAY);
-    xSemaphoreTake(xGuard_xValue, portMAX_DELAY);
+    xRWLockTakeRead(xGuard_xValue, portMAX_DELAY);
 
     diodePeriod = xValue;
 
-   xSemaphoreGive(xGuard_xValue);
+   vRWLockGiveRead(xGuard_xValue);
    xSemaphoreGive(xGuard_Diode);
     }
 
@@ -165,17 +150,21 @@ static void prv7SegDispMux( void *pvParameters )
 {
 
     volatile hal_7seg_display_t xCurrentActiveDisplay = HAL_DISPLAY_1;
-    xSemaphoreTake(xGuard_xValue, portMAX_DELAY);
+    xRWLockTakeRead(xGuard_xValue, portMAX_DELAY);
     uint8_t data = xValue;
-    xSemaphoreGive(xGuard_xValue);
+    vRWLockGiveRead(xGuard_xValue);
     uint8_t xSecondDigit     = data / 10;
     uint8_t xFirstDigit    = data - xSecondDigit*10;
+    TickType_t xLastWakeTime;
 
+    /*Count missed 5 ms refreshes and release jitter*/
+    vTaskSetReleaseMonitor(NULL, &xDispMonitor, mainDISP_PERIOD_TICKS, 0);
+    xLastWakeTime = xTaskGetTickCount();
     for ( ;; )
     {
-        xSemaphoreTake(xGuard_xValue, portMAX_DELAY);
+        xRWLockTakeRead(xGuard_xValue, portMAX_DELAY);
         data = xValue;
-        xSemaphoreGive(xGuard_xValue);
+        vRWLockGiveRead(xGuard_xValue);
         switch(xCurrentActiveDisplay){
             case HAL_DISPLAY_1:
                 HAL_7SEG_DISPLAY_1_ON;
@@ -198,7 +187,7 @@ static void prv7SegDispMux( void *pvParameters )
                 xCurrentActiveDisplay = HAL_DISPLAY_1;
                 break;
         }
-        vTaskDelay( pdMS_TO_TICKS(5) );
+        vTaskDelayUntil( &xLastWakeTime, mainDISP_PERIOD_TICKS );
     }
 }
 /**
@@ -210,13 +199,15 @@ void main( void )
     prvSetupHardware();
 
     /* Create tasks */
-    xTaskCreate( prvButtonTaskFunc,
-                 "Button Task",
-                 configMINIMAL_STACK_SIZE,
-                 NULL,
-                 mainBUTTON_TASK_PRIO,
-                 NULL
+    /* Button events are handled by shared work queue worker */
+    xWorkQueueCreateClass( mainBUTTON_WORK_CLASS,
+                 mainBUTTON_WORK_PRIO,
+                 4
                );
+    xHALButtonSubscribeWork( mainBUTTON_WORK_CLASS, prvButtonWork, NULL, HAL_BUTTON_EVENT_PRESS(HAL_BUTTON_SW3) |
+                                                                      HAL_BUTTON_EVENT_PRESS(HAL_BUTTON_SW4) );
+    vTaskSetBudget( xWorkQueueGetWorkerHandle( mainBUTTON_WORK_CLASS ), &xButtonBudget,
+                    mainBUTTON_BUDGET_TICKS, mainBUTTON_BUDGET_PERIOD );
     xTaskCreate( prvCountingTaskFunction,
                  "Counting Task",
                  configMINIMAL_STACK_SIZE,
@@ -247,14 +238,13 @@ void main( void )
                     );
 
 
-    xEvent_Button           =   xSemaphoreCreateBinary(); //isr
     /*Create FreeRTOS objects*/
     /*Create semaphores*/
-    xEvent_ButtonPressed    =   xSemaphoreCreateBinary();//counting
+    xEvent_ButtonPressed    =   xSemaphoreCreateBinaryNotify();//counting
 
 
-    xLightDiode            =   xSemaphoreCreateBinary();// diode
-    xGuard_xValue=   xSemaphoreCreateMutex();// mux disp
+    xLightDiode            =   xSemaphoreCreateBinaryNotify();// diode
+    xGuard_xValue=   xRWLockCreate();// mux disp
     xGuard_Diode = xSemaphoreCreateMutex();
     /* Start the scheduler. */
     vTaskStartScheduler();
@@ -279,16 +269,7 @@ static void prvSetupHardware( void )
         hal430SetSystemClock( configCPU_CLOCK_HZ, configLFXT_CLOCK_HZ );
 
         /* - Init buttons - */
-        /*Set direction to input*/
-        P1DIR &= ~0x30;
-        /*Enable pull-up resistor*/
-        P1REN |= 0x30;
-        P1OUT |= 0x30;
-        /*Enable interrupt for pins connected to SW3 and SW4*/
-        P1IE  |= 0x30;
-        P1IFG &=~0x30;
-        /*Interrupt is generated during high to low transition*/
-        P1IES |= 0x30;
+        vHALButtonInit();
 
         /* initialize LEDs */
         vHALInitLED();
@@ -301,18 +282,3 @@ static void prvSetupHardware( void )
     /*left only one display*/
     HAL_7SEG_DISPLAY_2_OFF;
 }
-
-void __attribute__ ( ( interrupt( PORT1_VECTOR  ) ) ) vPORT1ISR( void )
-{
-    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
-    /* Give semaphore if button SW3 or button SW4 is pressed*/
-    /* Note: This check is not truly necessary but it is good to
-     * have it*/
-    if(((P1IFG & 0x10) == 0x10) || ((P1IFG & 0x20) == 0x20)){
-        xSemaphoreGiveFromISR(xEvent_Button, &xHigherPriorityTaskWoken);
-    }
-    /*Clear IFG register on exit. Read more about it in official MSP430F5529 documentation*/
-    P1IFG &= ~ 0x30;
-    /* trigger scheduler if higher priority task is woken */
-    portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
-}
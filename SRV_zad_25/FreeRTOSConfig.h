@@ -57,9 +57,28 @@
 #define configGENERATE_RUN_TIME_STATS	0
 #define configCHECK_FOR_STACK_OVERFLOW	2
 #define configUSE_RECURSIVE_MUTEXES		1
+#define configUSE_CEILING_MUTEXES		1
 #define configUSE_MALLOC_FAILED_HOOK	1
 #define configUSE_APPLICATION_TASK_TAG	0
 #define configUSE_COUNTING_SEMAPHORES	1
+#define configUSE_NOTIFY_SEMAPHORES		1
+#define configUSE_QUEUE_SETS			1
+#define configUSE_EVENT_GROUP_DIRECT_FROM_ISR	1
+#define configEVENT_GROUP_MAX_WAITERS	4
+#define configUSE_SELECTIVE_CRITICAL_SECTIONS	0
+#define configUSE_WORK_QUEUES			1
+#define configWORK_QUEUE_CLASSES		2
+#define configUSE_EDF_SCHEDULING		0
+#define configEDF_PRIORITY				( 2 )
+#define configUSE_ADMISSION_CONTROL		0
+#define configADMISSION_MAX_TASKS		8
+#define configUSE_CYCLIC_EXECUTIVE		0
+#define configUSE_RELEASE_MONITOR		1
+#define configRELEASE_JITTER_BINS		4
+#define configUSE_TICK_EPOCH			0
+#define configUSE_PREEMPTION_THRESHOLD	1
+#define configUSE_TASK_BUDGETS			1
+#define configUSE_LATENCY_PROBE			0
 
 #ifdef __LARGE_DATA_MODEL__
 	#define configMINIMAL_STACK_SIZE		( ( unsigned short ) 80 )
@@ -95,8 +114,28 @@ vApplicationSetupTimerInterrupt() generates the tick from timer A0, so in this
 case configTICK_VECTOR is set to TIMER0_A0_VECTOR. */
 #define configTICK_VECTOR				TIMER0_A0_VECTOR
 
+/* The latency probe in hal_latency.h stamps entry of the tick interrupt, which
+wakes tasks from the tick hook.  The capture is a single xor on TB0CCTL6.  It
+runs after the compiler prologue of vTickISREntry has pushed r11 to r15, so
+tick samples are short by that fixed offset, see HAL_LATENCY_ISR_ENTRY(). */
+#if( configUSE_LATENCY_PROBE == 1 )
+	#define configTICK_ISR_ENTRY_HOOK()	( TB0CCTL6 ^= CCIS0 )
+#endif
+
 #define configASSERT( x ) if( ( x ) == 0 ) { taskDISABLE_INTERRUPTS(); for( ;; ); }
 
+/* Count switches to a different task, so runs built with and without
+configUSE_PREEMPTION_THRESHOLD can be compared.  Both variables are defined in
+main.c, the count is sent with the monitor report frame. */
+extern volatile uint32_t ulTaskSwitchCount;
+extern void * volatile pvLastSwitchedIn;
+#define traceTASK_SWITCHED_IN()										\
+	if( pvLastSwitchedIn != ( void * ) pxCurrentTCB )				\
+	{																\
+		pvLastSwitchedIn = ( void * ) pxCurrentTCB;					\
+		ulTaskSwitchCount++;										\
+	}
+
 /* enable use of UART */
 //#define configUSE_UART                  1
 
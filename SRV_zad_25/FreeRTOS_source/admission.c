@@ -0,0 +1,403 @@
+/*
+ * Schedulability analysis and admission control for FreeRTOS, see admission.h.
+ *
+ * The declared timing of admitted tasks is kept in a fixed size table.  A new
+ * task is analysed by placing it in the first free entry and running the
+ * analysis over the table as if it were already admitted.  The analysis only
+ * runs when a task is created, so it is done with the scheduler suspended
+ * rather than in a critical section, and interrupts are never delayed by it.
+ *
+ * 1 tab == 4 spaces!
+ */
+
+/* Standard includes. */
+#include <stdlib.h>
+
+/* Defining MPU_WRAPPERS_INCLUDED_FROM_API_FILE prevents task.h from redefining
+all the API functions to use the MPU wrappers.  That should only be done when
+task.h is included from an application file. */
+#define MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* FreeRTOS includes. */
+#include "FreeRTOS.h"
+#include "task.h"
+#include "admission.h"
+
+#undef MPU_WRAPPERS_INCLUDED_FROM_API_FILE
+
+/* This entire source file will be skipped if the application is not configured
+to include admission control functionality. */
+#if( ( configUSE_ADMISSION_CONTROL == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+
+/* Densities are summed as fractions of admissionDENSITY_ONE. */
+#define admissionDENSITY_ONE		( ( uint32_t ) 0x10000UL )
+
+typedef struct xADMITTED_TASK
+{
+	TaskHandle_t xHandle;			/*< NULL while the entry is being analysed as a candidate. */
+	UBaseType_t uxPriority;
+	TaskTiming_t xTiming;
+	uint32_t ulResponseTime;		/*< Result of the last analysis, 0 if the deadline could be missed. */
+} AdmittedTask_t;
+
+PRIVILEGED_DATA static AdmittedTask_t xAdmittedTasks[ configADMISSION_MAX_TASKS ];
+PRIVILEGED_DATA static UBaseType_t uxAdmittedCount = ( UBaseType_t ) 0U;
+PRIVILEGED_DATA static BaseType_t xOverloaded = pdFALSE;
+
+/*-----------------------------------------------------------*/
+
+/*
+ * Returns the deadline of pxTask, which is its period if no deadline was
+ * declared.
+ */
+static uint32_t prvDeadline( const AdmittedTask_t * const pxTask ) PRIVILEGED_FUNCTION;
+
+/*
+ * Returns the worst case response time of the task in entry uxIndex of the
+ * first uxCount table entries, or 0 if it could miss its deadline.
+ */
+static uint32_t prvResponseTime( UBaseType_t uxIndex, UBaseType_t uxCount ) PRIVILEGED_FUNCTION;
+
+#if( configUSE_EDF_SCHEDULING == 1 )
+
+	/*
+	 * Returns pdTRUE if the sum of C / min( D, T ) over the EDF tasks and all
+	 * tasks of higher priority in the first uxCount entries is at most one.
+	 */
+	static BaseType_t prvDensityTest( UBaseType_t uxCount ) PRIVILEGED_FUNCTION;
+
+#endif
+
+/*
+ * Analyse the first uxCount table entries.  Returns pdTRUE if every task meets
+ * its deadline.  The response times are written back if xStoreResults is
+ * pdTRUE.
+ */
+static BaseType_t prvAnalyseTaskSet( UBaseType_t uxCount, BaseType_t xStoreResults ) PRIVILEGED_FUNCTION;
+
+/*
+ * Fill in the first free entry as a candidate for admission.
+ */
+static void prvSetCandidate( UBaseType_t uxPriority, const TaskTiming_t * const pxTiming ) PRIVILEGED_FUNCTION;
+
+/*-----------------------------------------------------------*/
+
+BaseType_t xTaskCreateAdmitted( TaskFunction_t pxTaskCode,
+								const char * const pcName,	/*lint !e971 Unqualified char types are allowed for strings and single characters only. */
+								const configSTACK_DEPTH_TYPE usStackDepth,
+								void * const pvParameters,
+								UBaseType_t uxPriority,
+								const TaskTiming_t * const pxTiming,
+								TaskHandle_t * const pxCreatedTask )
+{
+TaskHandle_t xHandle = NULL;
+BaseType_t xReturn;
+
+	configASSERT( pxTiming );
+
+	vTaskSuspendAll();
+	{
+		if( uxAdmittedCount >= ( UBaseType_t ) configADMISSION_MAX_TASKS )
+		{
+			xReturn = errTASK_SET_UNSCHEDULABLE;
+		}
+		else
+		{
+			prvSetCandidate( uxPriority, pxTiming );
+
+			if( prvAnalyseTaskSet( uxAdmittedCount + ( UBaseType_t ) 1, pdFALSE ) != pdFALSE )
+			{
+				xReturn = pdPASS;
+			}
+			else
+			{
+				#if( configADMISSION_REJECT_UNSCHEDULABLE == 1 )
+				{
+					xReturn = errTASK_SET_UNSCHEDULABLE;
+				}
+				#else
+				{
+					/* Admit the task anyway, the overload is flagged once it
+					has been created. */
+					xReturn = pdPASS;
+				}
+				#endif
+			}
+
+			if( xReturn == pdPASS )
+			{
+				xReturn = xTaskCreate( pxTaskCode, pcName, usStackDepth, pvParameters, uxPriority, &xHandle );
+
+				if( xReturn == pdPASS )
+				{
+					xAdmittedTasks[ uxAdmittedCount ].xHandle = xHandle;
+					uxAdmittedCount++;
+
+					if( prvAnalyseTaskSet( uxAdmittedCount, pdTRUE ) == pdFALSE )
+					{
+						xOverloaded = pdTRUE;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+	}
+	( void ) xTaskResumeAll();
+
+	if( pxCreatedTask != NULL )
+	{
+		*pxCreatedTask = xHandle;
+	}
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xAdmissionTest( UBaseType_t uxPriority, const TaskTiming_t * const pxTiming )
+{
+BaseType_t xReturn = errTASK_SET_UNSCHEDULABLE;
+
+	configASSERT( pxTiming );
+
+	vTaskSuspendAll();
+	{
+		if( uxAdmittedCount < ( UBaseType_t ) configADMISSION_MAX_TASKS )
+		{
+			prvSetCandidate( uxPriority, pxTiming );
+
+			if( prvAnalyseTaskSet( uxAdmittedCount + ( UBaseType_t ) 1, pdFALSE ) != pdFALSE )
+			{
+				xReturn = pdPASS;
+			}
+			else
+			{
+				mtCOVERAGE_TEST_MARKER();
+			}
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+	( void ) xTaskResumeAll();
+
+	return xReturn;
+}
+/*-----------------------------------------------------------*/
+
+BaseType_t xAdmissionIsOverloaded( void )
+{
+	return xOverloaded;
+}
+/*-----------------------------------------------------------*/
+
+uint32_t ulAdmissionGetResponseTime( TaskHandle_t xTask )
+{
+UBaseType_t uxIndex;
+uint32_t ulReturn = 0UL;
+
+	vTaskSuspendAll();
+	{
+		for( uxIndex = ( UBaseType_t ) 0U; uxIndex < uxAdmittedCount; uxIndex++ )
+		{
+			if( xAdmittedTasks[ uxIndex ].xHandle == xTask )
+			{
+				ulReturn = xAdmittedTasks[ uxIndex ].ulResponseTime;
+				break;
+			}
+		}
+	}
+	( void ) xTaskResumeAll();
+
+	return ulReturn;
+}
+/*-----------------------------------------------------------*/
+
+void vAdmissionRemoveTask( TaskHandle_t xTask )
+{
+UBaseType_t uxIndex;
+
+	for( uxIndex = ( UBaseType_t ) 0U; uxIndex < uxAdmittedCount; uxIndex++ )
+	{
+		if( xAdmittedTasks[ uxIndex ].xHandle == xTask )
+		{
+			/* The analysis does not depend on the order of entries, so the
+			last one fills the hole. */
+			uxAdmittedCount--;
+			xAdmittedTasks[ uxIndex ] = xAdmittedTasks[ uxAdmittedCount ];
+			break;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+	}
+}
+/*-----------------------------------------------------------*/
+
+static uint32_t prvDeadline( const AdmittedTask_t * const pxTask )
+{
+	if( ( pxTask->xTiming.ulDeadline == 0UL ) || ( pxTask->xTiming.ulDeadline > pxTask->xTiming.ulPeriod ) )
+	{
+		/* Only constrained deadlines are supported by the analysis, a later
+		deadline is treated as equal to the period. */
+		return pxTask->xTiming.ulPeriod;
+	}
+
+	return pxTask->xTiming.ulDeadline;
+}
+/*-----------------------------------------------------------*/
+
+static uint32_t prvResponseTime( UBaseType_t uxIndex, UBaseType_t uxCount )
+{
+const AdmittedTask_t * const pxTask = &( xAdmittedTasks[ uxIndex ] );
+const uint32_t ulDeadline = prvDeadline( pxTask );
+const AdmittedTask_t *pxOther;
+uint32_t ulResponse, ulNext, ulReleases;
+UBaseType_t x;
+
+	if( pxTask->xTiming.ulWCET > ulDeadline )
+	{
+		return 0UL;
+	}
+
+	#if( configUSE_EDF_SCHEDULING == 1 )
+	{
+		if( pxTask->uxPriority == ( UBaseType_t ) configEDF_PRIORITY )
+		{
+			return ( prvDensityTest( uxCount ) != pdFALSE ) ? ulDeadline : 0UL;
+		}
+	}
+	#endif
+
+	/* R = C + sum over tasks j of equal or higher priority of ceil( R / Tj ) * Cj,
+	iterated from R = C until it stops growing or passes the deadline. */
+	ulResponse = pxTask->xTiming.ulWCET;
+
+	for( ;; )
+	{
+		ulNext = pxTask->xTiming.ulWCET;
+
+		for( x = ( UBaseType_t ) 0U; x < uxCount; x++ )
+		{
+			pxOther = &( xAdmittedTasks[ x ] );
+
+			if( ( x != uxIndex ) && ( pxOther->uxPriority >= pxTask->uxPriority ) )
+			{
+				ulReleases = ulResponse / pxOther->xTiming.ulPeriod;
+
+				if( ( ulResponse % pxOther->xTiming.ulPeriod ) != 0UL )
+				{
+					ulReleases++;
+				}
+
+				ulNext += ulReleases * pxOther->xTiming.ulWCET;
+
+				if( ulNext > ulDeadline )
+				{
+					return 0UL;
+				}
+			}
+		}
+
+		if( ulNext == ulResponse )
+		{
+			return ulResponse;
+		}
+
+		ulResponse = ulNext;
+	}
+}
+/*-----------------------------------------------------------*/
+
+#if( configUSE_EDF_SCHEDULING == 1 )
+
+	static BaseType_t prvDensityTest( UBaseType_t uxCount )
+	{
+	const AdmittedTask_t *pxTask;
+	uint32_t ulDensity = 0UL, ulWindow;
+	UBaseType_t x;
+
+		for( x = ( UBaseType_t ) 0U; x < uxCount; x++ )
+		{
+			pxTask = &( xAdmittedTasks[ x ] );
+
+			if( pxTask->uxPriority >= ( UBaseType_t ) configEDF_PRIORITY )
+			{
+				ulWindow = prvDeadline( pxTask );
+
+				/* Rounded up so the test never passes a set it should not. */
+				ulDensity += ( uint32_t ) ( ( ( ( uint64_t ) pxTask->xTiming.ulWCET * admissionDENSITY_ONE ) + ulWindow - 1U ) / ulWindow );
+
+				if( ulDensity > admissionDENSITY_ONE )
+				{
+					return pdFALSE;
+				}
+			}
+		}
+
+		return pdTRUE;
+	}
+
+#endif /* configUSE_EDF_SCHEDULING */
+/*-----------------------------------------------------------*/
+
+static BaseType_t prvAnalyseTaskSet( UBaseType_t uxCount, BaseType_t xStoreResults )
+{
+BaseType_t xSchedulable = pdTRUE;
+uint32_t ulResponse;
+UBaseType_t x;
+
+	for( x = ( UBaseType_t ) 0U; x < uxCount; x++ )
+	{
+		ulResponse = prvResponseTime( x, uxCount );
+
+		if( ulResponse == 0UL )
+		{
+			xSchedulable = pdFALSE;
+
+			if( xStoreResults == pdFALSE )
+			{
+				/* Only the verdict is needed. */
+				break;
+			}
+		}
+
+		if( xStoreResults != pdFALSE )
+		{
+			xAdmittedTasks[ x ].ulResponseTime = ulResponse;
+		}
+	}
+
+	return xSchedulable;
+}
+/*-----------------------------------------------------------*/
+
+static void prvSetCandidate( UBaseType_t uxPriority, const TaskTiming_t * const pxTiming )
+{
+AdmittedTask_t * const pxCandidate = &( xAdmittedTasks[ uxAdmittedCount ] );
+
+	configASSERT( pxTiming->ulPeriod > 0UL );
+	configASSERT( pxTiming->ulWCET > 0UL );
+
+	pxCandidate->xHandle = NULL;
+	pxCandidate->uxPriority = uxPriority;
+	pxCandidate->xTiming = *pxTiming;
+	pxCandidate->ulResponseTime = 0UL;
+}
+/*-----------------------------------------------------------*/
+
+/* This entire source file will be skipped if the application is not configured
+to include admission control functionality. */
+#endif /* ( configUSE_ADMISSION_CONTROL == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) */
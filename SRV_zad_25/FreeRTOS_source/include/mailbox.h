@@ -0,0 +1,119 @@
+/*
+ * Single value mailbox for FreeRTOS.
+ *
+ * A mailbox holds the latest value written to it.  Writers always overwrite,
+ * readers copy the value without removing it.  Every write increments a
+ * version number, so a reader can tell a new value from one it has already
+ * seen and can block until a newer value is written.  Unlike a length one
+ * queue used with xQueueOverwrite() and xQueuePeek() there is no queue lock,
+ * read/write position or send list - each operation is one copy inside a short
+ * critical section.
+ *
+ * 1 tab == 4 spaces!
+ */
+
+#ifndef MAILBOX_H
+#define MAILBOX_H
+
+#ifndef INC_FREERTOS_H
+	#error "include FreeRTOS.h" must appear in source files before "include mailbox.h"
+#endif
+
+#include "task.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * mailbox.h
+ *
+ * Type by which mailboxes are referenced.
+ *
+ * \defgroup MailboxHandle_t MailboxHandle_t
+ * \ingroup Mailbox
+ */
+struct MailboxDefinition;
+typedef struct MailboxDefinition * MailboxHandle_t;
+
+/**
+ * mailbox.h
+ * <pre>MailboxHandle_t xMailboxCreate( UBaseType_t uxItemSize );</pre>
+ *
+ * Create an empty mailbox holding one value of uxItemSize bytes.
+ *
+ * @return Handle to the created mailbox, or NULL if there was not enough heap.
+ *
+ * \defgroup xMailboxCreate xMailboxCreate
+ * \ingroup Mailbox
+ */
+MailboxHandle_t xMailboxCreate( UBaseType_t uxItemSize ) PRIVILEGED_FUNCTION;
+
+/**
+ * mailbox.h
+ * <pre>void vMailboxOverwrite( MailboxHandle_t xMailbox, const void *pvItem );</pre>
+ *
+ * Replace the value in the mailbox and increment its version.  All tasks
+ * blocked in xMailboxWaitForUpdate() are unblocked.  Never blocks.
+ */
+void vMailboxOverwrite( MailboxHandle_t xMailbox, const void * const pvItem ) PRIVILEGED_FUNCTION;
+
+/**
+ * mailbox.h
+ * <pre>void vMailboxOverwriteFromISR( MailboxHandle_t xMailbox, const void *pvItem, BaseType_t *pxHigherPriorityTaskWoken );</pre>
+ *
+ * A version of vMailboxOverwrite() that can be called from an interrupt.
+ * *pxHigherPriorityTaskWoken is set to pdTRUE if a task of higher priority
+ * than the interrupted task was unblocked.
+ */
+void vMailboxOverwriteFromISR( MailboxHandle_t xMailbox, const void * const pvItem, BaseType_t * const pxHigherPriorityTaskWoken ) PRIVILEGED_FUNCTION;
+
+/**
+ * mailbox.h
+ * <pre>UBaseType_t uxMailboxPeek( MailboxHandle_t xMailbox, void *pvItem );</pre>
+ *
+ * Copy the value out of the mailbox, leaving it in place.  Never blocks.  Use
+ * uxMailboxPeekFromISR() in interrupts.
+ *
+ * @return The version of the copied value, or 0 if the mailbox has never been
+ * written, in which case nothing is copied.  Versions start at 1 and skip 0
+ * when they wrap.
+ */
+UBaseType_t uxMailboxPeek( MailboxHandle_t xMailbox, void * const pvItem ) PRIVILEGED_FUNCTION;
+
+/**
+ * mailbox.h
+ * <pre>UBaseType_t uxMailboxPeekFromISR( MailboxHandle_t xMailbox, void *pvItem );</pre>
+ *
+ * A version of uxMailboxPeek() that can be called from an interrupt.
+ */
+UBaseType_t uxMailboxPeekFromISR( MailboxHandle_t xMailbox, void * const pvItem ) PRIVILEGED_FUNCTION;
+
+/**
+ * mailbox.h
+ * <pre>BaseType_t xMailboxWaitForUpdate( MailboxHandle_t xMailbox, void *pvItem, UBaseType_t *puxVersion, TickType_t xTicksToWait );</pre>
+ *
+ * Copy the value out of the mailbox once its version differs from
+ * *puxVersion, blocking for up to xTicksToWait until it does.  Set *puxVersion
+ * to 0 before the first call, so any written value counts as new.
+ *
+ * @param puxVersion Version last seen by the caller.  Updated to the version
+ * of the copied value.
+ *
+ * @return pdPASS if a new value was copied, pdFAIL on timeout.
+ */
+BaseType_t xMailboxWaitForUpdate( MailboxHandle_t xMailbox, void * const pvItem, UBaseType_t * const puxVersion, TickType_t xTicksToWait ) PRIVILEGED_FUNCTION;
+
+/**
+ * mailbox.h
+ * <pre>UBaseType_t uxMailboxGetVersion( MailboxHandle_t xMailbox );</pre>
+ *
+ * @return The version of the value in the mailbox, 0 if never written.
+ */
+UBaseType_t uxMailboxGetVersion( MailboxHandle_t xMailbox ) PRIVILEGED_FUNCTION;
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MAILBOX_H */
@@ -16,6 +16,7 @@
 #include "semphr.h"
 #include "queue.h"
 #include "timers.h"
+#include "workqueue.h"
 
 /* Hardware includes. */
 #include "msp430.h"
@@ -23,8 +24,6 @@
 /* User's includes */
 #include "../common/ETF5529_HAL/hal_ETF_5529.h"
 
-#define ULONG_MAX                       0xFFFFFFFF
-
 typedef enum{
     DIODE_3_ON,
     DIODE_3_OFF,
@@ -35,23 +34,44 @@ typedef enum{
 
 
 /* Task priorities */
-/** "Button processing" priority */
-#define mainBUTTON_PROCESSING_TASK_PRIO     ( 3 )
-/** "Char processing" priority */
-#define mainCHAR_PROCESSING_TASK_PRIO       ( 2 )
+/** Button work queue class and its worker priority */
+#define mainBUTTON_WORK_CLASS               ( 0 )
+#define mainBUTTON_WORK_PRIO                ( 3 )
+/** "Frame processing" priority */
+#define mainFRAME_PROCESSING_TASK_PRIO      ( 2 )
 /** "LE Diode task" Priority */
 #define mainDIODE_CONTROL_TASK_PRIO         ( 4)
 #define mainDISPLAY_TASK_PRIO  (1)
+/** Preemption threshold of tasks that only hand commands to "LE Diode task" */
+#define mainDIODE_PRODUCER_THRESHOLD        mainDIODE_CONTROL_TASK_PRIO
+/** Frame task may run 2 ms in every 10 ms above display, UART flood cannot starve it */
+#define mainFRAME_BUDGET_TICKS              pdMS_TO_TICKS( 2 )
+#define mainFRAME_BUDGET_PERIOD             pdMS_TO_TICKS( 10 )
 
 #define mainDISP_1            0x01    /* Start AD conversion bit mask */
 #define mainDISP_2          0x02
-
-/* Char queue parameters value*/
-#define mainCHAR_QUEUE_LENGTH               5
+/** Display refresh period, each refresh is one monitored release */
+#define mainDISP_PERIOD_TICKS               pdMS_TO_TICKS( 5 )
+
+/* UART control channel frame types */
+/** Turn LED4 on, no payload */
+#define mainFRAME_LED4_ON                   0x01
+/** Turn LED4 off, no payload */
+#define mainFRAME_LED4_OFF                  0x02
+/** Show number on display, payload is one byte 0-99 */
+#define mainFRAME_SET_DISPLAY               0x03
+/** Send display release monitor line and task switch count as text, no payload */
+#define mainFRAME_MONITOR_REPORT            0x04
+/* Longest line written by xTaskReleaseMonitorDump() */
+#define mainMONITOR_LINE_LENGTH             ( configMAX_TASK_NAME_LEN + ( 5 + configRELEASE_JITTER_BINS ) * 11 + 2 )
+/** Partial frame is dropped after line is quiet for about three byte times at 9600 baud */
+#define mainFRAME_BYTE_TIMEOUT_US           ( 3000 )
 /* Diode command queue parameters value*/
 #define mainDIODE_COMMAND_QUEUE_LENGTH      5
+/* Display value mailbox and timer semaphore, each posts at most once to set */
+#define mainDISPLAY_MAILBOX_LENGTH          1
+#define mainDISPLAY_SET_LENGTH              ( mainDISPLAY_MAILBOX_LENGTH + 1 )
 
-TaskHandle_t        xButtonTaskHandle;
 TaskHandle_t   xDispTaskHandle;
 TaskHandle_t   xTimerTaskHandle;
 /* Software Timer handler*/
@@ -59,83 +79,90 @@ TimerHandle_t       xDispTimer;
 static void prvSetupHardware( void );
 
 xSemaphoreHandle    xEvent_Timer;
-/* This queue will be used to buffer char received over UART interface*/
-xQueueHandle        xCharQueue;
 /* This queue will be used to buffer diode control messages*/
 xQueueHandle        xCommandQueue;
+/* Mailbox with latest number received over UART for display task*/
+xQueueHandle        xDisplayMailbox;
+/* Display task blocks on this set until new number or refresh tick arrives*/
+QueueSetHandle_t    xDisplaySet;
+/* Execution budget of frame task, read by debugger */
+TaskBudget_t        xFrameBudget;
+/* Refresh timing of display task, sent on mainFRAME_MONITOR_REPORT */
+TaskReleaseMonitor_t xDispMonitor;
+/* Tick the last refresh was due at, written by timer callback */
+static volatile TickType_t xDispRelease;
+/* Switches to a different task, counted by traceTASK_SWITCHED_IN */
+volatile uint32_t   ulTaskSwitchCount = 0;
+void * volatile     pvLastSwitchedIn = NULL;
 /**
- * @brief "Char Processing" Function
+ * @brief "LED4 on" frame handler
  *
- * This task waits for character over UART received from xCharQueue. After character
- * is received it is processed and based on character value appropriate Diode Control
- * message is written to global variable
+ * Called from frame task when mainFRAME_LED4_ON frame is received
  */
-static void prvCharProcessingTaskFunction( void *pvParameters )
+static void prvLed4OnFrameHandler( const uint8_t *pucPayload, uint8_t ucLength )
 {
-    char        recChar =   0;
-    diode_command_t commandToSend = DIODE_COMMAND_UNDEF;
-    uint8_t i = 0;
-    uint8_t num = 0;
-    for ( ;; )
-    {
-        /*Read char from the queue*/
-        xQueueReceive(xCharQueue, &recChar, portMAX_DELAY);
-
-
-        /*Determine which character is received and based on character value
-         * determine which command will be sent to "Diode Control" task*/
-        switch(recChar){
-            case 'e':
-                commandToSend   = DIODE_4_ON;
-                i = 0;
-                num = 0;
-                break;
-            case 'd':
-                commandToSend   = DIODE_4_OFF;
-                i = 0;
-                num = 0;
-                break;
-            case 's':
-                i = 1;
-                num = 0;
-                commandToSend   = DIODE_COMMAND_UNDEF;
-                break;
-            case '0':case'1': case'2': case'3': case'4':case'5':case'6': case'7': case'8': case'9':
-                commandToSend   = DIODE_COMMAND_UNDEF;
-                switch(i){
-                case 1:
-                    num += (recChar - '0')*10;
-                    i++;
-                    break;
-                case 2:
-                    num += (recChar - '0');
-                    i++;
-                    break;
-                default:
-                    i = 0;
-                    break;
-                }
+    diode_command_t commandToSend = DIODE_4_ON;
 
-                break;
-            case 't':
-                if( i == 3){
-                    xTaskNotify(xDispTaskHandle, num, eSetValueWithOverwrite);
-                }
-                num = 0;
-                i = 0;
-                commandToSend   = DIODE_COMMAND_UNDEF;
-                break;
+    ( void ) pucPayload;
+    ( void ) ucLength;
+    xQueueSendToBack(xCommandQueue, &commandToSend, portMAX_DELAY);
+}
+/**
+ * @brief "LED4 off" frame handler
+ *
+ * Called from frame task when mainFRAME_LED4_OFF frame is received
+ */
+static void prvLed4OffFrameHandler( const uint8_t *pucPayload, uint8_t ucLength )
+{
+    diode_command_t commandToSend = DIODE_4_OFF;
 
+    ( void ) pucPayload;
+    ( void ) ucLength;
+    xQueueSendToBack(xCommandQueue, &commandToSend, portMAX_DELAY);
+}
+/**
+ * @brief "Set display" frame handler
+ *
+ * Payload is one byte with number 0-99 which is sent to "Display" task
+ */
+static void prvSetDisplayFrameHandler( const uint8_t *pucPayload, uint8_t ucLength )
+{
+    if(ucLength == 1 && pucPayload[0] < 100){
+        xQueueOverwrite(xDisplayMailbox, &pucPayload[0]);
+    }
+}
+static void prvSendNumber( uint32_t ulValue )
+{
+    char    pcDigits[ 11 ];
+    uint8_t ucIndex = sizeof( pcDigits ) - 1;
+
+    pcDigits[ ucIndex ] = '\0';
+    do{
+        pcDigits[ --ucIndex ] = ( char ) ( '0' + ( char ) ( ulValue % 10 ) );
+        ulValue /= 10;
+    }while( ulValue != 0 );
+    vHALUARTSendString( &pcDigits[ ucIndex ] );
+}
+/**
+ * @brief "Monitor report" frame handler
+ *
+ * Sends xDispMonitor as one line of text, see xTaskReleaseMonitorDump(),
+ * followed by line "switches <count> preemption_threshold <0 or 1>"
+ */
+static void prvMonitorReportFrameHandler( const uint8_t *pucPayload, uint8_t ucLength )
+{
+    static char pcLine[ mainMONITOR_LINE_LENGTH ];
 
-           default:
-                commandToSend   = DIODE_COMMAND_UNDEF;
-                i = 0;
-                num = 0;
-                break;
-        }
-        if(commandToSend != DIODE_COMMAND_UNDEF)
-            xQueueSendToBack(xCommandQueue,&commandToSend,portMAX_DELAY);
+    ( void ) pucPayload;
+    ( void ) ucLength;
+    if( xTaskReleaseMonitorDump( &xDispMonitor, pcLine, sizeof( pcLine ) ) != 0 ){
+        vHALUARTSendString( pcLine );
     }
+    vHALUARTSendString( "switches " );
+    prvSendNumber( ulTaskSwitchCount );
+    vHALUARTSendString( " preemption_threshold " );
+    prvSendNumber( configUSE_PREEMPTION_THRESHOLD );
+    vHALUARTSendString( "\n" );
 }
 /**
  * @brief "Diode Control" task function
@@ -170,73 +197,60 @@ static void prvDiodeControlTaskFunction( void *pvParameters )
     }
 }
 /**
- * @brief "Button Task" Function
+ * @brief Button work function
  *
- * This task waits for xEvent_Button semaphore to be given from
- * port ISR. After that, simple debauncing is performed in order
- * to verify that button is still pressed
+ * Run by button work queue worker for debounced button press events
+ * from button service, sends appropriate command to "Diode Control" task
  */
-static void prvButtonTaskFunction( void *pvParameters )
+static void prvButtonWork( void *pvParameter, uint32_t buttonEvents )
 {
-    uint16_t i;
-    /*Initial button states are 1 because of pull-up configuration*/
-    uint8_t         currentButtonState  = 1;
     diode_command_t commandToSend       = DIODE_COMMAND_UNDEF;
-    for ( ;; )
-    {
-        /* Wait for notification from ISR*/
-        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
-        /*wait for a little to check that button is still pressed*/
-        for(i = 0; i < 1000; i++);
-        /*take button state*/
-        /* check if button SW3 is pressed*/
-        currentButtonState = ((P1IN & 0x10) >> 4);
-        if(currentButtonState == 0){
-            /* If SW3 is pressed send command to disable diode */
-            commandToSend   =   DIODE_3_ON;
-            xQueueSendToBack(xCommandQueue, &commandToSend, portMAX_DELAY);
-            continue;
-        }
-        /* check if button SW4 is pressed*/
-        currentButtonState = ((P1IN & 0x20) >> 5);
-        if(currentButtonState == 0){
-            /* If SW4 is pressed send command to enable diode */
-            commandToSend   =   DIODE_3_OFF;
-            xQueueSendToBack(xCommandQueue, &commandToSend, portMAX_DELAY);
-            continue;
-        }
+    /* check if button SW3 is pressed*/
+    if(buttonEvents & HAL_BUTTON_EVENT_PRESS(HAL_BUTTON_SW3)){
+        /* If SW3 is pressed send command to enable diode */
+        commandToSend   =   DIODE_3_ON;
+        xQueueSendToBack(xCommandQueue, &commandToSend, portMAX_DELAY);
+    }
+    /* check if button SW4 is pressed*/
+    if(buttonEvents & HAL_BUTTON_EVENT_PRESS(HAL_BUTTON_SW4)){
+        /* If SW4 is pressed send command to disable diode */
+        commandToSend   =   DIODE_3_OFF;
+        xQueueSendToBack(xCommandQueue, &commandToSend, portMAX_DELAY);
     }
 }
 
 void    prvDispTimerCallback(TimerHandle_t xTimer){
 
+    /* Timer is already reloaded, so this expiry is one period back */
+    xDispRelease = xTimerGetExpiryTime(xTimer) - xTimerGetPeriod(xTimer);
     xSemaphoreGive(xEvent_Timer);
-
-
 }
 static void prvDisplayTaskFunction( void *pvParameters )
 {
     /* New received 8bit data */
-    uint32_t         NewValueToShow      = 0;
-    uint32_t notifyValue = 0;
+    uint8_t         NewValueToShow      = 0;
     /* High and Low number digit*/
-    uint8_t         digitLow, digitHigh;
+    uint8_t         digitLow = 0, digitHigh = 0;
     uint32_t current_disp = mainDISP_1;
+    QueueSetMemberHandle_t xReady;
+
+    /*Count refreshes that miss their 5 ms period and release jitter*/
+    vTaskSetReleaseMonitor(NULL, &xDispMonitor, mainDISP_PERIOD_TICKS, 0);
     for ( ;; )
     {
-        /* Check if new number is received*/
-        /* Waits for notification value */
-        if(xTaskNotifyWait(ULONG_MAX, ULONG_MAX, &NewValueToShow, 0)== pdTRUE){
+        /* Block until new number is received or display has to be refreshed*/
+        xReady = xQueueSelectFromSetAndReceive(xDisplaySet, &NewValueToShow, portMAX_DELAY);
+        if(xReady == xDisplayMailbox){
         /* If there is new number to show on display, split it on High and Low digit */
               /* Extract high digit*/
               digitHigh = NewValueToShow/10;
               /* Extract low digit*/
               digitLow = NewValueToShow - digitHigh*10;
+              continue;
         }
 
-
-        xSemaphoreTake(xEvent_Timer,portMAX_DELAY);
-
+        /* Timer is not driven by vTaskDelayUntil, refresh is marked here */
+        vTaskReleaseMonitorMark(xDispRelease);
         if(current_disp == mainDISP_1){
         HAL_7SEG_DISPLAY_1_ON;
         HAL_7SEG_DISPLAY_2_OFF;
@@ -248,6 +262,7 @@ static void prvDisplayTaskFunction( void *pvParameters )
           vHAL7SEGWriteDigit(digitHigh);
         }
         current_disp = (current_disp == mainDISP_1)? mainDISP_2:mainDISP_1;
+        vTaskReleaseMonitorComplete();
     }
 }
 
@@ -260,13 +275,15 @@ void main( void )
     prvSetupHardware();
 
     /* Create tasks */
-    xTaskCreate( prvCharProcessingTaskFunction,
-                 "Char Processing Task",
-                 configMINIMAL_STACK_SIZE,
-                 NULL,
-                 mainCHAR_PROCESSING_TASK_PRIO,
-                 NULL
-               );
+    /* Frame task dispatches frames received over UART to handlers */
+    xHALFrameInit(mainFRAME_PROCESSING_TASK_PRIO);
+    /* Byte timeout is armed from RX ISR on high resolution timer */
+    xHALHRTimerInit();
+    vHALFrameSetByteTimeout(mainFRAME_BYTE_TIMEOUT_US);
+    xHALFrameRegisterHandler(mainFRAME_LED4_ON, prvLed4OnFrameHandler);
+    xHALFrameRegisterHandler(mainFRAME_LED4_OFF, prvLed4OffFrameHandler);
+    xHALFrameRegisterHandler(mainFRAME_SET_DISPLAY, prvSetDisplayFrameHandler);
+    xHALFrameRegisterHandler(mainFRAME_MONITOR_REPORT, prvMonitorReportFrameHandler);
     xTaskCreate( prvDiodeControlTaskFunction,
                  "Diode Control Task",
                  configMINIMAL_STACK_SIZE,
@@ -274,13 +291,21 @@ void main( void )
                  mainDIODE_CONTROL_TASK_PRIO,
                  NULL
                );
-    xTaskCreate( prvButtonTaskFunction,
-                 "Button Processing Task",
-                 configMINIMAL_STACK_SIZE,
-                 NULL,
-                 mainBUTTON_PROCESSING_TASK_PRIO,
-                 &xButtonTaskHandle
+    /* Button events are handled by shared work queue worker */
+    xWorkQueueCreateClass( mainBUTTON_WORK_CLASS,
+                 mainBUTTON_WORK_PRIO,
+                 4
                );
+    xHALButtonSubscribeWork( mainBUTTON_WORK_CLASS, prvButtonWork, NULL, HAL_BUTTON_EVENT_PRESS(HAL_BUTTON_SW3) |
+                                                                      HAL_BUTTON_EVENT_PRESS(HAL_BUTTON_SW4) );
+    /* Frame task and button worker finish their work before "Diode Control"
+     * task runs, instead of being switched out on every command they send.
+     * Build with configUSE_PREEMPTION_THRESHOLD 0 to compare switch count */
+#if( configUSE_PREEMPTION_THRESHOLD == 1 )
+    vTaskSetPreemptionThreshold( xHALFrameGetTaskHandle(), mainDIODE_PRODUCER_THRESHOLD );
+    vTaskSetPreemptionThreshold( xWorkQueueGetWorkerHandle( mainBUTTON_WORK_CLASS ), mainDIODE_PRODUCER_THRESHOLD );
+#endif
+    vTaskSetBudget( xHALFrameGetTaskHandle(), &xFrameBudget, mainFRAME_BUDGET_TICKS, mainFRAME_BUDGET_PERIOD );
     xTaskCreate( prvDisplayTaskFunction,
                  "Display Task",
                  configMINIMAL_STACK_SIZE,
@@ -292,15 +317,19 @@ void main( void )
     /* Create FreeRTOS objects  */
     /* Create semaphores        */
     /* Create Queue*/
-    xCharQueue              =   xQueueCreate(mainCHAR_QUEUE_LENGTH,sizeof(char));
     xCommandQueue           =   xQueueCreate(mainDIODE_COMMAND_QUEUE_LENGTH,sizeof(diode_command_t));
     /* Create timer */
     xDispTimer         = xTimerCreate("Display timer",
-                                           pdMS_TO_TICKS(5),
+                                           mainDISP_PERIOD_TICKS,
                                            pdTRUE,
                                            &xTimerTaskHandle,
                                            prvDispTimerCallback);
     xEvent_Timer          =   xSemaphoreCreateBinary();
+    xDisplayMailbox       =   xQueueCreate(mainDISPLAY_MAILBOX_LENGTH,sizeof(uint8_t));
+    /* Create queue set and add display task event sources to it */
+    xDisplaySet           =   xQueueCreateSet(mainDISPLAY_SET_LENGTH);
+    xQueueAddToSet(xDisplayMailbox, xDisplaySet);
+    xQueueAddToSet(xEvent_Timer, xDisplaySet);
     /* Start timer with initial period */
     xTimerStart(xDispTimer,portMAX_DELAY);
     /* Start the scheduler. */
@@ -326,26 +355,10 @@ static void prvSetupHardware( void )
     hal430SetSystemClock( configCPU_CLOCK_HZ, configLFXT_CLOCK_HZ );
 
     /* - Init buttons - */
-    /*Set direction to input*/
-    P1DIR &= ~0x30;
-    /*Enable pull-up resistor*/
-    P1REN |= 0x30;
-    P1OUT |= 0x30;
-    /*Enable interrupt for pin connected to SW3*/
-    P1IE  |= 0x30;
-    P1IFG &=~0x30;
-    /*Interrupt is generated during high to low transition*/
-    P1IES |= 0x30;
+    vHALButtonInit();
 
     /* Initialize UART */
-
-     P4SEL       |= BIT4+BIT5;                    // P4.4,5 = USCI_AA TXD/RXD
-     UCA1CTL1    |= UCSWRST;                      // **Put state machine in reset**
-     UCA1CTL1    |= UCSSEL_2;                     // SMCLK
-     UCA1BRW      = 1041;                         // 1MHz - Baudrate 9600
-     UCA1MCTL    |= UCBRS_6 + UCBRF_0;            // Modulation UCBRSx=1, UCBRFx=0
-     UCA1CTL1    &= ~UCSWRST;                     // **Initialize USCI state machine**
-     UCA1IE      |= UCRXIE;                       // Enable USCI_A1 RX interrupt
+    vHALUARTInit( 9600 );
 
     /* initialize LEDs */
     vHALInitLED();
@@ -355,7 +368,7 @@ static void prvSetupHardware( void )
         /*enable global interrupts*/
     taskENABLE_INTERRUPTS();
 }
-// Echo back RXed character, confirm TX buffer is ready first
+// Pass received byte to frame protocol layer
 void __attribute__ ( ( interrupt( USCI_A1_VECTOR  ) ) ) vUARTISR( void )
 {
     BaseType_t xHigherPriorityTaskWoken = pdFALSE;
@@ -364,8 +377,7 @@ void __attribute__ ( ( interrupt( USCI_A1_VECTOR  ) ) ) vUARTISR( void )
     {
         case 0:break;                             // Vector 0 - no interrupt
         case 2:                                   // Vector 2 - RXIFG
-            xQueueSendToBackFromISR(xCharQueue, &UCA1RXBUF, &xHigherPriorityTaskWoken);
-            UCA1TXBUF = UCA1RXBUF;
+            vHALFrameReceiveFromISR(UCA1RXBUF, &xHigherPriorityTaskWoken);
         break;
         case 4:break;                             // Vector 4 - TXIFG
         default: break;
@@ -373,18 +385,3 @@ void __attribute__ ( ( interrupt( USCI_A1_VECTOR  ) ) ) vUARTISR( void )
     /* trigger scheduler if higher priority task is woken */
     portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
 }
-
-void __attribute__ ( ( interrupt( PORT1_VECTOR  ) ) ) vPORT1ISR( void )
-{
-    BaseType_t xHigherPriorityTaskWoken = pdFALSE;
-    /* Give semaphore if button SW3 is pressed*/
-    /* Note: This check is not truly necessary but it is good to
-     * have it*/
-    if(((P1IFG & 0x10) == 0x10) || ((P1IFG & 0x20) == 0x20)){
-        vTaskNotifyGiveFromISR( xButtonTaskHandle, &xHigherPriorityTaskWoken);
-    }
-    /*Clear IFG register on exit. Read more about it in offical MSP430F5529 documentation*/
-    P1IFG &=~0x30;
-    /* trigger scheduler if higher priority task is woken */
-    portYIELD_FROM_ISR( xHigherPriorityTaskWoken );
-}
@@ -0,0 +1,78 @@
+/**
+ * @file    hal_cobs.c
+ * @date    2021
+ * @brief   COBS AND CRC-16 API
+ */
+
+#include "hal_cobs.h"
+
+uint16_t usHALCRC16( const uint8_t *pucData, uint16_t usLength ){
+    uint16_t    usCRC = 0xFFFF;
+    uint8_t     i;
+
+    while( usLength-- > 0 ){
+        usCRC ^= ( uint16_t ) ( *pucData++ ) << 8;
+        for( i = 0; i < 8; i++ ){
+            if( usCRC & 0x8000 ){
+                usCRC = ( usCRC << 1 ) ^ 0x1021;
+            }
+            else{
+                usCRC <<= 1;
+            }
+        }
+    }
+    return usCRC;
+}
+
+uint16_t usHALCOBSEncode( const uint8_t *pucIn, uint16_t usLength, uint8_t *pucOut ){
+    uint16_t    usRead      = 0;
+    uint16_t    usWrite     = 1;
+    uint16_t    usCodeIndex = 0;
+    uint8_t     ucCode      = 1;
+
+    while( usRead < usLength ){
+        if( pucIn[ usRead ] == 0 ){
+            /*Zero byte ends current block*/
+            pucOut[ usCodeIndex ] = ucCode;
+            usCodeIndex = usWrite++;
+            ucCode = 1;
+        }
+        else{
+            pucOut[ usWrite++ ] = pucIn[ usRead ];
+            ucCode++;
+            if( ucCode == 0xFF ){
+                /*Block of 254 non-zero bytes, start new one*/
+                pucOut[ usCodeIndex ] = ucCode;
+                usCodeIndex = usWrite++;
+                ucCode = 1;
+            }
+        }
+        usRead++;
+    }
+    pucOut[ usCodeIndex ] = ucCode;
+
+    return usWrite;
+}
+
+uint16_t usHALCOBSDecode( const uint8_t *pucIn, uint16_t usLength, uint8_t *pucOut ){
+    uint16_t    usRead  = 0;
+    uint16_t    usWrite = 0;
+    uint8_t     ucCode;
+    uint8_t     i;
+
+    while( usRead < usLength ){
+        ucCode = pucIn[ usRead++ ];
+        if( ( ucCode == 0 ) || ( ( usRead + ucCode - 1 ) > usLength ) ){
+            return 0;
+        }
+        for( i = 1; i < ucCode; i++ ){
+            pucOut[ usWrite++ ] = pucIn[ usRead++ ];
+        }
+        /*Block shorter than 254 bytes was terminated by zero, except the last one*/
+        if( ( ucCode != 0xFF ) && ( usRead < usLength ) ){
+            pucOut[ usWrite++ ] = 0;
+        }
+    }
+
+    return usWrite;
+}
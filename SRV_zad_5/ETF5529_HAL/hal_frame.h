@@ -0,0 +1,66 @@
+/**
+ * @file    hal_frame.h
+ * @date    2021
+ * @brief   UART FRAME PROTOCOL API
+ *
+ * Framed binary command channel. Every frame is
+ * COBS( type | payload | CRC-16 high | CRC-16 low ) followed by 0x00
+ * delimiter. Frames are assembled from RX ISR and complete frames are
+ * dispatched by frame task to handler registered for frame type.
+ */
+
+#include <stdint.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#include "hal_cobs.h"
+#ifndef HAL_FRAME_H_
+#define HAL_FRAME_H_
+
+/*Frame delimiter, never appears inside encoded frame*/
+#define HAL_FRAME_DELIMITER             0x00
+/*Maximal payload length in bytes*/
+#ifndef HAL_FRAME_MAX_PAYLOAD
+#define HAL_FRAME_MAX_PAYLOAD           16
+#endif
+/*Number of frame types, frame types are 0 to HAL_FRAME_MAX_TYPES - 1*/
+#ifndef HAL_FRAME_MAX_TYPES
+#define HAL_FRAME_MAX_TYPES             8
+#endif
+/*Number of receive buffers, one is filled by ISR while others wait for dispatch*/
+#ifndef HAL_FRAME_RX_BUFFERS
+#define HAL_FRAME_RX_BUFFERS            2
+#endif
+
+/*Decoded frame size: type, payload and CRC*/
+#define HAL_FRAME_MAX_DECODED           ( 1 + HAL_FRAME_MAX_PAYLOAD + 2 )
+/*Encoded frame size including delimiter*/
+#define HAL_FRAME_MAX_ENCODED           ( HAL_COBS_MAX_ENCODED( HAL_FRAME_MAX_DECODED ) + 1 )
+
+/*Frame handler, called from frame task with decoded and checked payload*/
+typedef void ( *hal_frame_handler_t )( const uint8_t *pucPayload, uint8_t ucLength );
+
+typedef struct{
+    uint32_t    ulFrames;           /* Frames dispatched to handlers */
+    uint32_t    ulCRCErrors;        /* Frames dropped because of bad CRC or COBS */
+    uint32_t    ulOverruns;         /* Frames dropped because of length or no free buffer */
+    uint32_t    ulUnknownType;      /* Frames without registered handler */
+    uint32_t    ulTimeouts;         /* Partial frames dropped because line went quiet */
+}hal_frame_stats_t;
+
+/*Create frame task and its queue*/
+BaseType_t  xHALFrameInit( UBaseType_t uxPriority );
+/*Handle of frame task, NULL before xHALFrameInit*/
+TaskHandle_t xHALFrameGetTaskHandle( void );
+/*Register handler for frame type*/
+BaseType_t  xHALFrameRegisterHandler( uint8_t ucType, hal_frame_handler_t pxHandler );
+/*Drop partial frame when no byte arrives for ulMicroseconds to twice that,
+ *0 disables. Uses one hal_hrtimer channel, xHALHRTimerInit must be called*/
+void        vHALFrameSetByteTimeout( uint32_t ulMicroseconds );
+/*Feed received byte, must be called from UART RX ISR*/
+void        vHALFrameReceiveFromISR( uint8_t ucByte, BaseType_t *pxHigherPriorityTaskWoken );
+/*Build complete frame with delimiter, pucOut must hold HAL_FRAME_MAX_ENCODED bytes*/
+uint16_t    usHALFrameEncode( uint8_t ucType, const uint8_t *pucPayload, uint8_t ucLength, uint8_t *pucOut );
+/*Copy protocol counters*/
+void        vHALFrameGetStats( hal_frame_stats_t *pxStats );
+
+#endif /* HAL_FRAME_H_ */
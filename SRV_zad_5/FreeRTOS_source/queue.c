@@ -74,6 +74,10 @@ typedef struct SemaphoreData
 {
 	TaskHandle_t xMutexHolder;		 /*< The handle of the task that holds the mutex. */
 	UBaseType_t uxRecursiveCallCount;/*< Maintains a count of the number of times a recursive mutex has been recursively 'taken' when the structure is used as a mutex. */
+	#if( configUSE_CEILING_MUTEXES == 1 )
+		UBaseType_t uxCeilingPriority;	/*< Priority the holder is raised to on take.  0 for a priority inheritance mutex. */
+		UBaseType_t uxSavedPriority;	/*< Base priority of the holder before it was raised to the ceiling. */
+	#endif
 } SemaphoreData_t;
 
 /* Semaphores do not actually store or copy data, so have an item size of
@@ -81,6 +85,11 @@ zero. */
 #define queueSEMAPHORE_QUEUE_ITEM_LENGTH ( ( UBaseType_t ) 0 )
 #define queueMUTEX_GIVE_BLOCK_TIME		 ( ( TickType_t ) 0U )
 
+#if( configUSE_CEILING_MUTEXES == 1 )
+	/* Priority ceiling mutexes are mutexes with a non zero ceiling. */
+	#define prvIsCeilingMutex( pxQueue ) ( ( ( pxQueue )->uxQueueType == queueQUEUE_IS_MUTEX ) && ( ( pxQueue )->u.xSemaphore.uxCeilingPriority != ( UBaseType_t ) 0 ) )
+#endif
+
 #if( configUSE_PREEMPTION == 0 )
 	/* If the cooperative scheduler is being used then a yield should not be
 	performed just because a higher priority task has been woken. */
@@ -203,7 +212,7 @@ static void prvCopyDataFromQueue( Queue_t * const pxQueue, void * const pvBuffer
 	 * Checks to see if a queue is a member of a queue set, and if so, notifies
 	 * the queue set that the queue contains data.
 	 */
-	static BaseType_t prvNotifyQueueSetContainer( const Queue_t * const pxQueue, const BaseType_t xCopyPosition ) PRIVILEGED_FUNCTION;
+	static BaseType_t prvNotifyQueueSetContainer( const Queue_t * const pxQueue ) PRIVILEGED_FUNCTION;
 #endif
 
 /*
@@ -484,6 +493,15 @@ static void prvInitialiseNewQueue( const UBaseType_t uxQueueLength, const UBaseT
 			/* In case this is a recursive mutex. */
 			pxNewQueue->u.xSemaphore.uxRecursiveCallCount = 0;
 
+			#if( configUSE_CEILING_MUTEXES == 1 )
+			{
+				/* Priority inheritance unless xQueueCreateMutexCeiling() sets
+				a ceiling. */
+				pxNewQueue->u.xSemaphore.uxCeilingPriority = 0;
+				pxNewQueue->u.xSemaphore.uxSavedPriority = 0;
+			}
+			#endif
+
 			traceCREATE_MUTEX( pxNewQueue );
 
 			/* Start with the semaphore in the expected state. */
@@ -514,6 +532,35 @@ static void prvInitialiseNewQueue( const UBaseType_t uxQueueLength, const UBaseT
 #endif /* configUSE_MUTEXES */
 /*-----------------------------------------------------------*/
 
+#if( ( configUSE_CEILING_MUTEXES == 1 ) && ( configSUPPORT_DYNAMIC_ALLOCATION == 1 ) )
+
+	QueueHandle_t xQueueCreateMutexCeiling( const UBaseType_t uxCeilingPriority )
+	{
+	QueueHandle_t xNewQueue;
+
+		/* A ceiling of 0 would be the idle priority, and is used to mark a
+		priority inheritance mutex. */
+		configASSERT( ( uxCeilingPriority > ( UBaseType_t ) 0 ) && ( uxCeilingPriority < ( UBaseType_t ) configMAX_PRIORITIES ) );
+
+		xNewQueue = xQueueCreateMutex( queueQUEUE_TYPE_CEILING_MUTEX );
+
+		if( xNewQueue != NULL )
+		{
+			/* Set after prvInitialiseMutex() has given the mutex, so the
+			initial give does not try to restore a holder priority. */
+			( ( Queue_t * ) xNewQueue )->u.xSemaphore.uxCeilingPriority = uxCeilingPriority;
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return xNewQueue;
+	}
+
+#endif /* configUSE_CEILING_MUTEXES */
+/*-----------------------------------------------------------*/
+
 #if( ( configUSE_MUTEXES == 1 ) && ( configSUPPORT_STATIC_ALLOCATION == 1 ) )
 
 	QueueHandle_t xQueueCreateMutexStatic( const uint8_t ucQueueType, StaticQueue_t *pxStaticQueue )
@@ -790,7 +837,7 @@ Queue_t * const pxQueue = xQueue;
 							in the queue has not changed. */
 							mtCOVERAGE_TEST_MARKER();
 						}
-						else if( prvNotifyQueueSetContainer( pxQueue, xCopyPosition ) != pdFALSE )
+						else if( prvNotifyQueueSetContainer( pxQueue ) != pdFALSE )
 						{
 							/* The queue is a member of a queue set, and posting
 							to the queue set caused a higher priority task to
@@ -990,6 +1037,9 @@ Queue_t * const pxQueue = xQueue;
 		if( ( pxQueue->uxMessagesWaiting < pxQueue->uxLength ) || ( xCopyPosition == queueOVERWRITE ) )
 		{
 			const int8_t cTxLock = pxQueue->cTxLock;
+			#if ( configUSE_QUEUE_SETS == 1 )
+				const UBaseType_t uxPreviousMessagesWaiting = pxQueue->uxMessagesWaiting;
+			#endif
 
 			traceQUEUE_SEND_FROM_ISR( pxQueue );
 
@@ -1008,7 +1058,15 @@ Queue_t * const pxQueue = xQueue;
 				{
 					if( pxQueue->pxQueueSetContainer != NULL )
 					{
-						if( prvNotifyQueueSetContainer( pxQueue, xCopyPosition ) != pdFALSE )
+						if( ( xCopyPosition == queueOVERWRITE ) && ( uxPreviousMessagesWaiting != ( UBaseType_t ) 0 ) )
+						{
+							/* Do not notify the queue set as an existing item
+							was overwritten in the queue so the number of items
+							in the queue has not changed, and the set already
+							holds this queue's handle. */
+							mtCOVERAGE_TEST_MARKER();
+						}
+						else if( prvNotifyQueueSetContainer( pxQueue ) != pdFALSE )
 						{
 							/* The queue is a member of a queue set, and posting
 							to the queue set caused a higher priority task to
@@ -1086,9 +1144,27 @@ Queue_t * const pxQueue = xQueue;
 			}
 			else
 			{
-				/* Increment the lock count so the task that unlocks the queue
-				knows that data was posted while it was locked. */
-				pxQueue->cTxLock = ( int8_t ) ( cTxLock + 1 );
+				#if ( configUSE_QUEUE_SETS == 1 )
+				{
+					/* An overwrite that did not change the number of items must
+					not make the unlocking task post this queue to its set a
+					second time. */
+					if( ( xCopyPosition == queueOVERWRITE ) && ( uxPreviousMessagesWaiting != ( UBaseType_t ) 0 ) )
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+					else
+					{
+						pxQueue->cTxLock = ( int8_t ) ( cTxLock + 1 );
+					}
+				}
+				#else
+				{
+					/* Increment the lock count so the task that unlocks the queue
+					knows that data was posted while it was locked. */
+					pxQueue->cTxLock = ( int8_t ) ( cTxLock + 1 );
+				}
+				#endif /* configUSE_QUEUE_SETS */
 			}
 
 			xReturn = pdPASS;
@@ -1173,7 +1249,7 @@ Queue_t * const pxQueue = xQueue;
 				{
 					if( pxQueue->pxQueueSetContainer != NULL )
 					{
-						if( prvNotifyQueueSetContainer( pxQueue, queueSEND_TO_BACK ) != pdFALSE )
+						if( prvNotifyQueueSetContainer( pxQueue ) != pdFALSE )
 						{
 							/* The semaphore is a member of a queue set, and
 							posting	to the queue set caused a higher priority
@@ -1464,6 +1540,22 @@ Queue_t * const pxQueue = xQueue;
 						/* Record the information required to implement
 						priority inheritance should it become necessary. */
 						pxQueue->u.xSemaphore.xMutexHolder = pvTaskIncrementMutexHeldCount();
+
+						#if( configUSE_CEILING_MUTEXES == 1 )
+						{
+							if( pxQueue->u.xSemaphore.uxCeilingPriority != ( UBaseType_t ) 0 )
+							{
+								/* Immediate ceiling protocol - raise the holder
+								now, so no task that uses the mutex can run
+								until it is given back. */
+								pxQueue->u.xSemaphore.uxSavedPriority = uxTaskPriorityRaiseToCeiling( pxQueue->u.xSemaphore.uxCeilingPriority );
+							}
+							else
+							{
+								mtCOVERAGE_TEST_MARKER();
+							}
+						}
+						#endif /* configUSE_CEILING_MUTEXES */
 					}
 					else
 					{
@@ -1495,6 +1587,26 @@ Queue_t * const pxQueue = xQueue;
 			}
 			else
 			{
+				#if( configUSE_CEILING_MUTEXES == 1 )
+				{
+					if( prvIsCeilingMutex( pxQueue ) )
+					{
+						/* The holder of a ceiling mutex runs at the ceiling, so
+						a task can only find it held if its own priority is
+						above the ceiling or the holder blocked while holding
+						it.  Both are design errors - never block on it. */
+						configASSERT( pxQueue->u.xSemaphore.xMutexHolder == NULL );
+						taskEXIT_CRITICAL();
+						traceQUEUE_RECEIVE_FAILED( pxQueue );
+						return errQUEUE_EMPTY;
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				#endif /* configUSE_CEILING_MUTEXES */
+
 				if( xTicksToWait == ( TickType_t ) 0 )
 				{
 					/* For inheritance to have occurred there must have been an
@@ -2083,7 +2195,16 @@ UBaseType_t uxMessagesWaiting;
 			if( pxQueue->uxQueueType == queueQUEUE_IS_MUTEX )
 			{
 				/* The mutex is no longer being held. */
-				xReturn = xTaskPriorityDisinherit( pxQueue->u.xSemaphore.xMutexHolder );
+				#if( configUSE_CEILING_MUTEXES == 1 )
+				if( pxQueue->u.xSemaphore.uxCeilingPriority != ( UBaseType_t ) 0 )
+				{
+					xReturn = xTaskPriorityRestoreFromCeiling( pxQueue->u.xSemaphore.xMutexHolder, pxQueue->u.xSemaphore.uxSavedPriority );
+				}
+				else
+				#endif /* configUSE_CEILING_MUTEXES */
+				{
+					xReturn = xTaskPriorityDisinherit( pxQueue->u.xSemaphore.xMutexHolder );
+				}
 				pxQueue->u.xSemaphore.xMutexHolder = NULL;
 			}
 			else
@@ -2185,7 +2306,7 @@ static void prvUnlockQueue( Queue_t * const pxQueue )
 			{
 				if( pxQueue->pxQueueSetContainer != NULL )
 				{
-					if( prvNotifyQueueSetContainer( pxQueue, queueSEND_TO_BACK ) != pdFALSE )
+					if( prvNotifyQueueSetContainer( pxQueue ) != pdFALSE )
 					{
 						/* The queue is a member of a queue set, and posting to
 						the queue set caused a higher priority task to unblock.
@@ -2860,6 +2981,65 @@ Queue_t * const pxQueue = xQueue;
 #endif /* configUSE_QUEUE_SETS */
 /*-----------------------------------------------------------*/
 
+#if ( configUSE_QUEUE_SETS == 1 )
+
+	QueueSetMemberHandle_t xQueueSelectFromSetAndReceive( QueueSetHandle_t xQueueSet, void * const pvBuffer, TickType_t const xTicksToWait )
+	{
+	QueueSetMemberHandle_t xReturn = NULL;
+	Queue_t *pxMember;
+
+		( void ) xQueueReceive( ( QueueHandle_t ) xQueueSet, &xReturn, xTicksToWait ); /*lint !e961 Casting from one typedef to another is not redundant. */
+
+		if( xReturn != NULL )
+		{
+			pxMember = ( Queue_t * ) xReturn;
+
+			/* Mutexes need the full take path for priority inheritance. */
+			configASSERT( pxMember->uxQueueType != queueQUEUE_IS_MUTEX );
+			configASSERT( !( ( pvBuffer == NULL ) && ( pxMember->uxItemSize != ( UBaseType_t ) 0U ) ) );
+
+			taskENTER_CRITICAL();
+			{
+				/* Only the task that selects from the set takes items out of
+				its members, so the item that posted this handle is still
+				there.  Nothing can block waiting to receive from a member, so
+				the only event list to service is that of blocked senders. */
+				configASSERT( pxMember->uxMessagesWaiting != ( UBaseType_t ) 0 );
+
+				traceQUEUE_RECEIVE( pxMember );
+
+				prvCopyDataFromQueue( pxMember, pvBuffer );
+				pxMember->uxMessagesWaiting--;
+
+				if( listLIST_IS_EMPTY( &( pxMember->xTasksWaitingToSend ) ) == pdFALSE )
+				{
+					if( xTaskRemoveFromEventList( &( pxMember->xTasksWaitingToSend ) ) != pdFALSE )
+					{
+						queueYIELD_IF_USING_PREEMPTION();
+					}
+					else
+					{
+						mtCOVERAGE_TEST_MARKER();
+					}
+				}
+				else
+				{
+					mtCOVERAGE_TEST_MARKER();
+				}
+			}
+			taskEXIT_CRITICAL();
+		}
+		else
+		{
+			mtCOVERAGE_TEST_MARKER();
+		}
+
+		return xReturn;
+	}
+
+#endif /* configUSE_QUEUE_SETS */
+/*-----------------------------------------------------------*/
+
 #if ( configUSE_QUEUE_SETS == 1 )
 
 	QueueSetMemberHandle_t xQueueSelectFromSetFromISR( QueueSetHandle_t xQueueSet )
@@ -2875,7 +3055,7 @@ Queue_t * const pxQueue = xQueue;
 
 #if ( configUSE_QUEUE_SETS == 1 )
 
-	static BaseType_t prvNotifyQueueSetContainer( const Queue_t * const pxQueue, const BaseType_t xCopyPosition )
+	static BaseType_t prvNotifyQueueSetContainer( const Queue_t * const pxQueue )
 	{
 	Queue_t *pxQueueSetContainer = pxQueue->pxQueueSetContainer;
 	BaseType_t xReturn = pdFALSE;
@@ -2891,8 +3071,11 @@ Queue_t * const pxQueue = xQueue;
 
 			traceQUEUE_SEND( pxQueueSetContainer );
 
-			/* The data copied is the handle of the queue that contains data. */
-			xReturn = prvCopyDataToQueue( pxQueueSetContainer, &pxQueue, xCopyPosition );
+			/* The data copied is the handle of the queue that contains data.
+			It is always appended, the copy position used for the member (in
+			particular queueOVERWRITE) must not displace the handles of other
+			members that are already waiting in the set. */
+			xReturn = prvCopyDataToQueue( pxQueueSetContainer, &pxQueue, queueSEND_TO_BACK );
 
 			if( cTxLock == queueUNLOCKED )
 			{
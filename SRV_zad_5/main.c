@@ -29,36 +29,37 @@ static void prvSetupHardware( void );
 static void prvTask1Function( void *pvParameters );
 static void prvTask2Function( void *pvParameters );
 
+/** Task 1 handle, used for button event notifications */
+TaskHandle_t xTask1Handle;
+
+#if( configUSE_LATENCY_PROBE == 1 )
+/** Tick ISR to Task 1 latency in cycles, read with debugger */
+hal_latency_stats_t xButtonLatency;
+#endif
+
 /**
  * @brief Task 1 function
  *
- * This task check if button is pressed and change state of diode
- * LD3. At the end, task is blocked for 200 Ticks
+ * This task counts debounced SW3 presses and change state of diode
+ * LD3 after every third press
  */
 static void prvTask1Function( void *pvParameters )
 {
     static uint16_t cnt = 0;
-    uint16_t i;
-    /*Initial button states are 1 because of pull-up configuration*/
-    uint8_t     previousButtonState = 1;
-    uint8_t     currentButtonState  = 1;
+    uint32_t    buttonEvents;
+
+    /*Receive debounced SW3 press events*/
+    xHALButtonSubscribe(xTask1Handle, HAL_BUTTON_EVENT_PRESS(HAL_BUTTON_SW3));
     for ( ;; )
     {
-        /*Read button state*/
-        currentButtonState = ((P1IN & 0x10) >> 4);//BIT4
-        /*Detected button signal edge*/
-        if( previousButtonState != currentButtonState){
-            for(i = 0; i < 1000; i++);
-            /*read button state again to verify rising edge of button signal*/
-            currentButtonState = ((P1IN & 0x10) >> 4);
-            previousButtonState = currentButtonState;
-            if(currentButtonState == 0){
-                /* If button is still pressed toggle diode LD3 */
-                cnt++;
-            }
+        /*Wait for button press*/
+        buttonEvents = ulHALButtonWaitEvent(portMAX_DELAY);
+        if(buttonEvents & HAL_BUTTON_EVENT_PRESS(HAL_BUTTON_SW3)){
+            cnt++;
         }
-        /* delay for synchronization */
-        //vTaskDelay( 200 );
+#if( configUSE_LATENCY_PROBE == 1 )
+        vHALLatencyGetStats(HAL_BUTTON_LATENCY_PAIR, &xButtonLatency);
+#endif
 
         if(cnt == 3){
             halTOGGLE_LED( LED3 );
@@ -97,7 +98,7 @@ void main( void )
                  configMINIMAL_STACK_SIZE,
                  NULL,//no arguments
                  mainTAKS_1_PRIO,
-                 NULL
+                 &xTask1Handle
                ) != pdPASS) while(1);
     if(xTaskCreate( prvTask2Function,
                  "Task 2",
@@ -130,9 +131,10 @@ static void prvSetupHardware( void )
     hal430SetSystemClock( configCPU_CLOCK_HZ, configLFXT_CLOCK_HZ );
 
     /* Init buttons */
-    P1DIR &= ~0x30;
-    P1REN |= 0x30;
-    P1OUT |= 0x30;
+    vHALButtonInit();
+
+    /* Start latency probe, nothing if configUSE_LATENCY_PROBE is 0 */
+    HAL_LATENCY_INIT();
 
     /* initialize LEDs */
     vHALInitLED();
@@ -0,0 +1,140 @@
+/**
+ * @file    admission_tool.c
+ * @date    2021
+ * @brief   OFFLINE ADMISSION TEST
+ *
+ * Reads a task set and runs the same analysis xTaskCreateAdmitted()
+ * runs on the board, so a set can be checked before it is built.
+ * One task per line, fields separated by blanks:
+ *
+ *   # name  priority  period  wcet  [deadline]
+ *   ctrl    3         10      2
+ *   log     edf       100     20    50
+ *
+ * Priority "edf" stands for configEDF_PRIORITY, 2 as on the board, so
+ * a numeric priority of 2 is in the EDF band too. Times are in any unit
+ * shared by all tasks, deadline 0 or missing means the period. Prints
+ * response time of each task, "miss" if it can miss its deadline, and
+ * the verdict. Exit status is 0 if the set is schedulable, 1 if not,
+ * 2 on bad input.
+ *
+ *   admission [file]       reads standard input without file
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "analysis.h"
+
+#define mainLINE_LENGTH     128
+#define mainNAME_LENGTH     32
+
+typedef struct{
+    char            pcName[ mainNAME_LENGTH ];
+    UBaseType_t     uxPriority;
+    TaskTiming_t    xTiming;
+    TaskHandle_t    xHandle;
+}host_task_t;
+
+static host_task_t  pxTasks[ configADMISSION_MAX_TASKS ];
+
+/* Parse one line into pxTask, returns 1 for a task, 0 for blank or
+ * comment line and -1 for bad line */
+static int prvParseLine( const char *pcLine, host_task_t *pxTask )
+{
+    char            pcPriority[ 16 ];
+    unsigned long   ulPeriod;
+    unsigned long   ulWCET;
+    unsigned long   ulDeadline = 0;
+    int             iFields;
+
+    while( ( *pcLine == ' ' ) || ( *pcLine == '\t' ) ){
+        pcLine++;
+    }
+    if( ( *pcLine == '#' ) || ( *pcLine == '\n' ) || ( *pcLine == '\r' ) || ( *pcLine == '\0' ) ){
+        return 0;
+    }
+
+    iFields = sscanf( pcLine, "%31s %15s %lu %lu %lu", pxTask->pcName, pcPriority, &ulPeriod, &ulWCET, &ulDeadline );
+    if( ( iFields < 4 ) || ( ulPeriod == 0 ) || ( ulWCET == 0 ) ){
+        return -1;
+    }
+
+    if( strcmp( pcPriority, "edf" ) == 0 ){
+        pxTask->uxPriority = configEDF_PRIORITY;
+    }
+    else{
+        pxTask->uxPriority = ( UBaseType_t ) strtoul( pcPriority, NULL, 10 );
+        if( ( pxTask->uxPriority == 0 ) || ( pxTask->uxPriority >= configMAX_PRIORITIES ) ){
+            return -1;
+        }
+    }
+    pxTask->xTiming.ulPeriod = ulPeriod;
+    pxTask->xTiming.ulWCET = ulWCET;
+    pxTask->xTiming.ulDeadline = ulDeadline;
+
+    return 1;
+}
+
+int main( int argc, char *argv[] )
+{
+    FILE       *pxInput = stdin;
+    char        pcLine[ mainLINE_LENGTH ];
+    host_task_t *pxTask;
+    host_task_t xParsed;
+    unsigned    uCount = 0;
+    unsigned    uLine = 0;
+    unsigned    i;
+    uint32_t    ulResponse;
+    int         iResult;
+
+    if( argc > 1 ){
+        pxInput = fopen( argv[ 1 ], "r" );
+        if( pxInput == NULL ){
+            perror( argv[ 1 ] );
+            return 2;
+        }
+    }
+
+    vAnalysisReset();
+    while( fgets( pcLine, sizeof( pcLine ), pxInput ) != NULL ){
+        uLine++;
+        iResult = prvParseLine( pcLine, &xParsed );
+        if( iResult < 0 ){
+            fprintf( stderr, "line %u: expected name, priority, period, wcet and optional deadline\n", uLine );
+            return 2;
+        }
+        if( iResult == 0 ){
+            continue;
+        }
+        if( uCount == configADMISSION_MAX_TASKS ){
+            fprintf( stderr, "line %u: more than %u tasks\n", uLine, ( unsigned ) configADMISSION_MAX_TASKS );
+            return 2;
+        }
+        pxTask = &pxTasks[ uCount++ ];
+        *pxTask = xParsed;
+        xAnalysisAddTask( pxTask->uxPriority, &pxTask->xTiming, &pxTask->xHandle );
+    }
+
+    printf( "task,priority,period,wcet,deadline,response\n" );
+    for( i = 0; i < uCount; i++ ){
+        pxTask = &pxTasks[ i ];
+        printf( "%s,%u,%lu,%lu,%lu,", pxTask->pcName, ( unsigned ) pxTask->uxPriority,
+                ( unsigned long ) pxTask->xTiming.ulPeriod, ( unsigned long ) pxTask->xTiming.ulWCET,
+                ( unsigned long ) ( ( pxTask->xTiming.ulDeadline != 0 ) ? pxTask->xTiming.ulDeadline : pxTask->xTiming.ulPeriod ) );
+        ulResponse = ulAnalysisResponseTime( pxTask->xHandle );
+        if( ulResponse == 0 ){
+            printf( "miss\n" );
+        }
+        else{
+            printf( "%lu\n", ( unsigned long ) ulResponse );
+        }
+    }
+
+    if( xAnalysisIsSchedulable() != pdFALSE ){
+        printf( "# schedulable\n" );
+        return 0;
+    }
+    printf( "# unschedulable\n" );
+    return 1;
+}
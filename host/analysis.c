@@ -0,0 +1,71 @@
+/**
+ * @file    analysis.c
+ * @date    2021
+ * @brief   HOST BUILD OF THE ADMISSION ANALYSIS
+ *
+ * admission.c is compiled into this file, so a task set can be reset
+ * between analyses. The only kernel functions it calls are provided
+ * here: the scheduler is never started, and creating a task only hands
+ * out a distinct handle.
+ */
+
+#include "admission.c"
+#include "analysis.h"
+
+static uint8_t      pucHandles[ configADMISSION_MAX_TASKS ];
+static UBaseType_t  uxCreated = 0;
+
+void vTaskSuspendAll( void )
+{
+}
+
+BaseType_t xTaskResumeAll( void )
+{
+    return pdFALSE;
+}
+
+BaseType_t xTaskCreate( TaskFunction_t pxTaskCode, const char * const pcName, const configSTACK_DEPTH_TYPE usStackDepth,
+                        void * const pvParameters, UBaseType_t uxPriority, TaskHandle_t * const pxCreatedTask )
+{
+    ( void ) pxTaskCode;
+    ( void ) pcName;
+    ( void ) usStackDepth;
+    ( void ) pvParameters;
+    ( void ) uxPriority;
+
+    if( uxCreated >= ( UBaseType_t ) configADMISSION_MAX_TASKS ){
+        return errCOULD_NOT_ALLOCATE_REQUIRED_MEMORY;
+    }
+    *pxCreatedTask = ( TaskHandle_t ) &pucHandles[ uxCreated++ ];
+    return pdPASS;
+}
+
+static void prvNoTask( void *pvParameters )
+{
+    ( void ) pvParameters;
+}
+
+void vAnalysisReset( void )
+{
+    uxAdmittedCount = 0;
+    xOverloaded = pdFALSE;
+    uxCreated = 0;
+}
+
+BaseType_t xAnalysisAddTask( UBaseType_t uxPriority, const TaskTiming_t *pxTiming, TaskHandle_t *pxHandle )
+{
+    if( xTaskCreateAdmitted( prvNoTask, "host", configMINIMAL_STACK_SIZE, NULL, uxPriority, pxTiming, pxHandle ) != pdPASS ){
+        return pdFAIL;
+    }
+    return pdPASS;
+}
+
+BaseType_t xAnalysisIsSchedulable( void )
+{
+    return ( xAdmissionIsOverloaded() == pdFALSE ) ? pdTRUE : pdFALSE;
+}
+
+uint32_t ulAnalysisResponseTime( TaskHandle_t xHandle )
+{
+    return ulAdmissionGetResponseTime( xHandle );
+}
@@ -0,0 +1,27 @@
+/**
+ * @file    analysis.h
+ * @date    2021
+ * @brief   HOST BUILD OF THE ADMISSION ANALYSIS
+ *
+ * Runs the schedulability analysis of admission.c on the host. Tasks are
+ * added one at a time as xTaskCreateAdmitted() would admit them, with
+ * configADMISSION_REJECT_UNSCHEDULABLE 0 so the whole set is analysed.
+ */
+
+#ifndef ANALYSIS_H_
+#define ANALYSIS_H_
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "admission.h"
+
+/*Forget all tasks, start a new task set*/
+void        vAnalysisReset( void );
+/*Add task to set, returns pdFAIL if set already holds configADMISSION_MAX_TASKS*/
+BaseType_t  xAnalysisAddTask( UBaseType_t uxPriority, const TaskTiming_t *pxTiming, TaskHandle_t *pxHandle );
+/*pdTRUE if every task added so far meets its deadline*/
+BaseType_t  xAnalysisIsSchedulable( void );
+/*Worst case response time of task, 0 if it could miss its deadline*/
+uint32_t    ulAnalysisResponseTime( TaskHandle_t xHandle );
+
+#endif /* ANALYSIS_H_ */
@@ -0,0 +1,186 @@
+/**
+ * @file    cyclic_table.c
+ * @date    2021
+ * @brief   CYCLIC EXECUTIVE SCHEDULE TABLE GENERATOR
+ *
+ * Expands a job list into the schedule table xCyclicExecutiveStart()
+ * would build at start, and prints it as a C header for
+ * xCyclicExecutiveStartFromTable(). One job per line, fields separated
+ * by blanks, periods and offsets in minor frames:
+ *
+ *   # name     period  [offset]
+ *   display    1
+ *   adc        40      0
+ *
+ * Job n of the list is bit n of every table entry, so the job table on
+ * the board must list jobs in the same order. The header also defines
+ * tableNAME_PERIOD and tableNAME_OFFSET for every job, so the job table
+ * can be written with them instead of repeating the numbers. Exit
+ * status is 0 on success, 2 on bad input.
+ *
+ *   cyclic_table [file] > cyclic_table.h   reads standard input without file
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+#define mainLINE_LENGTH     128
+#define mainNAME_LENGTH     32
+/** Bits in UBaseType_t of the MSP430X port */
+#define mainMAX_JOBS        16
+/** Largest UBaseType_t of the MSP430X port */
+#define mainMAX_FRAMES      65535UL
+/** Table entries printed on one line */
+#define mainPER_LINE        8
+
+typedef struct{
+    char            pcName[ mainNAME_LENGTH ];
+    unsigned long   ulPeriod;
+    unsigned long   ulOffset;
+}host_job_t;
+
+static host_job_t   pxJobs[ mainMAX_JOBS ];
+
+static unsigned long prvGCD( unsigned long ulA, unsigned long ulB )
+{
+    unsigned long ulRemainder;
+
+    while( ulB != 0 ){
+        ulRemainder = ulA % ulB;
+        ulA = ulB;
+        ulB = ulRemainder;
+    }
+    return ulA;
+}
+
+/* Parse one line into pxJob, returns 1 for a job, 0 for blank or comment
+ * line and -1 for bad line */
+static int prvParseLine( const char *pcLine, host_job_t *pxJob )
+{
+    const char *pcName;
+    int         iFields;
+
+    while( ( *pcLine == ' ' ) || ( *pcLine == '\t' ) ){
+        pcLine++;
+    }
+    if( ( *pcLine == '#' ) || ( *pcLine == '\n' ) || ( *pcLine == '\r' ) || ( *pcLine == '\0' ) ){
+        return 0;
+    }
+
+    pxJob->ulOffset = 0;
+    iFields = sscanf( pcLine, "%31s %lu %lu", pxJob->pcName, &pxJob->ulPeriod, &pxJob->ulOffset );
+    if( ( iFields < 2 ) || ( pxJob->ulPeriod == 0 ) || ( pxJob->ulOffset >= pxJob->ulPeriod ) ){
+        return -1;
+    }
+    /* Name becomes part of a macro name */
+    if( !isalpha( ( unsigned char ) pxJob->pcName[ 0 ] ) ){
+        return -1;
+    }
+    for( pcName = pxJob->pcName; *pcName != '\0'; pcName++ ){
+        if( !isalnum( ( unsigned char ) *pcName ) && ( *pcName != '_' ) ){
+            return -1;
+        }
+    }
+
+    return 1;
+}
+
+static void prvPrintMacroName( const char *pcName, const char *pcSuffix )
+{
+    int iLength = 0;
+
+    iLength += printf( "#define table" );
+    while( *pcName != '\0' ){
+        putchar( toupper( ( unsigned char ) *pcName++ ) );
+        iLength++;
+    }
+    iLength += printf( "%s", pcSuffix );
+    printf( "%*s", ( iLength < 40 ) ? 40 - iLength : 1, "" );
+}
+
+int main( int argc, char *argv[] )
+{
+    FILE           *pxInput = stdin;
+    const char     *pcInputName = "standard input";
+    char            pcLine[ mainLINE_LENGTH ];
+    host_job_t      xJob;
+    unsigned        uCount = 0;
+    unsigned        uLine = 0;
+    unsigned        i;
+    unsigned long   ulMajor = 1;
+    unsigned long   ulFrame;
+    unsigned long   ulEntry;
+    int             iResult;
+
+    if( argc > 1 ){
+        pcInputName = ( strrchr( argv[ 1 ], '/' ) != NULL ) ? strrchr( argv[ 1 ], '/' ) + 1 : argv[ 1 ];
+        pxInput = fopen( argv[ 1 ], "r" );
+        if( pxInput == NULL ){
+            perror( argv[ 1 ] );
+            return 2;
+        }
+    }
+
+    while( fgets( pcLine, sizeof( pcLine ), pxInput ) != NULL ){
+        uLine++;
+        iResult = prvParseLine( pcLine, &xJob );
+        if( iResult < 0 ){
+            fprintf( stderr, "line %u: expected name, period and optional offset below period\n", uLine );
+            return 2;
+        }
+        if( iResult == 0 ){
+            continue;
+        }
+        if( uCount == mainMAX_JOBS ){
+            fprintf( stderr, "line %u: more than %u jobs\n", uLine, ( unsigned ) mainMAX_JOBS );
+            return 2;
+        }
+        /* Period is at most mainMAX_FRAMES, so the product can't overflow */
+        if( xJob.ulPeriod > mainMAX_FRAMES ){
+            fprintf( stderr, "line %u: major frame longer than %lu minor frames\n", uLine, mainMAX_FRAMES );
+            return 2;
+        }
+        ulMajor = ( ulMajor / prvGCD( ulMajor, xJob.ulPeriod ) ) * xJob.ulPeriod;
+        if( ulMajor > mainMAX_FRAMES ){
+            fprintf( stderr, "line %u: major frame longer than %lu minor frames\n", uLine, mainMAX_FRAMES );
+            return 2;
+        }
+        pxJobs[ uCount++ ] = xJob;
+    }
+    if( uCount == 0 ){
+        fprintf( stderr, "no jobs\n" );
+        return 2;
+    }
+
+    printf( "/* Generated by host/cyclic_table from %s, do not edit. */\n\n", pcInputName );
+    printf( "#ifndef CYCLIC_TABLE_H\n#define CYCLIC_TABLE_H\n\n" );
+    printf( "/* Periods and offsets in minor frames, job table must list jobs in this order */\n" );
+    for( i = 0; i < uCount; i++ ){
+        prvPrintMacroName( pxJobs[ i ].pcName, "_PERIOD" );
+        printf( "( %lu )\n", pxJobs[ i ].ulPeriod );
+        prvPrintMacroName( pxJobs[ i ].pcName, "_OFFSET" );
+        printf( "( %lu )\n", pxJobs[ i ].ulOffset );
+    }
+    prvPrintMacroName( "", "JOBS" );
+    printf( "( %u )\n", uCount );
+    prvPrintMacroName( "", "FRAMES" );
+    printf( "( %lu )\n\n", ulMajor );
+
+    printf( "/* Bit n of entry f is set if job n runs in minor frame f */\n" );
+    printf( "static const UBaseType_t puxCyclicTable[ tableFRAMES ] = {" );
+    for( ulFrame = 0; ulFrame < ulMajor; ulFrame++ ){
+        ulEntry = 0;
+        for( i = 0; i < uCount; i++ ){
+            if( ( ulFrame % pxJobs[ i ].ulPeriod ) == pxJobs[ i ].ulOffset ){
+                ulEntry |= 1UL << i;
+            }
+        }
+        printf( "%s0x%04lX%s", ( ulFrame % mainPER_LINE == 0 ) ? "\n    " : " ", ulEntry,
+                ( ulFrame + 1 < ulMajor ) ? "," : "\n" );
+    }
+    printf( "};\n\n#endif /* CYCLIC_TABLE_H */\n" );
+
+    return 0;
+}
@@ -0,0 +1,141 @@
+/**
+ * @file    edf_rm_sweep.c
+ * @date    2021
+ * @brief   EDF AND RATE MONOTONIC SCHEDULABILITY SWEEP
+ *
+ * Generates random periodic task sets of given total utilisation and
+ * checks each one twice with the admission analysis: once with rate
+ * monotonic priorities, once with all tasks in the EDF band. Prints
+ * the percentage of schedulable sets for both, one row per utilisation,
+ * so the range where EDF admits sets RM does not can be read off.
+ *
+ * Utilisations are split by UUniFast, periods are log-uniform from
+ * 100 to 10000 and execution times are rounded up, so actual utilisation
+ * of a set is a little above the nominal one. Deadlines equal periods.
+ *
+ *   edf_rm_sweep [tasks [sets [seed]]]     defaults 5 1000 1
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include "analysis.h"
+
+#define mainMIN_PERIOD      100.0
+#define mainMAX_PERIOD      10000.0
+#define mainSTEPS           11              // 0.50 to 1.00 in 0.05
+
+#if( configEDF_PRIORITY != ( configMAX_PRIORITIES - 1 ) )
+#error Build with configEDF_PRIORITY at the top priority, so RM priorities stay below it
+#endif
+
+static TaskTiming_t pxSet[ configADMISSION_MAX_TASKS ];
+static UBaseType_t  puxPriority[ configADMISSION_MAX_TASKS ];
+
+static double prvRandom( void )
+{
+    return ( rand() + 1.0 ) / ( RAND_MAX + 2.0 );
+}
+
+/* UUniFast: n utilisations, uniformly distributed, summing to dTotal */
+static void prvGenerateSet( unsigned uTasks, double dTotal )
+{
+    double      dRemaining = dTotal;
+    double      dNext;
+    double      dUtilisation;
+    double      dPeriod;
+    unsigned    i;
+
+    for( i = 0; i < uTasks; i++ ){
+        if( i < uTasks - 1 ){
+            dNext = dRemaining * pow( prvRandom(), 1.0 / ( uTasks - 1 - i ) );
+            dUtilisation = dRemaining - dNext;
+            dRemaining = dNext;
+        }
+        else{
+            dUtilisation = dRemaining;
+        }
+        dPeriod = exp( log( mainMIN_PERIOD ) + prvRandom() * ( log( mainMAX_PERIOD ) - log( mainMIN_PERIOD ) ) );
+        pxSet[ i ].ulPeriod = ( uint32_t ) dPeriod;
+        pxSet[ i ].ulWCET = ( uint32_t ) ceil( dUtilisation * pxSet[ i ].ulPeriod );
+        if( pxSet[ i ].ulWCET == 0 ){
+            pxSet[ i ].ulWCET = 1;
+        }
+        pxSet[ i ].ulDeadline = 0;
+    }
+}
+
+/* Shorter period gets higher priority, from configMAX_PRIORITIES-2 down */
+static void prvRateMonotonic( unsigned uTasks )
+{
+    unsigned    i;
+    unsigned    j;
+    unsigned    uRank;
+
+    for( i = 0; i < uTasks; i++ ){
+        uRank = 0;
+        for( j = 0; j < uTasks; j++ ){
+            if( ( pxSet[ j ].ulPeriod < pxSet[ i ].ulPeriod ) ||
+                ( ( pxSet[ j ].ulPeriod == pxSet[ i ].ulPeriod ) && ( j < i ) ) ){
+                uRank++;
+            }
+        }
+        puxPriority[ i ] = ( UBaseType_t ) ( configMAX_PRIORITIES - 2 - uRank );
+    }
+}
+
+static BaseType_t prvCheck( unsigned uTasks, BaseType_t xEDF )
+{
+    TaskHandle_t    xHandle;
+    unsigned        i;
+
+    vAnalysisReset();
+    for( i = 0; i < uTasks; i++ ){
+        xAnalysisAddTask( ( xEDF != pdFALSE ) ? configEDF_PRIORITY : puxPriority[ i ], &pxSet[ i ], &xHandle );
+    }
+    return xAnalysisIsSchedulable();
+}
+
+int main( int argc, char *argv[] )
+{
+    unsigned    uTasks = 5;
+    unsigned    uSets = 1000;
+    unsigned    uStep;
+    unsigned    uSet;
+    unsigned    uRM;
+    unsigned    uEDF;
+    double      dUtilisation;
+
+    if( argc > 1 ){
+        uTasks = ( unsigned ) strtoul( argv[ 1 ], NULL, 10 );
+    }
+    if( argc > 2 ){
+        uSets = ( unsigned ) strtoul( argv[ 2 ], NULL, 10 );
+    }
+    srand( ( argc > 3 ) ? ( unsigned ) strtoul( argv[ 3 ], NULL, 10 ) : 1 );
+    if( ( uTasks < 1 ) || ( uTasks > configMAX_PRIORITIES - 2 ) || ( uSets < 1 ) ){
+        fprintf( stderr, "tasks must be 1 to %u, sets at least 1\n", ( unsigned ) configMAX_PRIORITIES - 2 );
+        return 2;
+    }
+
+    printf( "# tasks %u, sets %u\n", uTasks, uSets );
+    printf( "utilisation,rm_schedulable_pct,edf_schedulable_pct\n" );
+    for( uStep = 0; uStep < mainSTEPS; uStep++ ){
+        dUtilisation = 0.50 + 0.05 * uStep;
+        uRM = 0;
+        uEDF = 0;
+        for( uSet = 0; uSet < uSets; uSet++ ){
+            prvGenerateSet( uTasks, dUtilisation );
+            prvRateMonotonic( uTasks );
+            if( prvCheck( uTasks, pdFALSE ) != pdFALSE ){
+                uRM++;
+            }
+            if( prvCheck( uTasks, pdTRUE ) != pdFALSE ){
+                uEDF++;
+            }
+        }
+        printf( "%.2f,%.1f,%.1f\n", dUtilisation, 100.0 * uRM / uSets, 100.0 * uEDF / uSets );
+    }
+
+    return 0;
+}
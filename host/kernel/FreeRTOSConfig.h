@@ -0,0 +1,36 @@
+/*
+ * Configuration for host tests that build the kernel itself, on the port
+ * layer in port/.  The scheduler is never started: a test creates tasks,
+ * which makes the highest priority one the current task, and then drives
+ * the kernel by calling the API and xTaskIncrementTick() from main().
+ * Features are those of the target FreeRTOSConfig.h the tests cover.
+ *
+ * 1 tab == 4 spaces!
+ */
+
+#ifndef FREERTOS_CONFIG_H
+#define FREERTOS_CONFIG_H
+
+#include <assert.h>
+
+#define configUSE_PREEMPTION			1
+#define configUSE_IDLE_HOOK				0
+#define configUSE_TICK_HOOK				0
+#define configTICK_RATE_HZ				( ( TickType_t ) 1000 )
+#define configMAX_PRIORITIES			( 8 )
+#define configMINIMAL_STACK_SIZE		( ( unsigned short ) 120 )
+#define configMAX_TASK_NAME_LEN			( 10 )
+#define configUSE_16_BIT_TICKS			1
+#define configUSE_MUTEXES				1
+#define configUSE_CEILING_MUTEXES		1
+#define configUSE_PREEMPTION_THRESHOLD	1
+#define configUSE_TASK_BUDGETS			1
+#define configSUPPORT_DYNAMIC_ALLOCATION	1
+
+#define INCLUDE_uxTaskPriorityGet		1
+#define INCLUDE_vTaskSuspend			1
+#define INCLUDE_vTaskDelay				1
+
+#define configASSERT( x ) assert( x )
+
+#endif /* FREERTOS_CONFIG_H */
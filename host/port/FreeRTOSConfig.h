@@ -0,0 +1,40 @@
+/*
+ * Configuration for host builds of kernel-independent sources.  Matches the
+ * target FreeRTOSConfig.h in everything the analysis depends on.  The host
+ * programs set configEDF_PRIORITY themselves where they need another band.
+ *
+ * 1 tab == 4 spaces!
+ */
+
+#ifndef FREERTOS_CONFIG_H
+#define FREERTOS_CONFIG_H
+
+#include <assert.h>
+
+#define configUSE_PREEMPTION			1
+#define configUSE_IDLE_HOOK				0
+#define configUSE_TICK_HOOK				0
+#define configTICK_RATE_HZ				( ( TickType_t ) 1000 )
+#define configMAX_PRIORITIES			( 32 )
+#define configMINIMAL_STACK_SIZE		( ( unsigned short ) 120 )
+#define configMAX_TASK_NAME_LEN			( 10 )
+#define configUSE_16_BIT_TICKS			1
+#define configUSE_MUTEXES				1
+#define configSUPPORT_DYNAMIC_ALLOCATION	1
+#define configUSE_EDF_SCHEDULING		1
+#ifndef configEDF_PRIORITY
+	#define configEDF_PRIORITY			( 2 )
+#endif
+#define configUSE_ADMISSION_CONTROL		1
+#define configADMISSION_MAX_TASKS		32
+/* Every task is entered so the whole set is analysed, not just the part
+that fits. */
+#define configADMISSION_REJECT_UNSCHEDULABLE	0
+
+#define INCLUDE_vTaskSuspend			1
+#define INCLUDE_vTaskDelayUntil			1
+#define INCLUDE_vTaskDelay				1
+
+#define configASSERT( x ) assert( x )
+
+#endif /* FREERTOS_CONFIG_H */
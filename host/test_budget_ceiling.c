@@ -0,0 +1,129 @@
+/**
+ * @file    test_budget_ceiling.c
+ * @date    2021
+ * @brief   HOST TEST OF TASK BUDGETS AGAINST MUTEXES
+ *
+ * The kernel is built with the host port, without starting the scheduler.
+ * The budgeted task is created first at the highest priority, so it is
+ * the current task and every tick is charged to it. The test checks that
+ * running out of budget or getting it back while a mutex is held leaves
+ * the priority alone, and that the change is applied when the mutex is
+ * given back. Returns number of failed checks.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+
+#define testBUDGET_PRIORITY     ( 4 )
+#define testCEILING_PRIORITY    ( 6 )
+#define testOTHER_PRIORITY      ( 3 )
+#define testBUDGET_TICKS        ( 3 )
+#define testPERIOD_TICKS        ( 10 )
+
+static int iFailures = 0;
+
+#define testCHECK( xCondition, pcWhat )     prvCheck( ( xCondition ), ( pcWhat ), __LINE__ )
+
+static void prvCheck( int xCondition, const char *pcWhat, int iLine )
+{
+    if( !xCondition ){
+        printf( "FAIL line %d: %s\n", iLine, pcWhat );
+        iFailures++;
+    }
+}
+
+/* Port layer the kernel needs to create tasks, the scheduler never starts */
+StackType_t *pxPortInitialiseStack( StackType_t *pxTopOfStack, TaskFunction_t pxCode, void *pvParameters )
+{
+    ( void ) pxCode;
+    ( void ) pvParameters;
+    return pxTopOfStack;
+}
+
+BaseType_t xPortStartScheduler( void )
+{
+    return pdFALSE;
+}
+
+void vPortEndScheduler( void )
+{
+}
+
+void *pvPortMalloc( size_t xSize )
+{
+    return malloc( xSize );
+}
+
+void vPortFree( void *pv )
+{
+    free( pv );
+}
+
+static void prvTask( void *pvParameters )
+{
+    ( void ) pvParameters;
+}
+
+static void prvTick( UBaseType_t uxTicks )
+{
+    while( uxTicks-- > 0 ){
+        ( void ) xTaskIncrementTick();
+    }
+}
+
+int main( void )
+{
+    static TaskBudget_t xBudget;
+    TaskHandle_t        xTask;
+    TaskHandle_t        xOther;
+    SemaphoreHandle_t   xCeiling;
+    SemaphoreHandle_t   xMutex;
+    UBaseType_t         i;
+
+    xTaskCreate( prvTask, "budget", configMINIMAL_STACK_SIZE, NULL, testBUDGET_PRIORITY, &xTask );
+    xTaskCreate( prvTask, "other", configMINIMAL_STACK_SIZE, NULL, testOTHER_PRIORITY, &xOther );
+    xCeiling = xSemaphoreCreateMutexCeiling( testCEILING_PRIORITY );
+    xMutex = xSemaphoreCreateMutex();
+    if( ( xTask == NULL ) || ( xOther == NULL ) || ( xCeiling == NULL ) || ( xMutex == NULL ) ){
+        printf( "FAIL: out of memory\n" );
+        return 1;
+    }
+    vTaskSetBudget( xTask, &xBudget, testBUDGET_TICKS, testPERIOD_TICKS );
+    testCHECK( xTaskGetCurrentTaskHandle() == xTask, "budgeted task is current" );
+
+    /* Budget runs out inside ceiling section */
+    testCHECK( xSemaphoreTake( xCeiling, 0 ) == pdPASS, "take ceiling mutex" );
+    testCHECK( uxTaskPriorityGet( xTask ) == testCEILING_PRIORITY, "raised to ceiling" );
+    prvTick( testBUDGET_TICKS );
+    testCHECK( xBudget.xRemaining == 0, "budget used up" );
+    testCHECK( uxTaskPriorityGet( xTask ) == testCEILING_PRIORITY, "exhausted holder keeps ceiling" );
+    testCHECK( xSemaphoreGive( xCeiling ) == pdPASS, "give ceiling mutex" );
+    testCHECK( uxTaskPriorityGet( xTask ) == configBUDGET_BACKGROUND_PRIORITY, "background after give" );
+
+    /* Budget comes back inside ceiling section */
+    testCHECK( xSemaphoreTake( xCeiling, 0 ) == pdPASS, "take ceiling mutex at background" );
+    testCHECK( uxTaskPriorityGet( xTask ) == testCEILING_PRIORITY, "raised to ceiling from background" );
+    for( i = 0; ( i < testPERIOD_TICKS ) && ( xBudget.xRemaining == 0 ); i++ ){
+        prvTick( 1 );
+    }
+    testCHECK( xBudget.xRemaining != 0, "budget replenished" );
+    testCHECK( uxTaskPriorityGet( xTask ) == testCEILING_PRIORITY, "replenished holder keeps ceiling" );
+    testCHECK( xSemaphoreGive( xCeiling ) == pdPASS, "give ceiling mutex after replenish" );
+    testCHECK( uxTaskPriorityGet( xTask ) == testBUDGET_PRIORITY, "budget priority after give" );
+
+    /* Nested ceiling and inheritance mutexes, budget runs out inside */
+    testCHECK( xSemaphoreTake( xMutex, 0 ) == pdPASS, "take mutex" );
+    testCHECK( xSemaphoreTake( xCeiling, 0 ) == pdPASS, "take nested ceiling mutex" );
+    prvTick( testBUDGET_TICKS );
+    testCHECK( xBudget.xRemaining == 0, "budget used up again" );
+    testCHECK( xSemaphoreGive( xCeiling ) == pdPASS, "give nested ceiling mutex" );
+    testCHECK( uxTaskPriorityGet( xTask ) == testBUDGET_PRIORITY, "mutex still held, saved priority kept" );
+    testCHECK( xSemaphoreGive( xMutex ) == pdPASS, "give mutex" );
+    testCHECK( uxTaskPriorityGet( xTask ) == configBUDGET_BACKGROUND_PRIORITY, "background after last give" );
+
+    printf( "test_budget_ceiling: %d failure(s)\n", iFailures );
+    return iFailures;
+}
@@ -0,0 +1,218 @@
+/**
+ * @file    test_cobs.c
+ * @date    2021
+ * @brief   HOST TEST OF COBS AND CRC-16
+ *
+ * Loopback test of hal_cobs built with host compiler. Frames are built
+ * and checked the same way hal_frame does it: type, payload and CRC-16
+ * sent high byte first, COBS encoded. Returns number of failed checks.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "hal_cobs.h"
+
+#define testMAX_BLOCK       600
+
+static int iFailures = 0;
+
+#define testCHECK( xCondition, pcWhat )     prvCheck( ( xCondition ), ( pcWhat ), __LINE__ )
+
+static void prvCheck( int xCondition, const char *pcWhat, int iLine )
+{
+    if( !xCondition ){
+        printf( "FAIL line %d: %s\n", iLine, pcWhat );
+        iFailures++;
+    }
+}
+
+/* Encode, check there are no zeros and no overrun of worst case size,
+ * decode in place and compare with input */
+static void prvRoundTrip( const uint8_t *pucIn, uint16_t usLength, const char *pcWhat )
+{
+    uint8_t     pucEncoded[ HAL_COBS_MAX_ENCODED( testMAX_BLOCK ) ];
+    uint16_t    usEncoded;
+    uint16_t    usDecoded;
+    uint16_t    i;
+
+    usEncoded = usHALCOBSEncode( pucIn, usLength, pucEncoded );
+    testCHECK( usEncoded <= HAL_COBS_MAX_ENCODED( usLength ), pcWhat );
+    for( i = 0; i < usEncoded; i++ ){
+        if( pucEncoded[ i ] == 0 ){
+            testCHECK( 0, pcWhat );
+            break;
+        }
+    }
+    usDecoded = usHALCOBSDecode( pucEncoded, usEncoded, pucEncoded );
+    testCHECK( ( usDecoded == usLength ) && ( memcmp( pucEncoded, pucIn, usLength ) == 0 ), pcWhat );
+}
+
+/* Same frame layout as usHALFrameEncode, without delimiter */
+static uint16_t prvFrameEncode( uint8_t ucType, const uint8_t *pucPayload, uint8_t ucLength, uint8_t *pucOut )
+{
+    uint8_t     pucFrame[ 1 + 255 + 2 ];
+    uint16_t    usCRC;
+
+    pucFrame[ 0 ] = ucType;
+    memcpy( &pucFrame[ 1 ], pucPayload, ucLength );
+    usCRC = usHALCRC16( pucFrame, ucLength + 1 );
+    pucFrame[ ucLength + 1 ] = ( uint8_t ) ( usCRC >> 8 );
+    pucFrame[ ucLength + 2 ] = ( uint8_t ) usCRC;
+
+    return usHALCOBSEncode( pucFrame, ucLength + 3, pucOut );
+}
+
+/* Same checks as frame task: decodes, is long enough and CRC matches.
+ * Returns payload length, or -1 if the frame is rejected */
+static int prvFrameCheck( uint8_t *pucFrame, uint16_t usEncoded )
+{
+    uint16_t    usLength;
+    uint16_t    usCRC;
+
+    usLength = usHALCOBSDecode( pucFrame, usEncoded, pucFrame );
+    if( usLength < 3 ){
+        return -1;
+    }
+    usCRC = ( ( uint16_t ) pucFrame[ usLength - 2 ] << 8 ) | pucFrame[ usLength - 1 ];
+    if( usHALCRC16( pucFrame, usLength - 2 ) != usCRC ){
+        return -1;
+    }
+    return usLength - 3;
+}
+
+static void prvTestCRC( void )
+{
+    /* Check value of CRC-16/CCITT-FALSE */
+    testCHECK( usHALCRC16( ( const uint8_t * ) "123456789", 9 ) == 0x29B1, "crc check value" );
+    testCHECK( usHALCRC16( NULL, 0 ) == 0xFFFF, "crc of empty block" );
+}
+
+static void prvTestZeroRuns( void )
+{
+    uint8_t     pucBlock[ testMAX_BLOCK ];
+    uint8_t     pucEncoded[ 8 ];
+    uint16_t    i;
+
+    memset( pucBlock, 0, sizeof( pucBlock ) );
+    prvRoundTrip( pucBlock, 0, "empty block" );
+    prvRoundTrip( pucBlock, 1, "single zero" );
+    prvRoundTrip( pucBlock, 2, "two zeros" );
+    prvRoundTrip( pucBlock, 300, "run of 300 zeros" );
+
+    /* Every zero becomes a code byte of 1 */
+    testCHECK( usHALCOBSEncode( pucBlock, 3, pucEncoded ) == 4, "three zeros encoded length" );
+    for( i = 0; i < 4; i++ ){
+        testCHECK( pucEncoded[ i ] == 1, "three zeros encode to 01 01 01 01" );
+    }
+
+    /* Zeros at both ends and in the middle */
+    for( i = 0; i < 20; i++ ){
+        pucBlock[ i ] = ( i % 5 == 0 ) ? 0 : ( uint8_t ) i;
+    }
+    pucBlock[ 19 ] = 0;
+    prvRoundTrip( pucBlock, 20, "zeros at ends and inside" );
+}
+
+static void prvTestLongBlocks( void )
+{
+    uint8_t     pucBlock[ testMAX_BLOCK ];
+    uint8_t     pucEncoded[ HAL_COBS_MAX_ENCODED( testMAX_BLOCK ) ];
+    uint16_t    usLength;
+    uint16_t    i;
+
+    for( i = 0; i < testMAX_BLOCK; i++ ){
+        pucBlock[ i ] = ( uint8_t ) ( 1 + i % 255 );
+    }
+    /* 254 non-zero bytes fill one block exactly, 255 spill into second */
+    for( usLength = 252; usLength <= 257; usLength++ ){
+        prvRoundTrip( pucBlock, usLength, "block around 254 bytes" );
+    }
+    prvRoundTrip( pucBlock, 508, "two full blocks" );
+    prvRoundTrip( pucBlock, 509, "two full blocks and one byte" );
+
+    testCHECK( usHALCOBSEncode( pucBlock, 254, pucEncoded ) == 256, "254 bytes encoded length" );
+    testCHECK( ( pucEncoded[ 0 ] == 0xFF ) && ( pucEncoded[ 255 ] == 0x01 ), "254 bytes code bytes" );
+    testCHECK( usHALCOBSEncode( pucBlock, 255, pucEncoded ) == 257, "255 bytes encoded length" );
+    testCHECK( ( pucEncoded[ 0 ] == 0xFF ) && ( pucEncoded[ 255 ] == 0x02 ), "255 bytes code bytes" );
+
+    /* Zero right after a full block */
+    pucBlock[ 254 ] = 0;
+    prvRoundTrip( pucBlock, 256, "zero after full block" );
+}
+
+static void prvTestRandom( void )
+{
+    uint8_t     pucBlock[ testMAX_BLOCK ];
+    uint16_t    usLength;
+    uint16_t    i;
+    int         iRound;
+
+    srand( 1 );
+    for( iRound = 0; iRound < 5000; iRound++ ){
+        usLength = ( uint16_t ) ( rand() % testMAX_BLOCK );
+        for( i = 0; i < usLength; i++ ){
+            pucBlock[ i ] = ( rand() % 4 == 0 ) ? 0 : ( uint8_t ) rand();
+        }
+        prvRoundTrip( pucBlock, usLength, "random block" );
+    }
+}
+
+static void prvTestFrames( void )
+{
+    const uint8_t   pucPayload[] = { 0x00, 0x2A, 0x00, 0x07 };
+    uint8_t         pucEncoded[ HAL_COBS_MAX_ENCODED( 258 ) ];
+    uint8_t         pucCopy[ HAL_COBS_MAX_ENCODED( 258 ) ];
+    uint16_t        usEncoded;
+    uint16_t        i;
+
+    usEncoded = prvFrameEncode( 3, pucPayload, sizeof( pucPayload ), pucEncoded );
+
+    memcpy( pucCopy, pucEncoded, usEncoded );
+    testCHECK( prvFrameCheck( pucCopy, usEncoded ) == sizeof( pucPayload ), "good frame accepted" );
+    testCHECK( ( pucCopy[ 0 ] == 3 ) && ( memcmp( &pucCopy[ 1 ], pucPayload, sizeof( pucPayload ) ) == 0 ), "good frame contents" );
+
+    /* Every single bit error in the encoded frame is either malformed
+     * COBS or caught by CRC */
+    for( i = 0; i < usEncoded * 8; i++ ){
+        memcpy( pucCopy, pucEncoded, usEncoded );
+        pucCopy[ i / 8 ] ^= ( uint8_t ) ( 1 << ( i % 8 ) );
+        if( pucCopy[ i / 8 ] == 0 ){
+            /* Would end the frame at the receiver, covered by truncation */
+            continue;
+        }
+        testCHECK( prvFrameCheck( pucCopy, usEncoded ) < 0, "bit error rejected" );
+    }
+
+    /* Frame cut short by early delimiter or lost bytes */
+    for( i = 0; i < usEncoded; i++ ){
+        memcpy( pucCopy, pucEncoded, usEncoded );
+        testCHECK( prvFrameCheck( pucCopy, i ) < 0, "truncated frame rejected" );
+    }
+
+    /* Frame with empty payload is still valid, shorter one is not */
+    usEncoded = prvFrameEncode( 1, NULL, 0, pucEncoded );
+    testCHECK( prvFrameCheck( pucEncoded, usEncoded ) == 0, "empty payload accepted" );
+    pucCopy[ 0 ] = 0x02;
+    pucCopy[ 1 ] = 0x01;
+    testCHECK( prvFrameCheck( pucCopy, 2 ) < 0, "frame without CRC rejected" );
+
+    /* Malformed COBS: code byte pointing past the end, zero code byte */
+    pucCopy[ 0 ] = 0x05;
+    pucCopy[ 1 ] = 0x11;
+    testCHECK( usHALCOBSDecode( pucCopy, 2, pucCopy ) == 0, "code past end rejected" );
+    pucCopy[ 0 ] = 0x00;
+    testCHECK( usHALCOBSDecode( pucCopy, 1, pucCopy ) == 0, "zero code rejected" );
+}
+
+int main( void )
+{
+    prvTestCRC();
+    prvTestZeroRuns();
+    prvTestLongBlocks();
+    prvTestRandom();
+    prvTestFrames();
+
+    printf( "test_cobs: %d failure(s)\n", iFailures );
+    return ( iFailures == 0 ) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,184 @@
+/**
+ * @file    test_ringbuffer.c
+ * @date    2021
+ * @brief   HOST THROUGHPUT TEST OF RING BUFFER AGAINST QUEUE
+ *
+ * Moves bursts of bytes through a ring buffer with xRingBufferPushFromISR()
+ * and xRingBufferPop(), and through a queue of the same length with
+ * xQueueSendToBackFromISR() and xQueueReceive(), the way the frame layer
+ * hands received bytes to its task. The kernel is built with the host port,
+ * without starting the scheduler, so no task is ever woken and the times
+ * are the cost of the copy and bookkeeping only. Wake up cost and the
+ * times on the board are in the ring_isr_* and queue_isr_* rows of
+ * SRV_bench.
+ *
+ * Every byte is checked to come out in order, and pushing into a full
+ * buffer or popping from an empty one must fail. Times are printed in
+ * nanoseconds per byte, best of testRUNS, and are not checked, as they
+ * depend on the host. Returns number of failed checks.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "ringbuffer.h"
+
+/** Same burst as SRV_bench */
+#define testBURST_LENGTH    ( 8 )
+#define testBURSTS          ( 1000000UL )
+#define testRUNS            ( 5 )
+
+static int iFailures = 0;
+
+#define testCHECK( xCondition, pcWhat )     prvCheck( ( xCondition ), ( pcWhat ), __LINE__ )
+
+static void prvCheck( int xCondition, const char *pcWhat, int iLine )
+{
+    if( !xCondition ){
+        printf( "FAIL line %d: %s\n", iLine, pcWhat );
+        iFailures++;
+    }
+}
+
+/* Port layer the kernel needs to link, the scheduler never starts */
+StackType_t *pxPortInitialiseStack( StackType_t *pxTopOfStack, TaskFunction_t pxCode, void *pvParameters )
+{
+    ( void ) pxCode;
+    ( void ) pvParameters;
+    return pxTopOfStack;
+}
+
+BaseType_t xPortStartScheduler( void )
+{
+    return pdFALSE;
+}
+
+void vPortEndScheduler( void )
+{
+}
+
+void *pvPortMalloc( size_t xSize )
+{
+    return malloc( xSize );
+}
+
+void vPortFree( void *pv )
+{
+    free( pv );
+}
+
+static uint8_t          pucRingStorage[ ringbufferSTORAGE_SIZE( testBURST_LENGTH, sizeof( uint8_t ) ) ];
+static RingBuffer_t     xRing;
+static QueueHandle_t    xQueue;
+
+static double prvNow( void )
+{
+    struct timespec xTime;
+
+    clock_gettime( CLOCK_MONOTONIC, &xTime );
+    return ( double ) xTime.tv_sec * 1e9 + ( double ) xTime.tv_nsec;
+}
+
+/* Returns number of bytes that came out out of order */
+static unsigned long prvRingBursts( unsigned long ulBursts )
+{
+    BaseType_t      xHigherPriorityTaskWoken = pdFALSE;
+    unsigned long   ulErrors = 0;
+    uint8_t         ucIn = 0;
+    uint8_t         ucExpected = 0;
+    uint8_t         ucOut;
+    UBaseType_t     i;
+
+    while( ulBursts-- > 0 ){
+        for( i = 0; i < testBURST_LENGTH; i++ ){
+            ( void ) xRingBufferPushFromISR( &xRing, &ucIn, &xHigherPriorityTaskWoken );
+            ucIn++;
+        }
+        while( xRingBufferPop( &xRing, &ucOut ) == pdPASS ){
+            ulErrors += ( ucOut != ucExpected++ );
+        }
+    }
+    return ulErrors + ( ucIn != ucExpected );
+}
+
+static unsigned long prvQueueBursts( unsigned long ulBursts )
+{
+    BaseType_t      xHigherPriorityTaskWoken = pdFALSE;
+    unsigned long   ulErrors = 0;
+    uint8_t         ucIn = 0;
+    uint8_t         ucExpected = 0;
+    uint8_t         ucOut;
+    UBaseType_t     i;
+
+    while( ulBursts-- > 0 ){
+        for( i = 0; i < testBURST_LENGTH; i++ ){
+            ( void ) xQueueSendToBackFromISR( xQueue, &ucIn, &xHigherPriorityTaskWoken );
+            ucIn++;
+        }
+        while( xQueueReceive( xQueue, &ucOut, 0 ) == pdPASS ){
+            ulErrors += ( ucOut != ucExpected++ );
+        }
+    }
+    return ulErrors + ( ucIn != ucExpected );
+}
+
+static double prvBestRun( unsigned long ( *pxBursts )( unsigned long ), const char *pcWhat )
+{
+    double  dBest = 0;
+    double  dStart;
+    double  dTime;
+    int     i;
+
+    for( i = 0; i < testRUNS; i++ ){
+        dStart = prvNow();
+        testCHECK( pxBursts( testBURSTS ) == 0, pcWhat );
+        dTime = prvNow() - dStart;
+        if( ( i == 0 ) || ( dTime < dBest ) ){
+            dBest = dTime;
+        }
+    }
+    return dBest / ( double ) ( testBURSTS * testBURST_LENGTH );
+}
+
+int main( void )
+{
+    BaseType_t  xHigherPriorityTaskWoken = pdFALSE;
+    uint8_t     ucItem = 0;
+    double      dRing;
+    double      dQueue;
+    UBaseType_t i;
+
+    vRingBufferInit( &xRing, pucRingStorage, testBURST_LENGTH, sizeof( uint8_t ) );
+    xQueue = xQueueCreate( testBURST_LENGTH, sizeof( uint8_t ) );
+    if( xQueue == NULL ){
+        printf( "FAIL: out of memory\n" );
+        return 1;
+    }
+
+    /* Both hold exactly one burst */
+    testCHECK( xRingBufferPop( &xRing, &ucItem ) == pdFAIL, "pop from empty ring" );
+    for( i = 0; i < testBURST_LENGTH; i++ ){
+        testCHECK( xRingBufferPushFromISR( &xRing, &ucItem, &xHigherPriorityTaskWoken ) == pdPASS, "push into ring" );
+        testCHECK( xQueueSendToBackFromISR( xQueue, &ucItem, &xHigherPriorityTaskWoken ) == pdPASS, "send to queue" );
+    }
+    testCHECK( uxRingBufferItemsWaiting( &xRing ) == testBURST_LENGTH, "ring holds a burst" );
+    testCHECK( xRingBufferPushFromISR( &xRing, &ucItem, &xHigherPriorityTaskWoken ) == pdFAIL, "push into full ring" );
+    testCHECK( xQueueSendToBackFromISR( xQueue, &ucItem, &xHigherPriorityTaskWoken ) == errQUEUE_FULL, "send to full queue" );
+    testCHECK( xHigherPriorityTaskWoken == pdFALSE, "no task woken" );
+    while( xRingBufferPop( &xRing, &ucItem ) == pdPASS ){
+    }
+    while( xQueueReceive( xQueue, &ucItem, 0 ) == pdPASS ){
+    }
+
+    dRing = prvBestRun( prvRingBursts, "ring keeps order" );
+    dQueue = prvBestRun( prvQueueBursts, "queue keeps order" );
+    printf( "ring  %6.2f ns/byte\n", dRing );
+    printf( "queue %6.2f ns/byte\n", dQueue );
+    printf( "queue/ring %.1f\n", dQueue / dRing );
+
+    printf( "test_ringbuffer: %d failure(s)\n", iFailures );
+    return iFailures;
+}